@@ -18,6 +18,9 @@ Buffer base class used for serializing objects.
 #include "TBuffer.h"
 #include "TClass.h"
 #include "TProcessID.h"
+#include "Byteswap.h"
+
+#include <cstring>
 
 constexpr Int_t kExtraSpace    = 8;   // extra space at end of buffer (used for free block count)
 constexpr Int_t kMaxBufferSize  = 0x7FFFFFFE;  // largest possible size.
@@ -385,6 +388,34 @@ TVirtualArray *TBuffer::PopDataCache()
    return val;
 }
 
+namespace {
+
+inline UShort_t ByteSwap(UShort_t x) { return Rbswap_16(x); }
+inline UInt_t ByteSwap(UInt_t x) { return Rbswap_32(x); }
+inline ULong64_t ByteSwap(ULong64_t x)
+{
+#ifdef R__USEASMSWAP
+   return Rbswap_64(x);
+#else
+   return (ULong64_t(Rbswap_32(UInt_t(x))) << 32) | Rbswap_32(UInt_t(x >> 32));
+#endif
+}
+
+/// Swaps the byte order of n consecutive, possibly unaligned values.  The loop has no dependencies between
+/// iterations and no aliasing, so that compilers turn it into vector shuffles.
+template <typename UIntT>
+void ByteSwapInPlace(char *buf, Long64_t n)
+{
+   for (Long64_t idx = 0; idx < n; ++idx) {
+      UIntT tmp;
+      memcpy(&tmp, buf + idx * sizeof(UIntT), sizeof(UIntT));
+      tmp = ByteSwap(tmp);
+      memcpy(buf + idx * sizeof(UIntT), &tmp, sizeof(UIntT));
+   }
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Byte-swap N primitive-elements in the buffer.
 /// Bulk API relies on this function.
@@ -394,30 +425,15 @@ Bool_t TBuffer::ByteSwapBuffer(Long64_t n, EDataType type)
    char *input_buf = GetCurrent();
    if ((type == EDataType::kShort_t) || (type == EDataType::kUShort_t)) {
 #ifdef R__BYTESWAP
-      Short_t *buf __attribute__((aligned(8))) = reinterpret_cast<Short_t*>(input_buf);
-      for (int idx=0; idx<n; idx++) {
-         Short_t tmp = *reinterpret_cast<Short_t*>(buf + idx); // Makes a copy of the values; frombuf can't handle aliasing.
-         char *tmp_ptr = reinterpret_cast<char *>(&tmp);
-         frombuf(tmp_ptr, buf + idx);
-      }
+      ByteSwapInPlace<UShort_t>(input_buf, n);
 #endif
    } else if ((type == EDataType::kFloat_t) || (type == EDataType::kInt_t) || (type == EDataType::kUInt_t)) {
 #ifdef R__BYTESWAP
-      Float_t *buf __attribute__((aligned(8))) = reinterpret_cast<Float_t*>(input_buf);
-      for (int idx=0; idx<n; idx++) {
-         Float_t tmp = *reinterpret_cast<Float_t*>(buf + idx); // Makes a copy of the values; frombuf can't handle aliasing.
-         char *tmp_ptr = reinterpret_cast<char *>(&tmp);
-         frombuf(tmp_ptr, buf + idx);
-      }
+      ByteSwapInPlace<UInt_t>(input_buf, n);
 #endif
    } else if ((type == EDataType::kDouble_t) || (type == EDataType::kLong64_t) || (type == EDataType::kULong64_t)) {
 #ifdef R__BYTESWAP
-      Double_t *buf __attribute__((aligned(8))) = reinterpret_cast<Double_t*>(input_buf);
-      for (int idx=0; idx<n; idx++) {
-         Double_t tmp = *reinterpret_cast<Double_t*>(buf + idx); // Makes a copy of the values; frombuf can't handle aliasing.
-         char *tmp_ptr = reinterpret_cast<char*>(&tmp);
-         frombuf(tmp_ptr, buf + idx);
-      }
+      ByteSwapInPlace<ULong64_t>(input_buf, n);
 #endif
    } else {
       return false;
@@ -27,6 +27,11 @@ namespace ROOT {
 ///    high for compression levels 8 and 9.
 ///  - Finally, the LZ4 package results in worse compression ratios
 ///    than ZLIB but achieves much faster decompression rates.
+///  - The ZSTD dictionary setting compresses the baskets of each TTree branch with a
+///    ZSTD dictionary trained on the first baskets of the branch and stored with it.
+///    It improves the compression ratio and the decompression speed of small baskets,
+///    e.g. the ones of many low-entropy branches. The other buffers are compressed
+///    with ZSTD without dictionary.
 ///
 /// The current algorithms support level 1 to 9. The higher the level the greater
 /// the compression and more CPU time and memory resources used during compression.
@@ -39,6 +44,7 @@ namespace ROOT {
 ///   [207 - 208]
 ///  - LZ4 is recommended to be used with compression level 4 [404]
 ///  - ZSTD is recommended to be used with compression level 5 [505]
+///  - ZSTD with dictionaries is recommended to be used with compression level 5 [605]
 
 struct RCompressionSetting {
    struct EDefaults { /// Note: this is only temporarily a struct and will become a enum class hence the name convention
@@ -96,6 +102,8 @@ struct RCompressionSetting {
          kLZ4,
          /// Use ZSTD compression
          kZSTD,
+         /// Use ZSTD compression with dictionaries trained on the first baskets of each TTree branch
+         kZSTDDictionary,
          /// Undefined compression algorithm (must be kept the last of the list in case a new algorithm is added).
          kUndefined
       };
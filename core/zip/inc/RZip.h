@@ -10,6 +10,8 @@
  *************************************************************************/
 #include "Compression.h"
 
+#include <cstddef>
+
 /**
  * These are definitions of various free functions for the C-style compression routines in ROOT.
  */
@@ -33,6 +35,36 @@ extern "C" void R__unzip(int *srcsize, unsigned char *src, int *tgtsize, unsigne
 
 extern "C" int R__unzip_header(int *srcsize, unsigned char *src, int *tgtsize);
 
+/**
+ * Support for the ZSTD compression with dictionaries (ROOT::RCompressionSetting::EAlgorithm::kZSTDDictionary).
+ *
+ * R__trainZSTDDictionary trains a dictionary of at most dictCapacity bytes on nSamples buffers stored one after the
+ * other in samples, and returns its size (0 if the training failed). R__createZSTDDictionary digests a dictionary for
+ * the given compression level and returns a handle, or nullptr if it is not a valid dictionary. The handle is owned
+ * by the caller, who releases it with R__deleteZSTDDictionary; it can be shared by concurrent zip and unzip calls.
+ *
+ * Buffers are compressed with a dictionary by R__zipZSTDDictionary. They can only be uncompressed by
+ * R__unzipWithZSTDDictionary, given the same dictionary; R__unzip fails on them. R__unzipWithZSTDDictionary
+ * uncompresses any other buffer like R__unzip. R__getZSTDDictionaryID returns the ID of the dictionary that a
+ * buffer was compressed with, or 0 if it was compressed without dictionary or with another algorithm.
+ */
+struct R__ZSTDDictionary;
+
+extern "C" size_t R__trainZSTDDictionary(char *dict, size_t dictCapacity, const char *samples,
+                                         const size_t *sampleSizes, unsigned int nSamples);
+
+extern "C" R__ZSTDDictionary *R__createZSTDDictionary(const char *dict, size_t dictSize, int cxlevel);
+
+extern "C" void R__deleteZSTDDictionary(R__ZSTDDictionary *dictionary);
+
+extern "C" void R__zipZSTDDictionary(const R__ZSTDDictionary *dictionary, int cxlevel, int *srcsize, char *src,
+                                     int *tgtsize, char *tgt, int *irep);
+
+extern "C" void R__unzipWithZSTDDictionary(const R__ZSTDDictionary *dictionary, int *srcsize, unsigned char *src,
+                                           int *tgtsize, unsigned char *tgt, int *irep);
+
+extern "C" unsigned int R__getZSTDDictionaryID(int srcsize, const unsigned char *src);
+
 enum { kMAXZIPBUF = 0xffffff };
 
 #endif
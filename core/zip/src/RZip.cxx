@@ -98,7 +98,9 @@ void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize,
      R__zipLZMA(cxlevel, srcsize, src, tgtsize, tgt, irep);
   } else if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kLZ4) {
      R__zipLZ4(cxlevel, srcsize, src, tgtsize, tgt, irep);
-  } else if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kZSTD) {
+  } else if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kZSTD ||
+             compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kZSTDDictionary) {
+     // Without a dictionary (see R__zipZSTDDictionary), kZSTDDictionary is plain ZSTD.
      R__zipZSTD(cxlevel, srcsize, src, tgtsize, tgt, irep);
   } else if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kOldCompressionAlgo || compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kUseGlobal) {
      R__zipOld(cxlevel, srcsize, src, tgtsize, tgt, irep);
@@ -319,7 +321,8 @@ int R__unzip_header(int *srcsize, uch *src, int *tgtsize)
  ***********************************************************************/
 // N.B. (Brian) - I have kept the original note out of complete awe of the
 // age of the original code...
-void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
+static void R__unzipImpl(const R__ZSTDDictionary *zstdDictionary, int *srcsize, uch *src, int *tgtsize, uch *tgt,
+                         int *irep)
 {
    long isize;
    uch *ibufptr, *obufptr;
@@ -367,7 +370,7 @@ void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
       R__unzipLZ4(srcsize, src, tgtsize, tgt, irep);
       return;
    } else if (is_valid_header_zstd(src)) {
-      R__unzipZSTD(srcsize, src, tgtsize, tgt, irep);
+      R__unzipZSTDDictionary(zstdDictionary, srcsize, src, tgtsize, tgt, irep);
       return;
    }
 
@@ -389,6 +392,17 @@ void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
    *irep = isize;
 }
 
+void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
+{
+   R__unzipImpl(nullptr, srcsize, src, tgtsize, tgt, irep);
+}
+
+void R__unzipWithZSTDDictionary(const R__ZSTDDictionary *dictionary, int *srcsize, uch *src, int *tgtsize, uch *tgt,
+                                int *irep)
+{
+   R__unzipImpl(dictionary, srcsize, src, tgtsize, tgt, irep);
+}
+
 void R__unzipZLIB(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
      z_stream stream; /* decompression stream */
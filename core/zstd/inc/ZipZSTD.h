@@ -10,6 +10,8 @@
 #ifndef ROOT_ZipZSTD
 #define ROOT_ZipZSTD
 
+#include <stddef.h>
+
 // NOTE: the ROOT compression libraries aren't consistently written in C++; hence the
 // #ifdef's to avoid problems with C code.
 #ifdef __cplusplus
@@ -17,6 +19,18 @@ extern "C" {
 #endif
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+
+// Compression with dictionaries, see RZip.h.
+struct R__ZSTDDictionary;
+size_t R__trainZSTDDictionary(char *dict, size_t dictCapacity, const char *samples, const size_t *sampleSizes,
+                              unsigned int nSamples);
+struct R__ZSTDDictionary *R__createZSTDDictionary(const char *dict, size_t dictSize, int cxlevel);
+void R__deleteZSTDDictionary(struct R__ZSTDDictionary *dictionary);
+void R__zipZSTDDictionary(const struct R__ZSTDDictionary *dictionary, int cxlevel, int *srcsize, char *src,
+                          int *tgtsize, char *tgt, int *irep);
+void R__unzipZSTDDictionary(const struct R__ZSTDDictionary *dictionary, int *srcsize, unsigned char *src,
+                            int *tgtsize, unsigned char *tgt, int *irep);
+unsigned int R__getZSTDDictionaryID(int srcsize, const unsigned char *src);
 #ifdef __cplusplus
 }
 #endif
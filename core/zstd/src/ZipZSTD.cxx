@@ -15,6 +15,8 @@
 #include "zdict.h"
 #include <zstd.h>
 #include <memory>
+#include <mutex>
+#include <string>
 
 #include <iostream>
 
@@ -22,17 +24,61 @@ static const int kHeaderSize = 9;
 
 static const size_t errorCodeSmallBuffer = (size_t)-70;
 
-void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+namespace {
+
+struct RCDictDeleter {
+    void operator()(ZSTD_CDict *cdict) const { ZSTD_freeCDict(cdict); }
+};
+struct RDDictDeleter {
+    void operator()(ZSTD_DDict *ddict) const { ZSTD_freeDDict(ddict); }
+};
+using CDict_ptr = std::unique_ptr<ZSTD_CDict, RCDictDeleter>;
+using DDict_ptr = std::unique_ptr<ZSTD_DDict, RDDictDeleter>;
+
+} // anonymous namespace
+
+/// A dictionary digested for compression and decompression. Once created, the digested dictionaries are read-only,
+/// hence the handle can be shared by all threads.
+struct R__ZSTDDictionary {
+    std::string fContent;
+    unsigned int fID = 0;
+    int fCompressionLevel = 0; ///< The level fCDict is digested for
+    DDict_ptr fDDict;
+    mutable std::once_flag fCDictOnce;
+    mutable CDict_ptr fCDict;  ///< Created on the first compression, readers do not need it
+};
+
+static void R__compressZSTD(const R__ZSTDDictionary *dictionary, int cxlevel, int *srcsize, char *src, int *tgtsize,
+                            char *tgt, int *irep)
 {
     using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
     Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
 
     *irep = 0;
 
-    size_t retval = ZSTD_compressCCtx(fCtx.get(),
-                                        &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
-                                        src, static_cast<size_t>(*srcsize),
-                                        2*cxlevel);
+    size_t retval;
+    if (!dictionary) {
+        retval = ZSTD_compressCCtx(fCtx.get(),
+                                   &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                   src, static_cast<size_t>(*srcsize),
+                                   2*cxlevel);
+    } else if (cxlevel == dictionary->fCompressionLevel) {
+        std::call_once(dictionary->fCDictOnce, [dictionary]() {
+            dictionary->fCDict.reset(ZSTD_createCDict(dictionary->fContent.data(), dictionary->fContent.size(),
+                                                      2*dictionary->fCompressionLevel));
+        });
+        retval = ZSTD_compress_usingCDict(fCtx.get(),
+                                          &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                          src, static_cast<size_t>(*srcsize),
+                                          dictionary->fCDict.get());
+    } else {
+        // The compression level changed after the dictionary was digested, use the raw dictionary instead.
+        retval = ZSTD_compress_usingDict(fCtx.get(),
+                                         &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                         src, static_cast<size_t>(*srcsize),
+                                         dictionary->fContent.data(), dictionary->fContent.size(),
+                                         2*cxlevel);
+    }
 
     if (R__unlikely(ZSTD_isError(retval))) {
         if (R__unlikely(retval != errorCodeSmallBuffer)) {
@@ -58,7 +104,55 @@ void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
     tgt[8] = (inflate_size >> 16) & 0xff;
 }
 
-void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
+void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+{
+    R__compressZSTD(nullptr, cxlevel, srcsize, src, tgtsize, tgt, irep);
+}
+
+size_t R__trainZSTDDictionary(char *dict, size_t dictCapacity, const char *samples, const size_t *sampleSizes,
+                              unsigned int nSamples)
+{
+    size_t retval = ZDICT_trainFromBuffer(dict, dictCapacity, samples, sampleSizes, nSamples);
+    // Training fails if the samples are too few or too small, the buffers are then compressed without dictionary.
+    return ZDICT_isError(retval) ? 0 : retval;
+}
+
+R__ZSTDDictionary *R__createZSTDDictionary(const char *dict, size_t dictSize, int cxlevel)
+{
+    unsigned int dictID = ZSTD_getDictID_fromDict(dict, dictSize);
+    if (dictID == 0)
+        return nullptr;
+
+    std::unique_ptr<R__ZSTDDictionary> dictionary(new R__ZSTDDictionary);
+    dictionary->fContent.assign(dict, dictSize);
+    dictionary->fID = dictID;
+    dictionary->fCompressionLevel = cxlevel;
+    dictionary->fDDict.reset(ZSTD_createDDict(dictionary->fContent.data(), dictionary->fContent.size()));
+    if (!dictionary->fDDict)
+        return nullptr;
+    return dictionary.release();
+}
+
+void R__deleteZSTDDictionary(R__ZSTDDictionary *dictionary)
+{
+    delete dictionary;
+}
+
+void R__zipZSTDDictionary(const R__ZSTDDictionary *dictionary, int cxlevel, int *srcsize, char *src, int *tgtsize,
+                          char *tgt, int *irep)
+{
+    R__compressZSTD(dictionary, cxlevel, srcsize, src, tgtsize, tgt, irep);
+}
+
+unsigned int R__getZSTDDictionaryID(int srcsize, const unsigned char *src)
+{
+    if (srcsize <= kHeaderSize || src[0] != 'Z' || src[1] != 'S')
+        return 0;
+    return ZSTD_getDictID_fromFrame(&src[kHeaderSize], static_cast<size_t>(srcsize - kHeaderSize));
+}
+
+static void R__decompressZSTD(const R__ZSTDDictionary *dictionary, int *srcsize, unsigned char *src, int *tgtsize,
+                              unsigned char *tgt, int *irep)
 {
     using Ctx_ptr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
     Ctx_ptr fCtx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
@@ -77,9 +171,29 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
       return;
     }
 
-    size_t retval = ZSTD_decompressDCtx(fCtx.get(),
-                                        (char *)tgt, static_cast<size_t>(*tgtsize),
-                                        (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    const ZSTD_DDict *ddict = nullptr;
+    unsigned int dictID = R__getZSTDDictionaryID(*srcsize, src);
+    if (dictID != 0) {
+        if (R__unlikely(!dictionary)) {
+            std::cerr << "R__unzipZSTD: the buffer was compressed with the dictionary " << dictID
+                      << ", which was not given." << std::endl;
+            return;
+        }
+        if (R__unlikely(dictID != dictionary->fID)) {
+            std::cerr << "R__unzipZSTD: the buffer was compressed with the dictionary " << dictID
+                      << " but the dictionary " << dictionary->fID << " was given." << std::endl;
+            return;
+        }
+        ddict = dictionary->fDDict.get();
+    }
+
+    size_t retval = ddict ? ZSTD_decompress_usingDDict(fCtx.get(),
+                                                       (char *)tgt, static_cast<size_t>(*tgtsize),
+                                                       (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize),
+                                                       ddict)
+                          : ZSTD_decompressDCtx(fCtx.get(),
+                                                (char *)tgt, static_cast<size_t>(*tgtsize),
+                                                (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
 
     /* The error code 18446744073709551546 arises when the tgt buffer is too small
      * However this error is already handled outside of the compression algorithm
@@ -95,3 +209,14 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
         *irep = retval;
     }
 }
+
+void R__unzipZSTDDictionary(const R__ZSTDDictionary *dictionary, int *srcsize, unsigned char *src, int *tgtsize,
+                            unsigned char *tgt, int *irep)
+{
+    R__decompressZSTD(dictionary, srcsize, src, tgtsize, tgt, irep);
+}
+
+void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
+{
+    R__decompressZSTD(nullptr, srcsize, src, tgtsize, tgt, irep);
+}
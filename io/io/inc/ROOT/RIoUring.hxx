@@ -9,6 +9,7 @@
 #ifndef ROOT_RIoUring
 #define ROOT_RIoUring
 
+#include <cerrno>
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
@@ -94,6 +95,50 @@ public:
       int fFileDes = -1;
    };
 
+   /// Queue a read event without submitting it to the kernel. The user data is handed back by
+   /// ReapCompletion(). Returns false if the submission queue is full.
+   bool PrepareRead(const RReadEvent &readEvent, std::uint64_t userData) {
+      if (readEvent.fFileDes == -1)
+         throw std::runtime_error("bad fd (-1) for read request '" + std::to_string(userData) + "'");
+      if (readEvent.fBuffer == nullptr)
+         throw std::runtime_error("null read buffer for read request '" + std::to_string(userData) + "'");
+      struct io_uring_sqe *sqe = io_uring_get_sqe(&fRing);
+      if (!sqe)
+         return false;
+      io_uring_prep_read(sqe, readEvent.fFileDes, readEvent.fBuffer, readEvent.fSize, readEvent.fOffset);
+      sqe->flags |= IOSQE_ASYNC; // maximize read event throughput
+      sqe->user_data = userData;
+      return true;
+   }
+
+   /// Submit the queued events without waiting for their completion. Returns the number of submitted events.
+   unsigned int Submit() {
+      int submitted = io_uring_submit(&fRing);
+      if (submitted < 0) {
+         throw std::runtime_error("ring submit failed, error: " + std::string(std::strerror(-submitted)));
+      }
+      return static_cast<unsigned int>(submitted);
+   }
+
+   /// Retrieve the next completed event. Sets the event's user data and its result, i.e. the number of read
+   /// bytes or a negative error code. If wait is false, returns false if no event has completed yet.
+   bool ReapCompletion(bool wait, std::uint64_t &userData, int &result) {
+      struct io_uring_cqe *cqe;
+      int ret;
+      do {
+         ret = wait ? io_uring_wait_cqe(&fRing, &cqe) : io_uring_peek_cqe(&fRing, &cqe);
+      } while (ret == -EINTR);
+      if (!wait && (ret == -EAGAIN))
+         return false;
+      if (ret < 0) {
+         throw std::runtime_error("wait cqe failed, error: " + std::string(std::strerror(-ret)));
+      }
+      userData = cqe->user_data;
+      result = cqe->res;
+      io_uring_cqe_seen(&fRing, cqe);
+      return true;
+   }
+
    /// Submit a number of read events and wait for completion. Events are submitted in batches if
    /// the number of events is larger than the submission queue depth.
    void SubmitReadsAndWait(RReadEvent* readEvents, unsigned int nReads) {
@@ -79,6 +79,9 @@ public:
       std::size_t fOutBytes = 0;
    };
 
+   /// Identifies a vector read started by ReadVAsync()
+   using ReadVHandle_t = std::uint64_t;
+
 private:
    /// Don't change without adapting ReadAt()
    static constexpr unsigned int kNumBlockBuffers = 2;
@@ -108,6 +111,8 @@ private:
    std::uint64_t fFileSize;
    /// Files are opened lazily and only when required; the open state is kept by this flag
    bool fIsOpen;
+   /// Used by the default implementation of ReadVAsyncImpl(), which completes the requests immediately
+   ReadVHandle_t fNextReadVHandle = 0;
 
 protected:
    std::string fUrl;
@@ -137,6 +142,13 @@ protected:
 
    /// By default implemented as a loop of ReadAt calls but can be overwritten, e.g. XRootD or DAVIX implementations
    virtual void ReadVImpl(RIOVec *ioVec, unsigned int nReq);
+   /// By default, the requests are served synchronously by ReadVImpl() and the returned handle is already complete.
+   /// Derived classes that set kFeatureHasAsyncIo queue the requests and return immediately.
+   virtual ReadVHandle_t ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq);
+   /// Must not block; the default implementation returns true
+   virtual bool IsReadVDoneImpl(ReadVHandle_t handle);
+   /// Blocks until all the requests of the handle are served; the default implementation returns immediately
+   virtual void WaitReadVImpl(ReadVHandle_t handle);
 
 public:
    RRawFile(std::string_view url, ROptions options);
@@ -172,6 +184,15 @@ public:
 
    /// Opens the file if necessary and calls ReadVImpl
    void ReadV(RIOVec *ioVec, unsigned int nReq);
+   /// Opens the file if necessary and starts reading the requests without waiting for the data.  The ioVec array and
+   /// the buffers it points to must remain valid until WaitReadV() returns for the returned handle.  Every handle
+   /// must eventually be passed to WaitReadV(), which sets the fOutBytes members.  If the file does not support
+   /// asynchronous I/O, the requests are served before ReadVAsync() returns.
+   ReadVHandle_t ReadVAsync(RIOVec *ioVec, unsigned int nReq);
+   /// Returns true if WaitReadV() would not block for the given handle
+   bool IsReadVDone(ReadVHandle_t handle) { return IsReadVDoneImpl(handle); }
+   /// Blocks until all the requests of the given handle are served.  Throws an exception if any of the reads failed.
+   void WaitReadV(ReadVHandle_t handle) { WaitReadVImpl(handle); }
 
    /// Memory mapping according to POSIX standard; in particular, new mappings of the same range replace older ones.
    /// Mappings need to be aligned at page boundaries, therefore the real offset can be smaller than the desired value.
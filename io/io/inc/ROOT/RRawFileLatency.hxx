@@ -0,0 +1,61 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RRawFileLatency
+#define ROOT_RRawFileLatency
+
+#include <ROOT/RRawFile.hxx>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ * \class RRawFileLatency RRawFileLatency.hxx
+ * \ingroup IO
+ *
+ * The RRawFileLatency class wraps another RRawFile and adds a fixed delay to every round trip to the underlying
+ * file, i.e. to every ReadAt() call and once per ReadV() call. It emulates the behavior of a high-latency remote
+ * file from a local file and can be used to evaluate the impact of read coalescing and vector reads. Reads are
+ * not buffered by the wrapper; buffering, if any, is left to the inner file.
+ */
+class RRawFileLatency : public RRawFile {
+private:
+   std::unique_ptr<RRawFile> fInner;
+   std::chrono::microseconds fLatency;
+   /// Number of emulated round trips, i.e. the number of calls to ReadAtImpl() and ReadVImpl()
+   std::uint64_t fNRoundTrips = 0;
+
+   void EmulateRoundTrip();
+
+protected:
+   void OpenImpl() final;
+   size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
+   void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   std::uint64_t GetSizeImpl() final;
+
+public:
+   RRawFileLatency(std::unique_ptr<RRawFile> inner, std::chrono::microseconds latency);
+   ~RRawFileLatency() = default;
+   std::unique_ptr<RRawFile> Clone() const final;
+   int GetFeatures() const final;
+
+   std::chrono::microseconds GetLatency() const { return fLatency; }
+   std::uint64_t GetNRoundTrips() const { return fNRoundTrips; }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
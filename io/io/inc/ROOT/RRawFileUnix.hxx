@@ -17,6 +17,8 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 
 namespace ROOT {
 namespace Internal {
@@ -27,15 +29,31 @@ namespace Internal {
  *
  * The RRawFileUnix class uses POSIX calls to read from a mounted file system. Thus the path name can refer,
  * for instance, to a named pipe instead of a regular file.
+ *
+ * If ROOT is built with io_uring support, vector reads are served by an io_uring instance that is set up on the
+ * first vector read and kept for the lifetime of the file. In this case, ReadVAsync() returns as soon as the
+ * requests are submitted. If the ring cannot be set up, vector reads fall back to blocking pread() calls.
  */
 class RRawFileUnix : public RRawFile {
 private:
+   /// The io_uring instance and the bookkeeping of the outstanding vector reads
+   struct RIoUringState;
+
    int fFileDes;
+   std::unique_ptr<RIoUringState> fIoUringState;
+   /// Guards the lazy setup of fIoUringState
+   std::once_flag fIoUringOnce;
+
+   /// Sets up the ring on the first call; returns nullptr if io_uring is not available
+   RIoUringState *GetIoUringState();
 
 protected:
    void OpenImpl() final;
    size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
    void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   ReadVHandle_t ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq) final;
+   bool IsReadVDoneImpl(ReadVHandle_t handle) final;
+   void WaitReadVImpl(ReadVHandle_t handle) final;
    std::uint64_t GetSizeImpl() final;
    void *MapImpl(size_t nbytes, std::uint64_t offset, std::uint64_t &mapdOffset) final;
    void UnmapImpl(void *region, size_t nbytes) final;
@@ -113,6 +113,10 @@ protected:
    TList           *fInfoCache{nullptr};      ///<!Cached list of the streamer infos in this file
    TList           *fOpenPhases{nullptr};     ///<!Time info about open phases
 
+   std::atomic<Long64_t> fConcurrentBytesRead{0};      ///<!Number of bytes read by the concurrent positional reads
+   std::atomic<Long64_t> fConcurrentBytesReadExtra{0}; ///<!Number of extra bytes read ahead by the concurrent positional reads
+   std::atomic<Int_t>    fConcurrentReadCalls{0};      ///<!Number of concurrent positional read calls
+
 #ifdef R__USE_IMT
    std::mutex                                 fWriteMutex;  ///<!Lock for writing baskets / keys into the file.
    static ROOT::Internal::RConcurrentHashColl fgTsSIHashes; ///<!TS Set of hashes built from read streamer infos
@@ -137,6 +141,7 @@ protected:
    virtual void        Init(Bool_t create);
            Bool_t      FlushWriteCache();
            Int_t       ReadBufferViaCache(char *buf, Int_t len);
+           Bool_t      ReadBufferAt(char *buf, Long64_t pos, Int_t len);
            Int_t       WriteBufferViaCache(const char *buf, Int_t len);
 
    ////////////////////////////////////////////////////////////////////////////////
@@ -157,6 +162,7 @@ protected:
    virtual Int_t       SysOpen(const char *pathname, Int_t flags, UInt_t mode);
    virtual Int_t       SysClose(Int_t fd);
    virtual Int_t       SysRead(Int_t fd, void *buf, Int_t len);
+           Int_t       SysReadAt(Int_t fd, void *buf, Int_t len, Long64_t offset);
    virtual Int_t       SysWrite(Int_t fd, const void *buf, Int_t len);
    virtual Long64_t    SysSeek(Int_t fd, Long64_t offset, Int_t whence);
    virtual Int_t       SysStat(Int_t fd, Long_t *id, Long64_t *size, Long_t *flags, Long_t *modtime);
@@ -186,7 +192,8 @@ public:
       kWriteError    = BIT(14),
       kBinaryFile    = BIT(15),
       kRedirected    = BIT(16),
-      kReproducible  = BIT(17)
+      kReproducible  = BIT(17),
+      kConcurrentRead = BIT(18)
    };
    enum ERelativeTo { kBeg = 0, kCur = 1, kEnd = 2 };
    enum { kStartBigFile  = 2000000000 };
@@ -230,10 +237,10 @@ public:
    virtual Int_t       GetNfree() const { return fFree->GetSize(); }
    virtual Int_t       GetNProcessIDs() const { return fNProcessIDs; }
            Option_t   *GetOption() const override { return fOption.Data(); }
-   virtual Long64_t    GetBytesRead() const { return fBytesRead; }
-   virtual Long64_t    GetBytesReadExtra() const { return fBytesReadExtra; }
+   virtual Long64_t    GetBytesRead() const { return fBytesRead + fConcurrentBytesRead; }
+   virtual Long64_t    GetBytesReadExtra() const { return fBytesReadExtra + fConcurrentBytesReadExtra; }
    virtual Long64_t    GetBytesWritten() const;
-   virtual Int_t       GetReadCalls() const { return fReadCalls; }
+   virtual Int_t       GetReadCalls() const { return fReadCalls + fConcurrentReadCalls; }
            Int_t       GetVersion() const { return fVersion; }
            Int_t       GetRecordHeader(char *buf, Long64_t first, Int_t maxbytes,
                                        Int_t &nbytes, Int_t &objlen, Int_t &keylen);
@@ -249,6 +256,7 @@ public:
    virtual void        IncrementProcessIDs() { fNProcessIDs++; }
    virtual Bool_t      IsArchive() const { return fIsArchive; }
            Bool_t      IsBinary() const { return TestBit(kBinaryFile); }
+           Bool_t      IsConcurrentRead() const;
            Bool_t      IsRaw() const { return !fIsRootFile; }
    virtual Bool_t      IsOpen() const;
            void        ls(Option_t *option="") const override;
@@ -279,7 +287,7 @@ public:
    virtual void        SetEND(Long64_t last) { fEND = last; }
    virtual void        SetOffset(Long64_t offset, ERelativeTo pos = kBeg);
    virtual void        SetOption(Option_t *option=">") { fOption = option; }
-   virtual void        SetReadCalls(Int_t readcalls = 0) { fReadCalls = readcalls; }
+   virtual void        SetReadCalls(Int_t readcalls = 0) { fReadCalls = readcalls; fConcurrentReadCalls = 0; }
    virtual void        ShowStreamerInfo();
            Int_t       Sizeof() const override;
            void        SumBuffer(Int_t bufsize);
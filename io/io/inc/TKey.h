@@ -55,6 +55,7 @@ protected:
    virtual void     Create(Int_t nbytes, TFile* f = 0);
            void     Build(TDirectory* motherDir, const char* classname, Long64_t filepos);
            void     Reset(); // Currently only for the use of TBasket.
+           Bool_t   ReadFileToBuffer(char *buffer) const;
    virtual Int_t    WriteFileKeepBuffer(TFile *f = 0);
 
 
@@ -0,0 +1,435 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "RBufferKernels.hxx"
+
+#include "Bytes.h"
+
+#include <cstdlib>
+#include <cstring>
+
+// The vectorized kernels rely on the function multi-versioning of GCC and clang.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && defined(R__BYTESWAP)
+#define R__BUFFERKERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+
+enum class EInstructionSet { kScalar, kSSSE3, kAVX2 };
+
+EInstructionSet DetectInstructionSet()
+{
+   auto maxSet = EInstructionSet::kAVX2;
+   if (const char *env = std::getenv("ROOT_IO_KERNELS")) {
+      if (!strcmp(env, "scalar"))
+         maxSet = EInstructionSet::kScalar;
+      else if (!strcmp(env, "ssse3"))
+         maxSet = EInstructionSet::kSSSE3;
+   }
+#ifdef R__BUFFERKERNELS_X86
+   __builtin_cpu_init();
+   if (maxSet >= EInstructionSet::kAVX2 && __builtin_cpu_supports("avx2"))
+      return EInstructionSet::kAVX2;
+   if (maxSet >= EInstructionSet::kSSSE3 && __builtin_cpu_supports("ssse3"))
+      return EInstructionSet::kSSSE3;
+#endif
+   return EInstructionSet::kScalar;
+}
+
+EInstructionSet GetActiveInstructionSet()
+{
+   static const EInstructionSet set = DetectInstructionSet();
+   return set;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Scalar kernels, also used for the last elements of the vectorized ones.
+
+template <typename T>
+void FromBigEndianScalar(void *to, const char *from, std::size_t n)
+{
+   char *buf = const_cast<char *>(from);
+   T *out = static_cast<T *>(to);
+   for (std::size_t i = 0; i < n; ++i)
+      frombuf(buf, &out[i]);
+}
+
+void FloatToDoubleScalar(Double_t *to, const char *from, std::size_t n)
+{
+   char *buf = const_cast<char *>(from);
+   Float_t afloat;
+   for (std::size_t i = 0; i < n; ++i) {
+      frombuf(buf, &afloat);
+      to[i] = (Double_t)afloat;
+   }
+}
+
+template <typename T>
+void ExpandTruncatedScalar(T *to, const char *from, std::size_t n, Int_t nbits)
+{
+   char *buf = const_cast<char *>(from);
+   union {
+      Float_t fFloatValue;
+      Int_t   fIntValue;
+   };
+   UChar_t  theExp;
+   UShort_t theMan;
+   for (std::size_t i = 0; i < n; ++i) {
+      frombuf(buf, &theExp);
+      frombuf(buf, &theMan);
+      fIntValue = theExp;
+      fIntValue <<= 23;
+      fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
+      if (1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
+      to[i] = (T)fFloatValue;
+   }
+}
+
+template <typename T>
+void ExpandScaledScalar(T *to, const char *from, std::size_t n, Double_t factor, Double_t minvalue)
+{
+   char *buf = const_cast<char *>(from);
+   UInt_t aint;
+   for (std::size_t i = 0; i < n; ++i) {
+      frombuf(buf, &aint);
+      to[i] = (T)(aint/factor + minvalue);
+   }
+}
+
+#ifdef R__BUFFERKERNELS_X86
+
+////////////////////////////////////////////////////////////////////////////////
+// Vectorized kernels. They give bitwise the same results as the scalar ones.
+
+/// Shuffle mask reversing the bytes of each Size-byte element of a 16-byte vector.
+template <int Size>
+__m128i ByteSwapMask()
+{
+   alignas(16) char mask[16];
+   for (int i = 0; i < 16; ++i)
+      mask[i] = (i / Size) * Size + (Size - 1 - i % Size);
+   return _mm_load_si128(reinterpret_cast<const __m128i *>(mask));
+}
+
+/// Shuffle mask spreading 4 packed truncated floats (exponent, then big-endian mantissa) over 32-bit lanes
+/// holding `mantissa | exponent << 16`.
+__m128i TruncatedMask()
+{
+   return _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+}
+
+template <typename T>
+__attribute__((target("ssse3"))) void FromBigEndianSSSE3(void *to, const char *from, std::size_t n)
+{
+   constexpr std::size_t kPerVector = 16 / sizeof(T);
+   const __m128i mask = ByteSwapMask<sizeof(T)>();
+   char *out = static_cast<char *>(to);
+   std::size_t i = 0;
+   for (; i + kPerVector <= n; i += kPerVector) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + i * sizeof(T)));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i * sizeof(T)), _mm_shuffle_epi8(v, mask));
+   }
+   FromBigEndianScalar<T>(out + i * sizeof(T), from + i * sizeof(T), n - i);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) void FromBigEndianAVX2(void *to, const char *from, std::size_t n)
+{
+   constexpr std::size_t kPerVector = 32 / sizeof(T);
+   const __m256i mask = _mm256_broadcastsi128_si256(ByteSwapMask<sizeof(T)>());
+   char *out = static_cast<char *>(to);
+   std::size_t i = 0;
+   for (; i + kPerVector <= n; i += kPerVector) {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from + i * sizeof(T)));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i * sizeof(T)), _mm256_shuffle_epi8(v, mask));
+   }
+   FromBigEndianSSSE3<T>(out + i * sizeof(T), from + i * sizeof(T), n - i);
+}
+
+__attribute__((target("ssse3"))) void FloatToDoubleSSSE3(Double_t *to, const char *from, std::size_t n)
+{
+   const __m128i mask = ByteSwapMask<4>();
+   std::size_t i = 0;
+   for (; i + 4 <= n; i += 4) {
+      const __m128i v = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(from + 4 * i)), mask);
+      const __m128 f = _mm_castsi128_ps(v);
+      _mm_storeu_pd(to + i, _mm_cvtps_pd(f));
+      _mm_storeu_pd(to + i + 2, _mm_cvtps_pd(_mm_movehl_ps(f, f)));
+   }
+   FloatToDoubleScalar(to + i, from + 4 * i, n - i);
+}
+
+__attribute__((target("avx2"))) void FloatToDoubleAVX2(Double_t *to, const char *from, std::size_t n)
+{
+   const __m256i mask = _mm256_broadcastsi128_si256(ByteSwapMask<4>());
+   std::size_t i = 0;
+   for (; i + 8 <= n; i += 8) {
+      const __m256i v = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(from + 4 * i)), mask);
+      const __m256 f = _mm256_castsi256_ps(v);
+      _mm256_storeu_pd(to + i, _mm256_cvtps_pd(_mm256_castps256_ps128(f)));
+      _mm256_storeu_pd(to + i + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(f, 1)));
+   }
+   FloatToDoubleSSSE3(to + i, from + 4 * i, n - i);
+}
+
+/// Rebuild the bit patterns of 4 truncated floats spread over 32-bit lanes by TruncatedMask().
+__attribute__((target("ssse3"))) __m128i
+DecodeTruncatedSSSE3(__m128i v, __m128i manMask, __m128i manShift, __m128i signShift)
+{
+   const __m128i man = _mm_and_si128(v, _mm_set1_epi32(0xFFFF));
+   const __m128i exp = _mm_srli_epi32(v, 16);
+   const __m128i bits = _mm_or_si128(_mm_slli_epi32(exp, 23), _mm_sll_epi32(_mm_and_si128(man, manMask), manShift));
+   return _mm_or_si128(bits, _mm_slli_epi32(_mm_srl_epi32(man, signShift), 31));
+}
+
+__attribute__((target("avx2"))) __m256i
+DecodeTruncatedAVX2(__m256i v, __m256i manMask, __m128i manShift, __m128i signShift)
+{
+   const __m256i man = _mm256_and_si256(v, _mm256_set1_epi32(0xFFFF));
+   const __m256i exp = _mm256_srli_epi32(v, 16);
+   const __m256i bits =
+      _mm256_or_si256(_mm256_slli_epi32(exp, 23), _mm256_sll_epi32(_mm256_and_si256(man, manMask), manShift));
+   return _mm256_or_si256(bits, _mm256_slli_epi32(_mm256_srl_epi32(man, signShift), 31));
+}
+
+/// Store 4 floats as T.
+__attribute__((target("ssse3"))) inline void StoreSSSE3(Float_t *to, __m128 f)
+{
+   _mm_storeu_ps(to, f);
+}
+
+__attribute__((target("ssse3"))) inline void StoreSSSE3(Double_t *to, __m128 f)
+{
+   _mm_storeu_pd(to, _mm_cvtps_pd(f));
+   _mm_storeu_pd(to + 2, _mm_cvtps_pd(_mm_movehl_ps(f, f)));
+}
+
+/// Store 8 floats as T.
+__attribute__((target("avx2"))) inline void StoreAVX2(Float_t *to, __m256 f)
+{
+   _mm256_storeu_ps(to, f);
+}
+
+__attribute__((target("avx2"))) inline void StoreAVX2(Double_t *to, __m256 f)
+{
+   _mm256_storeu_pd(to, _mm256_cvtps_pd(_mm256_castps256_ps128(f)));
+   _mm256_storeu_pd(to + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(f, 1)));
+}
+
+template <typename T>
+__attribute__((target("ssse3"))) void ExpandTruncatedSSSE3(T *to, const char *from, std::size_t n, Int_t nbits)
+{
+   const __m128i mask = TruncatedMask();
+   const __m128i manMask = _mm_set1_epi32((1 << (nbits + 1)) - 1);
+   const __m128i manShift = _mm_cvtsi32_si128(23 - nbits);
+   const __m128i signShift = _mm_cvtsi32_si128(nbits + 1);
+   std::size_t i = 0;
+   // 4 elements are 12 bytes, but 16 bytes are loaded.
+   for (; i + 6 <= n; i += 4) {
+      const __m128i v = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(from + 3 * i)), mask);
+      StoreSSSE3(to + i, _mm_castsi128_ps(DecodeTruncatedSSSE3(v, manMask, manShift, signShift)));
+   }
+   ExpandTruncatedScalar(to + i, from + 3 * i, n - i, nbits);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) void ExpandTruncatedAVX2(T *to, const char *from, std::size_t n, Int_t nbits)
+{
+   const __m256i mask = _mm256_broadcastsi128_si256(TruncatedMask());
+   const __m256i manMask = _mm256_set1_epi32((1 << (nbits + 1)) - 1);
+   const __m128i manShift = _mm_cvtsi32_si128(23 - nbits);
+   const __m128i signShift = _mm_cvtsi32_si128(nbits + 1);
+   std::size_t i = 0;
+   // 8 elements are 24 bytes, loaded as two (overlapping) 16-byte halves ending at byte 28.
+   for (; i + 10 <= n; i += 8) {
+      const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + 3 * i));
+      const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + 3 * i + 12));
+      const __m256i v = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1), mask);
+      StoreAVX2(to + i, _mm256_castsi256_ps(DecodeTruncatedAVX2(v, manMask, manShift, signShift)));
+   }
+   ExpandTruncatedSSSE3(to + i, from + 3 * i, n - i, nbits);
+}
+
+/// Store 2 doubles as T.
+__attribute__((target("ssse3"))) inline void StorePairSSSE3(Float_t *to, __m128d d)
+{
+   _mm_storel_pi(reinterpret_cast<__m64 *>(to), _mm_cvtpd_ps(d));
+}
+
+__attribute__((target("ssse3"))) inline void StorePairSSSE3(Double_t *to, __m128d d)
+{
+   _mm_storeu_pd(to, d);
+}
+
+/// Store 4 doubles as T.
+__attribute__((target("avx2"))) inline void StoreQuadAVX2(Float_t *to, __m256d d)
+{
+   _mm_storeu_ps(to, _mm256_cvtpd_ps(d));
+}
+
+__attribute__((target("avx2"))) inline void StoreQuadAVX2(Double_t *to, __m256d d)
+{
+   _mm256_storeu_pd(to, d);
+}
+
+// The unsigned integers are converted exactly to double by offsetting them into the range of the signed ones.
+// Then, as in the scalar version, they are divided (not multiplied by the inverse) by the factor.
+
+template <typename T>
+__attribute__((target("ssse3"))) void
+ExpandScaledSSSE3(T *to, const char *from, std::size_t n, Double_t factor, Double_t minvalue)
+{
+   const __m128i mask = ByteSwapMask<4>();
+   const __m128i signBit = _mm_set1_epi32(0x80000000);
+   const __m128d offset = _mm_set1_pd(2147483648.);
+   const __m128d vfactor = _mm_set1_pd(factor);
+   const __m128d vmin = _mm_set1_pd(minvalue);
+   std::size_t i = 0;
+   for (; i + 4 <= n; i += 4) {
+      __m128i v = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(from + 4 * i)), mask);
+      v = _mm_xor_si128(v, signBit);
+      const __m128d lo = _mm_add_pd(_mm_cvtepi32_pd(v), offset);
+      const __m128d hi = _mm_add_pd(_mm_cvtepi32_pd(_mm_srli_si128(v, 8)), offset);
+      StorePairSSSE3(to + i, _mm_add_pd(_mm_div_pd(lo, vfactor), vmin));
+      StorePairSSSE3(to + i + 2, _mm_add_pd(_mm_div_pd(hi, vfactor), vmin));
+   }
+   ExpandScaledScalar(to + i, from + 4 * i, n - i, factor, minvalue);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) void
+ExpandScaledAVX2(T *to, const char *from, std::size_t n, Double_t factor, Double_t minvalue)
+{
+   const __m128i mask = ByteSwapMask<4>();
+   const __m128i signBit = _mm_set1_epi32(0x80000000);
+   const __m256d offset = _mm256_set1_pd(2147483648.);
+   const __m256d vfactor = _mm256_set1_pd(factor);
+   const __m256d vmin = _mm256_set1_pd(minvalue);
+   std::size_t i = 0;
+   for (; i + 4 <= n; i += 4) {
+      __m128i v = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(from + 4 * i)), mask);
+      v = _mm_xor_si128(v, signBit);
+      const __m256d d = _mm256_add_pd(_mm256_cvtepi32_pd(v), offset);
+      StoreQuadAVX2(to + i, _mm256_add_pd(_mm256_div_pd(d, vfactor), vmin));
+   }
+   ExpandScaledScalar(to + i, from + 4 * i, n - i, factor, minvalue);
+}
+
+#endif // R__BUFFERKERNELS_X86
+
+template <typename T>
+void FromBigEndian(void *to, const char *from, std::size_t n)
+{
+#ifdef R__BUFFERKERNELS_X86
+   switch (GetActiveInstructionSet()) {
+   case EInstructionSet::kAVX2: FromBigEndianAVX2<T>(to, from, n); return;
+   case EInstructionSet::kSSSE3: FromBigEndianSSSE3<T>(to, from, n); return;
+   case EInstructionSet::kScalar: break;
+   }
+#endif
+   FromBigEndianScalar<T>(to, from, n);
+}
+
+template <typename T>
+void ExpandTruncatedImpl(T *to, const char *from, std::size_t n, Int_t nbits)
+{
+#ifdef R__BUFFERKERNELS_X86
+   // Beyond 23 bits, the shifts of the scalar version are not defined: leave it to the compiler.
+   if (nbits >= 0 && nbits <= 23) {
+      switch (GetActiveInstructionSet()) {
+      case EInstructionSet::kAVX2: ExpandTruncatedAVX2(to, from, n, nbits); return;
+      case EInstructionSet::kSSSE3: ExpandTruncatedSSSE3(to, from, n, nbits); return;
+      case EInstructionSet::kScalar: break;
+      }
+   }
+#endif
+   ExpandTruncatedScalar(to, from, n, nbits);
+}
+
+template <typename T>
+void ExpandScaledImpl(T *to, const char *from, std::size_t n, Double_t factor, Double_t minvalue)
+{
+#ifdef R__BUFFERKERNELS_X86
+   switch (GetActiveInstructionSet()) {
+   case EInstructionSet::kAVX2: ExpandScaledAVX2(to, from, n, factor, minvalue); return;
+   case EInstructionSet::kSSSE3: ExpandScaledSSSE3(to, from, n, factor, minvalue); return;
+   case EInstructionSet::kScalar: break;
+   }
+#endif
+   ExpandScaledScalar(to, from, n, factor, minvalue);
+}
+
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace BufferKernels {
+
+void FromBigEndian16(void *to, const char *from, std::size_t n)
+{
+   FromBigEndian<UShort_t>(to, from, n);
+}
+
+void FromBigEndian32(void *to, const char *from, std::size_t n)
+{
+   FromBigEndian<UInt_t>(to, from, n);
+}
+
+void FromBigEndian64(void *to, const char *from, std::size_t n)
+{
+   FromBigEndian<ULong64_t>(to, from, n);
+}
+
+void FloatToDouble(Double_t *to, const char *from, std::size_t n)
+{
+#ifdef R__BUFFERKERNELS_X86
+   switch (GetActiveInstructionSet()) {
+   case EInstructionSet::kAVX2: FloatToDoubleAVX2(to, from, n); return;
+   case EInstructionSet::kSSSE3: FloatToDoubleSSSE3(to, from, n); return;
+   case EInstructionSet::kScalar: break;
+   }
+#endif
+   FloatToDoubleScalar(to, from, n);
+}
+
+void ExpandTruncated(Float_t *to, const char *from, std::size_t n, Int_t nbits)
+{
+   ExpandTruncatedImpl(to, from, n, nbits);
+}
+
+void ExpandTruncated(Double_t *to, const char *from, std::size_t n, Int_t nbits)
+{
+   ExpandTruncatedImpl(to, from, n, nbits);
+}
+
+void ExpandScaled(Float_t *to, const char *from, std::size_t n, Double_t factor, Double_t minvalue)
+{
+   ExpandScaledImpl(to, from, n, factor, minvalue);
+}
+
+void ExpandScaled(Double_t *to, const char *from, std::size_t n, Double_t factor, Double_t minvalue)
+{
+   ExpandScaledImpl(to, from, n, factor, minvalue);
+}
+
+const char *GetInstructionSet()
+{
+   switch (GetActiveInstructionSet()) {
+   case EInstructionSet::kAVX2: return "avx2";
+   case EInstructionSet::kSSSE3: return "ssse3";
+   case EInstructionSet::kScalar: break;
+   }
+   return "scalar";
+}
+
+} // namespace BufferKernels
+} // namespace Internal
+} // namespace ROOT
@@ -0,0 +1,64 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RBufferKernels
+#define ROOT_RBufferKernels
+
+#include "RtypesCore.h"
+
+#include <cstddef>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+\namespace ROOT::Internal::BufferKernels
+\ingroup IO
+\brief Decoding of the arrays of fundamental types read by TBufferFile.
+
+The values are stored in big-endian byte order in the buffers. On x86-64, vectorized (SSSE3 or AVX2) versions of
+the kernels are selected at run time according to the instruction sets supported by the CPU. Elsewhere, and for the
+last elements of the arrays, they fall back to the scalar frombuf() conversions.
+
+The environment variable ROOT_IO_KERNELS, set to "scalar" or "ssse3", restricts the instruction sets that are used,
+for instance to compare the performance of the different versions.
+*/
+namespace BufferKernels {
+
+/// Copy n 2-byte big-endian values from `from` to `to`, converting them to the byte order of the host.
+void FromBigEndian16(void *to, const char *from, std::size_t n);
+/// Copy n 4-byte big-endian values from `from` to `to`, converting them to the byte order of the host.
+void FromBigEndian32(void *to, const char *from, std::size_t n);
+/// Copy n 8-byte big-endian values from `from` to `to`, converting them to the byte order of the host.
+void FromBigEndian64(void *to, const char *from, std::size_t n);
+
+/// Read n big-endian floats and convert them to double (Double32_t without range nor number of bits).
+void FloatToDouble(Double_t *to, const char *from, std::size_t n);
+
+/// Rebuild n floats stored as an exponent and a truncated mantissa of nbits bits, 3 bytes each.
+/// See TBufferFile::WriteFloat16.
+void ExpandTruncated(Float_t *to, const char *from, std::size_t n, Int_t nbits);
+/// Rebuild n doubles stored as an exponent and a truncated mantissa of nbits bits, 3 bytes each.
+/// See TBufferFile::WriteDouble32.
+void ExpandTruncated(Double_t *to, const char *from, std::size_t n, Int_t nbits);
+
+/// Rebuild n floats stored as big-endian unsigned integers in a range, as `integer / factor + minvalue`.
+void ExpandScaled(Float_t *to, const char *from, std::size_t n, Double_t factor, Double_t minvalue);
+/// Rebuild n doubles stored as big-endian unsigned integers in a range, as `integer / factor + minvalue`.
+void ExpandScaled(Double_t *to, const char *from, std::size_t n, Double_t factor, Double_t minvalue);
+
+/// Return the name of the instruction set used by the kernels: "avx2", "ssse3" or "scalar".
+const char *GetInstructionSet();
+
+} // namespace BufferKernels
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -105,6 +105,19 @@ void ROOT::Internal::RRawFile::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
    }
 }
 
+ROOT::Internal::RRawFile::ReadVHandle_t ROOT::Internal::RRawFile::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   ReadVImpl(ioVec, nReq);
+   return fNextReadVHandle++;
+}
+
+bool ROOT::Internal::RRawFile::IsReadVDoneImpl(ReadVHandle_t /* handle */)
+{
+   return true;
+}
+
+void ROOT::Internal::RRawFile::WaitReadVImpl(ReadVHandle_t /* handle */) {}
+
 void ROOT::Internal::RRawFile::UnmapImpl(void * /* region */, size_t /* nbytes */)
 {
    throw std::runtime_error("Memory mapping unsupported");
@@ -212,6 +225,14 @@ void ROOT::Internal::RRawFile::ReadV(RIOVec *ioVec, unsigned int nReq)
    ReadVImpl(ioVec, nReq);
 }
 
+ROOT::Internal::RRawFile::ReadVHandle_t ROOT::Internal::RRawFile::ReadVAsync(RIOVec *ioVec, unsigned int nReq)
+{
+   if (!fIsOpen)
+      OpenImpl();
+   fIsOpen = true;
+   return ReadVAsyncImpl(ioVec, nReq);
+}
+
 bool ROOT::Internal::RRawFile::Readln(std::string &line)
 {
    if (fOptions.fLineBreak == ELineBreaks::kAuto) {
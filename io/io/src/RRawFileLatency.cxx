@@ -0,0 +1,69 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RRawFileLatency.hxx>
+
+#include <thread>
+#include <utility>
+
+namespace {
+ROOT::Internal::RRawFile::ROptions MakeUnbufferedOptions()
+{
+   ROOT::Internal::RRawFile::ROptions options;
+   options.fBlockSize = 0;
+   return options;
+}
+} // anonymous namespace
+
+ROOT::Internal::RRawFileLatency::RRawFileLatency(std::unique_ptr<RRawFile> inner, std::chrono::microseconds latency)
+   : RRawFile(inner->GetUrl(), MakeUnbufferedOptions()), fInner(std::move(inner)), fLatency(latency)
+{
+}
+
+std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileLatency::Clone() const
+{
+   return std::make_unique<RRawFileLatency>(fInner->Clone(), fLatency);
+}
+
+int ROOT::Internal::RRawFileLatency::GetFeatures() const
+{
+   // Memory mapping would bypass the emulated latency
+   return fInner->GetFeatures() & ~kFeatureHasMmap;
+}
+
+void ROOT::Internal::RRawFileLatency::EmulateRoundTrip()
+{
+   fNRoundTrips++;
+   if (fLatency.count() > 0)
+      std::this_thread::sleep_for(fLatency);
+}
+
+void ROOT::Internal::RRawFileLatency::OpenImpl()
+{
+   fOptions.fBlockSize = 0;
+}
+
+size_t ROOT::Internal::RRawFileLatency::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
+{
+   EmulateRoundTrip();
+   return fInner->ReadAt(buffer, nbytes, offset);
+}
+
+void ROOT::Internal::RRawFileLatency::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   // A vector read is a single round trip, as it is for remote protocols that support vector reads natively
+   EmulateRoundTrip();
+   fInner->ReadV(ioVec, nReq);
+}
+
+std::uint64_t ROOT::Internal::RRawFileLatency::GetSizeImpl()
+{
+   return fInner->GetSize();
+}
@@ -19,10 +19,15 @@
 
 #include "TError.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cerrno>
 #include <cstring>
+#include <deque>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -35,6 +40,86 @@ namespace {
 constexpr int kDefaultBlockSize = 4096; // If fstat() does not provide a block size hint, use this value instead
 } // anonymous namespace
 
+#ifdef R__HAS_URING
+struct ROOT::Internal::RRawFileUnix::RIoUringState {
+   /// The outstanding reads of a single ReadVAsync() call
+   struct RRequest {
+      RIOVec *fIOVec = nullptr;
+      /// The number of reads that are queued or in flight
+      unsigned int fNPending = 0;
+      std::string fError;
+   };
+
+   RIoUring fRing; // throws std::runtime_error
+   /// Serializes the access to the ring from threads sharing the file
+   std::mutex fLock;
+   std::uint32_t fNextHandle = 0;
+   std::unordered_map<ReadVHandle_t, RRequest> fRequests;
+   /// Reads that did not fit into the submission queue yet, as pairs of handle and index into the ioVec array
+   std::deque<std::pair<ReadVHandle_t, unsigned int>> fBacklog;
+   /// Submitted reads whose completion has not been reaped yet
+   unsigned int fNInFlight = 0;
+   /// Prepared reads that the kernel did not consume yet; they are passed on with the next submission
+   unsigned int fNUnsubmitted = 0;
+
+   /// Passes the prepared reads to the kernel, which may consume only some of them
+   void Submit()
+   {
+      auto nSubmitted = std::min(fRing.Submit(), fNUnsubmitted);
+      fNInFlight += nSubmitted;
+      fNUnsubmitted -= nSubmitted;
+   }
+
+   /// Moves as many reads from the backlog to the kernel as the ring can hold
+   void SubmitBacklog(int fileDes)
+   {
+      while (!fBacklog.empty() && (fNInFlight + fNUnsubmitted < fRing.GetQueueDepth())) {
+         auto handle = fBacklog.front().first;
+         auto index = fBacklog.front().second;
+         const auto &ioVec = fRequests.at(handle).fIOVec[index];
+         RIoUring::RReadEvent ev;
+         ev.fBuffer = ioVec.fBuffer;
+         ev.fOffset = ioVec.fOffset;
+         ev.fSize = ioVec.fSize;
+         ev.fFileDes = fileDes;
+         if (!fRing.PrepareRead(ev, (handle << 32) | index))
+            break;
+         fBacklog.pop_front();
+         fNUnsubmitted++;
+      }
+      if (fNUnsubmitted > 0)
+         Submit();
+   }
+
+   /// Processes one completed read; returns false if wait is false and no read has completed
+   bool ReapCompletion(bool wait, int fileDes)
+   {
+      // Reads left over by a partial submission would otherwise never complete
+      if (fNUnsubmitted > 0)
+         Submit();
+      std::uint64_t userData;
+      int result;
+      if (!fRing.ReapCompletion(wait, userData, result))
+         return false;
+      fNInFlight--;
+      auto &request = fRequests.at(userData >> 32);
+      auto &ioVec = request.fIOVec[userData & 0xffffffff];
+      if (result < 0) {
+         request.fError = std::strerror(-result);
+         ioVec.fOutBytes = 0;
+      } else {
+         ioVec.fOutBytes = static_cast<std::size_t>(result);
+      }
+      request.fNPending--;
+      SubmitBacklog(fileDes);
+      return true;
+   }
+};
+#else
+struct ROOT::Internal::RRawFileUnix::RIoUringState {
+};
+#endif
+
 ROOT::Internal::RRawFileUnix::RRawFileUnix(std::string_view url, ROptions options)
    : RRawFile(url, options), fFileDes(-1)
 {
@@ -42,6 +127,13 @@ ROOT::Internal::RRawFileUnix::RRawFileUnix(std::string_view url, ROptions option
 
 ROOT::Internal::RRawFileUnix::~RRawFileUnix()
 {
+#ifdef R__HAS_URING
+   // The kernel must not write into the buffers of reads that were never waited for after the ring is gone
+   if (fIoUringState) {
+      while (fIoUringState->fNInFlight > 0)
+         fIoUringState->ReapCompletion(true /* wait */, fFileDes);
+   }
+#endif
    if (fFileDes >= 0)
       close(fFileDes);
 }
@@ -52,7 +144,34 @@ std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileUnix::Clone()
 }
 
 int ROOT::Internal::RRawFileUnix::GetFeatures() const {
+#ifdef R__HAS_URING
+   return kFeatureHasSize | kFeatureHasMmap | kFeatureHasAsyncIo;
+#else
    return kFeatureHasSize | kFeatureHasMmap;
+#endif
+}
+
+ROOT::Internal::RRawFileUnix::RIoUringState *ROOT::Internal::RRawFileUnix::GetIoUringState()
+{
+#ifdef R__HAS_URING
+   // The setup can fail temporarily, e.g. when the locked memory limit is reached, so it is attempted once per file.
+   // Only the first failure of the process is reported.
+   static std::atomic<bool> uring_warned{false};
+   // Several threads sharing the file may issue their first vector read at the same time
+   std::call_once(fIoUringOnce, [this]() {
+      try {
+         fIoUringState = std::make_unique<RIoUringState>();
+      }
+      catch(const std::runtime_error &e) {
+         if (!uring_warned.exchange(true)) {
+            Warning("RIoUring", "io_uring is unexpectedly not available because:\n%s", e.what());
+            Warning("RRawFileUnix",
+                 "io_uring setup failed, falling back to blocking I/O in ReadV");
+         }
+      }
+   });
+#endif
+   return fIoUringState.get();
 }
 
 std::uint64_t ROOT::Internal::RRawFileUnix::GetSizeImpl()
@@ -113,37 +232,69 @@ void ROOT::Internal::RRawFileUnix::OpenImpl()
 }
 
 void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   if (GetIoUringState()) {
+      WaitReadVImpl(ReadVAsyncImpl(ioVec, nReq));
+      return;
+   }
+   RRawFile::ReadVImpl(ioVec, nReq);
+}
+
+ROOT::Internal::RRawFile::ReadVHandle_t ROOT::Internal::RRawFileUnix::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
 {
 #ifdef R__HAS_URING
-   thread_local bool uring_failed = false;
-   if (!uring_failed) {
-      try {
-         RIoUring ring; // throws std::runtime_error
-         std::vector<RIoUring::RReadEvent> reads;
-         reads.reserve(nReq);
-         for (std::size_t i = 0; i < nReq; ++i) {
-            RIoUring::RReadEvent ev;
-            ev.fBuffer = ioVec[i].fBuffer;
-            ev.fOffset = ioVec[i].fOffset;
-            ev.fSize = ioVec[i].fSize;
-            ev.fFileDes = fFileDes;
-            reads.push_back(ev);
-         }
-         ring.SubmitReadsAndWait(reads.data(), nReq);
-         for (std::size_t i = 0; i < nReq; ++i) {
-            ioVec[i].fOutBytes = reads.at(i).fOutBytes;
-         }
-         return;
+   if (auto state = GetIoUringState()) {
+      std::lock_guard<std::mutex> guard(state->fLock);
+      ReadVHandle_t handle = state->fNextHandle++;
+      auto &request = state->fRequests[handle];
+      request.fIOVec = ioVec;
+      request.fNPending = nReq;
+      for (unsigned int i = 0; i < nReq; ++i)
+         state->fBacklog.emplace_back(handle, i);
+      state->SubmitBacklog(fFileDes);
+      return handle;
+   }
+#endif
+   return RRawFile::ReadVAsyncImpl(ioVec, nReq);
+}
+
+bool ROOT::Internal::RRawFileUnix::IsReadVDoneImpl(ReadVHandle_t handle)
+{
+#ifdef R__HAS_URING
+   if (auto state = GetIoUringState()) {
+      std::lock_guard<std::mutex> guard(state->fLock);
+      auto itr = state->fRequests.find(handle);
+      if (itr == state->fRequests.end())
+         return true;
+      while ((itr->second.fNPending > 0) && state->ReapCompletion(false /* wait */, fFileDes)) {
       }
-      catch(const std::runtime_error &e) {
-         Warning("RIoUring", "io_uring is unexpectedly not available because:\n%s", e.what());
-         Warning("RRawFileUnix",
-              "io_uring setup failed, falling back to blocking I/O in ReadV");
-         uring_failed = true;
+      return itr->second.fNPending == 0;
+   }
+#endif
+   return RRawFile::IsReadVDoneImpl(handle);
+}
+
+void ROOT::Internal::RRawFileUnix::WaitReadVImpl(ReadVHandle_t handle)
+{
+#ifdef R__HAS_URING
+   if (auto state = GetIoUringState()) {
+      std::string error;
+      {
+         std::lock_guard<std::mutex> guard(state->fLock);
+         auto itr = state->fRequests.find(handle);
+         if (itr == state->fRequests.end())
+            return;
+         while (itr->second.fNPending > 0)
+            state->ReapCompletion(true /* wait */, fFileDes);
+         error = itr->second.fError;
+         state->fRequests.erase(itr);
       }
+      if (!error.empty())
+         throw std::runtime_error("Cannot read from '" + fUrl + "', error: " + error);
+      return;
    }
 #endif
-   RRawFile::ReadVImpl(ioVec, nReq);
+   RRawFile::WaitReadVImpl(handle);
 }
 
 size_t ROOT::Internal::RRawFileUnix::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
@@ -34,6 +34,7 @@ The concrete implementation of TBuffer for writing/reading to/from a ROOT file o
 #include "TStreamerInfoActions.h"
 #include "TInterpreter.h"
 #include "TVirtualMutex.h"
+#include "RBufferKernels.hxx"
 
 #if (defined(__linux) || defined(__APPLE__)) && defined(__i386__) && \
      defined(__GNUC__)
@@ -761,13 +762,8 @@ Int_t TBufferFile::ReadArray(Short_t *&h)
    if (!h) h = new Short_t[n];
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(h, fBufCur, n);
+   ROOT::Internal::BufferKernels::FromBigEndian16(h, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
 #else
    memcpy(h, fBufCur, l);
    fBufCur += l;
@@ -794,13 +790,8 @@ Int_t TBufferFile::ReadArray(Int_t *&ii)
    if (!ii) ii = new Int_t[n];
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(ii, fBufCur, n);
+   ROOT::Internal::BufferKernels::FromBigEndian32(ii, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
 #else
    memcpy(ii, fBufCur, l);
    fBufCur += l;
@@ -853,8 +844,8 @@ Int_t TBufferFile::ReadArray(Long64_t *&ll)
    if (!ll) ll = new Long64_t[n];
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   ROOT::Internal::BufferKernels::FromBigEndian64(ll, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -881,13 +872,8 @@ Int_t TBufferFile::ReadArray(Float_t *&f)
    if (!f) f = new Float_t[n];
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(f, fBufCur, n);
+   ROOT::Internal::BufferKernels::FromBigEndian32(f, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
 #else
    memcpy(f, fBufCur, l);
    fBufCur += l;
@@ -914,8 +900,8 @@ Int_t TBufferFile::ReadArray(Double_t *&d)
    if (!d) d = new Double_t[n];
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   ROOT::Internal::BufferKernels::FromBigEndian64(d, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1034,13 +1020,8 @@ Int_t TBufferFile::ReadStaticArray(Short_t *h)
    if (!h) return 0;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(h, fBufCur, n);
+   ROOT::Internal::BufferKernels::FromBigEndian16(h, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
 #else
    memcpy(h, fBufCur, l);
    fBufCur += l;
@@ -1066,13 +1047,8 @@ Int_t TBufferFile::ReadStaticArray(Int_t *ii)
    if (!ii) return 0;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(ii, fBufCur, n);
-   fBufCur += sizeof(Int_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
+   ROOT::Internal::BufferKernels::FromBigEndian32(ii, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ii, fBufCur, l);
    fBufCur += l;
@@ -1123,8 +1099,8 @@ Int_t TBufferFile::ReadStaticArray(Long64_t *ll)
    if (!ll) return 0;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   ROOT::Internal::BufferKernels::FromBigEndian64(ll, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1150,13 +1126,8 @@ Int_t TBufferFile::ReadStaticArray(Float_t *f)
    if (!f) return 0;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(f, fBufCur, n);
-   fBufCur += sizeof(Float_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
+   ROOT::Internal::BufferKernels::FromBigEndian32(f, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(f, fBufCur, l);
    fBufCur += l;
@@ -1182,8 +1153,8 @@ Int_t TBufferFile::ReadStaticArray(Double_t *d)
    if (!d) return 0;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   ROOT::Internal::BufferKernels::FromBigEndian64(d, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1300,13 +1271,8 @@ void TBufferFile::ReadFastArray(Short_t *h, Int_t n)
    if (n <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(h, fBufCur, n);
-   fBufCur += sizeof(Short_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
+   ROOT::Internal::BufferKernels::FromBigEndian16(h, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(h, fBufCur, l);
    fBufCur += l;
@@ -1322,13 +1288,8 @@ void TBufferFile::ReadFastArray(Int_t *ii, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(ii, fBufCur, n);
-   fBufCur += sizeof(Int_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
+   ROOT::Internal::BufferKernels::FromBigEndian32(ii, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ii, fBufCur, l);
    fBufCur += l;
@@ -1360,8 +1321,8 @@ void TBufferFile::ReadFastArray(Long64_t *ll, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   ROOT::Internal::BufferKernels::FromBigEndian64(ll, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1377,13 +1338,8 @@ void TBufferFile::ReadFastArray(Float_t *f, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(f, fBufCur, n);
-   fBufCur += sizeof(Float_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
+   ROOT::Internal::BufferKernels::FromBigEndian32(f, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(f, fBufCur, l);
    fBufCur += l;
@@ -1399,8 +1355,8 @@ void TBufferFile::ReadFastArray(Double_t *d, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   ROOT::Internal::BufferKernels::FromBigEndian64(d, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1417,33 +1373,16 @@ void TBufferFile::ReadFastArrayFloat16(Float_t *f, Int_t n, TStreamerElement *el
 
    if (ele && ele->GetFactor() != 0) {
       //a range was specified. We read an integer and convert it back to a float
-      Double_t xmin = ele->GetXmin();
-      Double_t factor = ele->GetFactor();
-      for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; f[j] = (Float_t)(aint/factor + xmin);
-      }
+      ROOT::Internal::BufferKernels::ExpandScaled(f, fBufCur, n, ele->GetFactor(), ele->GetXmin());
+      fBufCur += sizeof(UInt_t)*n;
    } else {
-      Int_t i;
       Int_t nbits = 0;
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) nbits = 12;
       //we read the exponent and the truncated mantissa of the float
       //and rebuild the new float.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      UChar_t  theExp;
-      UShort_t theMan;
-      for (i = 0; i < n; i++) {
-         *this >> theExp;
-         *this >> theMan;
-         fIntValue = theExp;
-         fIntValue <<= 23;
-         fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-         if(1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-         f[i] = fFloatValue;
-      }
+      ROOT::Internal::BufferKernels::ExpandTruncated(f, fBufCur, n, nbits);
+      fBufCur += 3*n;
    }
 }
 
@@ -1456,9 +1395,8 @@ void TBufferFile::ReadFastArrayWithFactor(Float_t *ptr, Int_t n, Double_t factor
    if (n <= 0 || 3*n > fBufSize) return;
 
    //a range was specified. We read an integer and convert it back to a float
-   for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; ptr[j] = (Float_t)(aint/factor + minvalue);
-   }
+   ROOT::Internal::BufferKernels::ExpandScaled(ptr, fBufCur, n, factor, minvalue);
+   fBufCur += sizeof(UInt_t)*n;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1472,21 +1410,8 @@ void TBufferFile::ReadFastArrayWithNbits(Float_t *ptr, Int_t n, Int_t nbits)
    if (!nbits) nbits = 12;
    //we read the exponent and the truncated mantissa of the float
    //and rebuild the new float.
-   union {
-      Float_t fFloatValue;
-      Int_t   fIntValue;
-   };
-   UChar_t  theExp;
-   UShort_t theMan;
-   for (Int_t i = 0; i < n; i++) {
-      *this >> theExp;
-      *this >> theMan;
-      fIntValue = theExp;
-      fIntValue <<= 23;
-      fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-      if(1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-      ptr[i] = fFloatValue;
-   }
+   ROOT::Internal::BufferKernels::ExpandTruncated(ptr, fBufCur, n, nbits);
+   fBufCur += 3*n;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1499,40 +1424,20 @@ void TBufferFile::ReadFastArrayDouble32(Double_t *d, Int_t n, TStreamerElement *
 
    if (ele && ele->GetFactor() != 0) {
       //a range was specified. We read an integer and convert it back to a double.
-      Double_t xmin = ele->GetXmin();
-      Double_t factor = ele->GetFactor();
-      for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + xmin);
-      }
+      ROOT::Internal::BufferKernels::ExpandScaled(d, fBufCur, n, ele->GetFactor(), ele->GetXmin());
+      fBufCur += sizeof(UInt_t)*n;
    } else {
-      Int_t i;
       Int_t nbits = 0;
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) {
          //we read a float and convert it to double
-         Float_t afloat;
-         for (i = 0; i < n; i++) {
-            *this >> afloat;
-            d[i] = (Double_t)afloat;
-         }
+         ROOT::Internal::BufferKernels::FloatToDouble(d, fBufCur, n);
+         fBufCur += sizeof(Float_t)*n;
       } else {
          //we read the exponent and the truncated mantissa of the float
          //and rebuild the double.
-         union {
-            Float_t fFloatValue;
-            Int_t   fIntValue;
-         };
-         UChar_t  theExp;
-         UShort_t theMan;
-         for (i = 0; i < n; i++) {
-            *this >> theExp;
-            *this >> theMan;
-            fIntValue = theExp;
-            fIntValue <<= 23;
-            fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-            if (1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-            d[i] = (Double_t)fFloatValue;
-         }
+         ROOT::Internal::BufferKernels::ExpandTruncated(d, fBufCur, n, nbits);
+         fBufCur += 3*n;
       }
    }
 }
@@ -1546,9 +1451,8 @@ void TBufferFile::ReadFastArrayWithFactor(Double_t *d, Int_t n, Double_t factor,
    if (n <= 0 || 3*n > fBufSize) return;
 
    //a range was specified. We read an integer and convert it back to a double.
-   for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + minvalue);
-   }
+   ROOT::Internal::BufferKernels::ExpandScaled(d, fBufCur, n, factor, minvalue);
+   fBufCur += sizeof(UInt_t)*n;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1561,29 +1465,13 @@ void TBufferFile::ReadFastArrayWithNbits(Double_t *d, Int_t n, Int_t nbits)
 
    if (!nbits) {
       //we read a float and convert it to double
-      Float_t afloat;
-      for (Int_t i = 0; i < n; i++) {
-         *this >> afloat;
-         d[i] = (Double_t)afloat;
-      }
+      ROOT::Internal::BufferKernels::FloatToDouble(d, fBufCur, n);
+      fBufCur += sizeof(Float_t)*n;
    } else {
       //we read the exponent and the truncated mantissa of the float
       //and rebuild the double.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      UChar_t  theExp;
-      UShort_t theMan;
-      for (Int_t i = 0; i < n; i++) {
-         *this >> theExp;
-         *this >> theMan;
-         fIntValue = theExp;
-         fIntValue <<= 23;
-         fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-         if (1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-         d[i] = (Double_t)fFloatValue;
-      }
+      ROOT::Internal::BufferKernels::ExpandTruncated(d, fBufCur, n, nbits);
+      fBufCur += 3*n;
    }
 }
 
@@ -927,36 +927,49 @@ TObject *TDirectoryFile::Get(const char *namecycle)
 
 //*-*---------------------Case of Object in memory---------------------
 //                        ========================
-   TObject *idcur = fList ? fList->FindObject(namobj) : nullptr;
-   if (idcur) {
-      if (idcur==this && strlen(namobj)!=0) {
-         // The object has the same name has the directory and
-         // that's what we picked-up!  We just need to ignore
-         // it ...
-         idcur = nullptr;
-      } else if (cycle == 9999) {
-         return idcur;
-      } else {
-         if (idcur->InheritsFrom(TCollection::Class()))
-            idcur->Delete();  // delete also list elements
-         delete idcur;
-         idcur = nullptr;
+   TObject *idcur = nullptr;
+   {
+      // Lock against the objects auto-added to fList by TKey::ReadObj
+      R__LOCKGUARD(gROOTMutex);
+      idcur = fList ? fList->FindObject(namobj) : nullptr;
+      if (idcur) {
+         if (idcur==this && strlen(namobj)!=0) {
+            // The object has the same name has the directory and
+            // that's what we picked-up!  We just need to ignore
+            // it ...
+            idcur = nullptr;
+         } else if (cycle == 9999) {
+            return idcur;
+         } else {
+            if (idcur->InheritsFrom(TCollection::Class()))
+               idcur->Delete();  // delete also list elements
+            delete idcur;
+            idcur = nullptr;
+         }
       }
    }
 
 //*-*---------------------Case of Key---------------------
 //                        ===========
-   TKey *key;
-   TIter nextkey(GetListOfKeys());
-   while ((key = (TKey *) nextkey())) {
-      if (strcmp(namobj,key->GetName()) == 0) {
-         if ((cycle == 9999) || (cycle == key->GetCycle())) {
-            TDirectory::TContext ctxt(this);
-            idcur = key->ReadObj();
-            break;
+   // Look up the key in the hash table of fKeys, as GetObjectChecked does.
+   TKey *found = nullptr;
+   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   if (const TList *keyList = listOfKeys ? listOfKeys->GetListForObject(namobj) : GetListOfKeys()) {
+      for (auto key: TRangeDynCast<TKey>(*keyList)) {
+         if (key && !strcmp(namobj, key->GetName())) {
+            if (cycle == key->GetCycle()) {
+               found = key;
+               break;
+            }
+            if (cycle == 9999 && (!found || key->GetCycle() > found->GetCycle()))
+               found = key;
          }
       }
    }
+   if (found) {
+      TDirectory::TContext ctxt(this);
+      idcur = found->ReadObj();
+   }
 
    return idcur;
 }
@@ -1043,6 +1056,8 @@ void *TDirectoryFile::GetObjectChecked(const char *namecycle, const TClass* expe
 //*-*---------------------Case of Object in memory---------------------
 //                        ========================
    if (expectedClass==0 || expectedClass->IsTObject()) {
+      // Lock against the objects auto-added to fList by TKey::ReadObjectAny
+      R__LOCKGUARD(gROOTMutex);
       TObject *objcur = fList ? fList->FindObject(namobj) : nullptr;
       if (objcur) {
          if (objcur==this && strlen(namobj)!=0) {
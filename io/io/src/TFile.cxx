@@ -132,6 +132,7 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "compiledata.h"
 #include <cmath>
 #include <iostream>
+#include <mutex>
 #include <set>
 #include "TSchemaRule.h"
 #include "TSchemaRuleSet.h"
@@ -303,6 +304,16 @@ TFile::TFile() : TDirectoryFile(), fCompress(ROOT::RCompressionSetting::EAlgorit
 /// ~~~{.cpp}
 ///   TFile *f = TFile::Open("tmpname.root?reproducible=fixedname","RECREATE","File title");
 /// ~~~
+///
+/// A bit `TFile::kConcurrentRead` can be enabled specifying the
+/// `"concurrentread"` url option when opening a local file for reading:
+/// ~~~{.cpp}
+///   TFile *f = TFile::Open("name.root?concurrentread");
+/// ~~~
+/// The positional reads, ReadBuffer(char*, Long64_t, Int_t) and ReadBuffers(),
+/// then use pread() instead of seeking on the shared file descriptor, so that
+/// several threads can read the keys and the baskets of the same file without
+/// serializing on its state. See TFile::IsConcurrentRead().
 
 TFile::TFile(const char *fname1, Option_t *option, const char *ftitle, Int_t compress)
            : TDirectoryFile(), fCompress(compress), fUrl(fname1,kTRUE)
@@ -335,6 +346,9 @@ TFile::TFile(const char *fname1, Option_t *option, const char *ftitle, Int_t com
    if (fUrl.HasOption("reproducible"))
       SetBit(kReproducible);
 
+   if (fUrl.HasOption("concurrentread"))
+      SetBit(kConcurrentRead);
+
    // We are opening synchronously
    fAsyncOpenStatus = kAOSNotAsync;
 
@@ -1389,6 +1403,21 @@ Bool_t TFile::IsOpen() const
    return fD == -1 ? kFALSE : kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns kTRUE if the positional reads of this file may be issued
+/// concurrently from several threads.
+///
+/// This requires the bit kConcurrentRead (see the `"concurrentread"` url
+/// option) on a local file opened for reading. When the file has a read
+/// cache, ReadBuffer(char*, Long64_t, Int_t) goes through it while holding
+/// gROOTMutex. The reads that use the offset of the file, like
+/// ReadBuffer(char*, Int_t), are not affected.
+
+Bool_t TFile::IsConcurrentRead() const
+{
+   return TestBit(kConcurrentRead) && !fWritable && IsA() == TFile::Class();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Mark unused bytes on the file.
 ///
@@ -1639,6 +1668,14 @@ Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
 {
    if (IsOpen()) {
 
+      // In the concurrent read mode the callers do not lock. The read cache,
+      // which may belong to any tree of the file, and the offset of the file
+      // are shared, so only a read without cache bypasses the lock.
+      const Bool_t concurrent = IsConcurrentRead();
+      if (concurrent && !fCacheRead)
+         return ReadBufferAt(buf, pos, len);
+      R__LOCKGUARD(concurrent ? gROOTMutex : nullptr);
+
       SetOffset(pos);
 
       Int_t st;
@@ -1728,6 +1765,49 @@ Bool_t TFile::ReadBuffer(char *buf, Int_t len)
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read a buffer from the file at the offset 'pos' in the file, without
+/// going through the caches and without changing the offset of the file.
+///
+/// This is the read operation of the concurrent read mode, it can be called
+/// from several threads at the same time. Returns kTRUE in case of failure.
+
+Bool_t TFile::ReadBufferAt(char *buf, Long64_t pos, Int_t len)
+{
+   Double_t start = 0;
+   if (gPerfStats) start = TTimeStamp();
+
+   ssize_t siz;
+
+   while ((siz = SysReadAt(fD, buf, len, pos + fArchiveOffset)) < 0 && GetErrno() == EINTR)
+      ResetErrno();
+
+   if (siz < 0) {
+      SysError("ReadBuffer", "error reading from file %s", GetName());
+      return kTRUE;
+   }
+   if (siz != len) {
+      Error("ReadBuffer", "error reading all requested bytes from file %s, got %ld of %d",
+            GetName(), (Long_t)siz, len);
+      return kTRUE;
+   }
+   fConcurrentBytesRead += siz;
+   fgBytesRead += siz;
+   fConcurrentReadCalls++;
+   fgReadCalls++;
+
+   if (gMonitoringWriter || gPerfStats) {
+      // The monitoring and perf stats hooks are not thread-safe, serialize them.
+      R__LOCKGUARD(gROOTMutex);
+      if (gMonitoringWriter)
+         gMonitoringWriter->SendFileReadProgress(this);
+      if (gPerfStats) {
+         gPerfStats->FileReadEvent(this, len, start);
+      }
+   }
+   return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read the nbuf blocks described in arrays pos and len.
 ///
@@ -1748,10 +1828,15 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
       return kFALSE;
    }
 
+   // In the concurrent read mode, the blocks are read with positional reads
+   // which bypass the cache, rather than by disabling it.
+   const Bool_t concurrent = IsConcurrentRead();
+
    Int_t k = 0;
    Bool_t result = kTRUE;
    TFileCacheRead *old = fCacheRead;
-   fCacheRead = nullptr;
+   if (!concurrent)
+      fCacheRead = nullptr;
    Long64_t curbegin = pos[0];
    Long64_t cur;
    char *buf2 = nullptr;
@@ -1764,18 +1849,26 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
          if (n == 0) {
             //if the block to read is about the same size as the read-ahead buffer
             //we read the block directly
-            Seek(pos[i]);
-            result = ReadBuffer(&buf[k], len[i]);
+            if (concurrent) {
+               result = ReadBufferAt(&buf[k], pos[i], len[i]);
+            } else {
+               Seek(pos[i]);
+               result = ReadBuffer(&buf[k], len[i]);
+            }
             if (result) break;
             k += len[i];
             i++;
          } else {
             //otherwise we read all blocks that fit in the read-ahead buffer
-            Seek(curbegin);
             if (!buf2) buf2 = new char[fgReadaheadSize];
             //we read ahead
             Long64_t nahead = pos[i-1]+len[i-1]-curbegin;
-            result = ReadBuffer(buf2, nahead);
+            if (concurrent) {
+               result = ReadBufferAt(buf2, curbegin, nahead);
+            } else {
+               Seek(curbegin);
+               result = ReadBuffer(buf2, nahead);
+            }
             if (result) break;
             //now copy from the read-ahead buffer to the cache
             Int_t kold = k;
@@ -1785,8 +1878,13 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
             }
             Int_t nok = k-kold;
             Long64_t extra = nahead-nok;
-            fBytesReadExtra += extra;
-            fBytesRead      -= extra;
+            if (concurrent) {
+               fConcurrentBytesReadExtra += extra;
+               fConcurrentBytesRead      -= extra;
+            } else {
+               fBytesReadExtra += extra;
+               fBytesRead      -= extra;
+            }
             fgBytesRead     -= extra;
             n = 0;
          }
@@ -1794,7 +1892,8 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
       }
    }
    if (buf2) delete [] buf2;
-   fCacheRead = old;
+   if (!concurrent)
+      fCacheRead = old;
    return result;
 }
 
@@ -4400,6 +4499,28 @@ Int_t TFile::SysRead(Int_t fd, void *buf, Int_t len)
    return ::read(fd, buf, len);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Interface to system positional read. All arguments like in POSIX pread().
+///
+/// Unlike SysRead(), it does not use nor change the offset of the file
+/// descriptor. On Windows, where there is no equivalent of pread(), the
+/// seek and the read are done while holding a lock.
+
+Int_t TFile::SysReadAt(Int_t fd, void *buf, Int_t len, Long64_t offset)
+{
+#if defined(WIN32)
+   static std::mutex readAtMutex;
+   std::lock_guard<std::mutex> sentry(readAtMutex);
+   if (::_lseeki64(fd, offset, SEEK_SET) < 0)
+      return -1;
+   return ::read(fd, buf, len);
+#elif defined(R__SEEK64)
+   return ::pread64(fd, buf, len, offset);
+#else
+   return ::pread(fd, buf, len, offset);
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Interface to system write. All arguments like in POSIX write().
 
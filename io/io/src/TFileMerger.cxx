@@ -374,18 +374,6 @@ Bool_t TFileMerger::Merge(Bool_t)
 
 namespace {
 
-/// Merge a list of RNTuples
-Long64_t MergeRNTuples(TClass* rntupleHandle, const TString& /* target */, const TList& /* sources */) {
-   if (!rntupleHandle) {
-      return Long64_t(-1);
-   }
-   // todo(max) implement rntuple merger
-   // [ ] build complete list of sources (some sources may actually be a directory with RNTuples inside)
-   // [ ] merge them
-   ROOT::MergeFunc_t func = rntupleHandle->GetMerge();
-   return func(static_cast<void*>(rntupleHandle), nullptr, nullptr);
-}
-
 Bool_t IsMergeable(TClass *cl)
 {
    return (cl->GetMerge() || cl->InheritsFrom(TDirectory::Class()) ||
@@ -596,10 +584,24 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
    } else if (!cl->IsTObject() && cl->GetMerge()) {
       // merge objects that don't derive from TObject
       if (std::string(keyclassname) == "ROOT::Experimental::RNTuple") {
+         if (alreadyseen) return kTRUE;
          Warning("MergeRecursive", "merging RNTuples is experimental");
-         // todo(max): check if this works when a TDirectory is passed as the first
-         // input argument
-         Long64_t mergeResult = MergeRNTuples(cl, *path, *sourcelist);
+         // The RNTuples are read by name from the top-level directory of the files, and they cannot be appended
+         // to an RNTuple of the output file
+         if (!path.IsNull() || !current_file) {
+            Error("MergeRecursive", "cannot merge RNTuple %s: only RNTuples in the top-level directory of the "
+                  "input files can be merged into a new output RNTuple", keyname);
+            return kFALSE;
+         }
+         // RNTuple::Merge expects the name of the RNTuple, followed by the files that contain it
+         TObjString ntupleName(keyname);
+         TList inputs;
+         inputs.Add(&ntupleName);
+         for (TObject *source = current_file; source; source = sourcelist->After(source))
+            inputs.Add(source);
+         ROOT::MergeFunc_t func = cl->GetMerge();
+         Long64_t mergeResult = func(obj, &inputs, &info);
+         info.fIsFirst = kFALSE;
          if (mergeResult < 0) {
             Error("MergeRecursive", "error merging RNTuples");
             return kFALSE;
@@ -839,8 +841,12 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
    TFileMergeInfo info(target);
    info.fIOFeatures = fIOFeatures;
    info.fOptions = fMergeOptions;
-   if (fFastMethod && ((type&kKeepCompression) || !fCompressionChange) ) {
+   if (fFastMethod) {
       info.fOptions.Append(" fast");
+      // Only the TTrees of the inputs whose compression differs from the output are re-compressed,
+      // the baskets of the others are still copied as raw bytes.
+      if (!(type&kKeepCompression) && fCompressionChange)
+         info.fOptions.Append(" recompress");
    }
 
    TFile      *current_file;
@@ -64,6 +64,7 @@
 #include "TVirtualStreamerInfo.h"
 #include "TSchemaRuleSet.h"
 #include "ThreadLocalStorage.h"
+#include "TVirtualMutex.h"
 
 #include "RZip.h"
 
@@ -153,8 +154,7 @@ TKey::TKey(TDirectory* motherDir, const TKey &orig, UShort_t pidOffset) : TNamed
    TFile* f = orig.GetFile();
    if (f) {
       Int_t nsize = orig.fNbytes;
-      f->Seek(orig.fSeekKey);
-      if( f->ReadBuffer(fBuffer+bufferIncOffset,nsize) )
+      if( f->ReadBuffer(fBuffer+bufferIncOffset,orig.fSeekKey,nsize) )
       {
          Error("ReadFile", "Failed to read data.");
          return;
@@ -769,25 +769,15 @@ TObject *TKey::ReadObj()
    bufferRef.SetPidOffset(fPidOffset);
 
    std::unique_ptr<char []> compressedBuffer;
-   auto storeBuffer = fBuffer;
    if (fObjlen > fNbytes-fKeylen) {
       compressedBuffer.reset(new char[fNbytes]);
-      fBuffer = compressedBuffer.get();
-      if( !ReadFile() )                    //Read object structure from file
-      {
-        fBuffer = 0;
-        return 0;
-      }
-      memcpy(bufferRef.Buffer(),fBuffer,fKeylen);
+      if( !ReadFileToBuffer(compressedBuffer.get()) ) //Read object structure from file
+         return 0;
+      memcpy(bufferRef.Buffer(),compressedBuffer.get(),fKeylen);
    } else {
-      fBuffer = bufferRef.Buffer();
-      if( !ReadFile() ) {                   //Read object structure from file
-
-         fBuffer = 0;
+      if( !ReadFileToBuffer(bufferRef.Buffer()) )     //Read object structure from file
          return 0;
-      }
    }
-   fBuffer = storeBuffer;
 
    // get version of key
    bufferRef.SetBufferOffset(sizeof(fNbytes));
@@ -844,6 +834,10 @@ TObject *TKey::ReadObj()
 
    if (gROOT->GetForceStyle()) tobj->UseCurrentStyle();
 
+   // The list of objects of the directory is shared with the other threads
+   // reading from it, see TDirectoryFile::Get.
+   R__LOCKGUARD(gROOTMutex);
+
    if (cl->InheritsFrom(TDirectoryFile::Class())) {
       TDirectory *dir = static_cast<TDirectoryFile*>(tobj);
       dir->SetName(GetName());
@@ -903,15 +897,11 @@ TObject *TKey::ReadObjWithBuffer(char *bufferRead)
    bufferRef.SetParent(GetFile());
    bufferRef.SetPidOffset(fPidOffset);
 
-   auto storeBuffer = fBuffer;
    if (fObjlen > fNbytes-fKeylen) {
-      fBuffer = bufferRead;
-      memcpy(bufferRef.Buffer(),fBuffer,fKeylen);
+      memcpy(bufferRef.Buffer(),bufferRead,fKeylen);
    } else {
-      fBuffer = bufferRef.Buffer();
-      ReadFile();                    //Read object structure from file
+      ReadFileToBuffer(bufferRef.Buffer()); //Read object structure from file
    }
-   fBuffer = storeBuffer;
 
    // get version of key
    bufferRef.SetBufferOffset(sizeof(fNbytes));
@@ -968,6 +958,10 @@ TObject *TKey::ReadObjWithBuffer(char *bufferRead)
 
    if (gROOT->GetForceStyle()) tobj->UseCurrentStyle();
 
+   // The list of objects of the directory is shared with the other threads
+   // reading from it, see TDirectoryFile::Get.
+   R__LOCKGUARD(gROOTMutex);
+
    if (cl->InheritsFrom(TDirectoryFile::Class())) {
       TDirectory *dir = static_cast<TDirectoryFile*>(tobj);
       dir->SetName(GetName());
@@ -1024,17 +1018,13 @@ void *TKey::ReadObjectAny(const TClass* expectedClass)
    bufferRef.SetPidOffset(fPidOffset);
 
    std::unique_ptr<char []> compressedBuffer;
-   auto storeBuffer = fBuffer;
    if (fObjlen > fNbytes-fKeylen) {
       compressedBuffer.reset(new char[fNbytes]);
-      fBuffer = compressedBuffer.get();
-      ReadFile();                    //Read object structure from file
-      memcpy(bufferRef.Buffer(),fBuffer,fKeylen);
+      ReadFileToBuffer(compressedBuffer.get()); //Read object structure from file
+      memcpy(bufferRef.Buffer(),compressedBuffer.get(),fKeylen);
    } else {
-      fBuffer = bufferRef.Buffer();
-      ReadFile();                    //Read object structure from file
+      ReadFileToBuffer(bufferRef.Buffer());     //Read object structure from file
    }
-   fBuffer = storeBuffer;
 
    // get version of key
    bufferRef.SetBufferOffset(sizeof(fNbytes));
@@ -1124,12 +1114,14 @@ void *TKey::ReadObjectAny(const TClass* expectedClass)
          dir->SetName(GetName());
          dir->SetTitle(GetTitle());
          dir->SetMother(fMotherDir);
+         R__LOCKGUARD(gROOTMutex);
          fMotherDir->Append(dir);
       }
    }
 
    {
       // Append the object to the directory if requested:
+      R__LOCKGUARD(gROOTMutex);
       ROOT::DirAutoAdd_t addfunc = cl->GetDirectoryAutoAdd();
       if (addfunc) {
          addfunc(pobj, fMotherDir);
@@ -1158,17 +1150,13 @@ Int_t TKey::Read(TObject *obj)
       bufferRef.MapObject(obj);  //register obj in map to handle self reference
 
    std::unique_ptr<char []> compressedBuffer;
-   auto storeBuffer = fBuffer;
    if (fObjlen > fNbytes-fKeylen) {
       compressedBuffer.reset(new char[fNbytes]);
-      fBuffer = compressedBuffer.get();
-      ReadFile();                    //Read object structure from file
-      memcpy(bufferRef.Buffer(),fBuffer,fKeylen);
+      ReadFileToBuffer(compressedBuffer.get()); //Read object structure from file
+      memcpy(bufferRef.Buffer(),compressedBuffer.get(),fKeylen);
    } else {
-      fBuffer = bufferRef.Buffer();
-      ReadFile();                    //Read object structure from file
+      ReadFileToBuffer(bufferRef.Buffer());     //Read object structure from file
    }
-   fBuffer = storeBuffer;
 
    bufferRef.SetBufferOffset(fKeylen);
    if (fObjlen > fNbytes-fKeylen) {
@@ -1193,6 +1181,7 @@ Int_t TKey::Read(TObject *obj)
 
    // Append the object to the directory if requested:
    {
+      R__LOCKGUARD(gROOTMutex);
       ROOT::DirAutoAdd_t addfunc = obj->IsA()->GetDirectoryAutoAdd();
       if (addfunc) {
          addfunc(obj, fMotherDir);
@@ -1263,25 +1252,29 @@ void TKey::ReadKeyBuffer(char *&buffer)
 /// Read the key structure from the file
 
 Bool_t TKey::ReadFile()
+{
+   return ReadFileToBuffer(fBuffer);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the key structure from the file into the given buffer, of at least
+/// fNbytes bytes.
+///
+/// Unlike ReadFile(), this does not use fBuffer and, as it reads at the
+/// position of the key rather than at the offset of the file, the same key
+/// can be read from several threads, see TFile::IsConcurrentRead().
+
+Bool_t TKey::ReadFileToBuffer(char *buffer) const
 {
    TFile* f = GetFile();
    if (f==0) return kFALSE;
 
    Int_t nsize = fNbytes;
-   f->Seek(fSeekKey);
-#if 0
-   for (Int_t i = 0; i < nsize; i += kMAXFILEBUFFER) {
-      int nb = kMAXFILEBUFFER;
-      if (i+nb > nsize) nb = nsize - i;
-      f->ReadBuffer(fBuffer+i,nb);
-   }
-#else
-   if( f->ReadBuffer(fBuffer,nsize) )
+   if( f->ReadBuffer(buffer,fSeekKey,nsize) )
    {
       Error("ReadFile", "Failed to read data.");
       return kFALSE;
    }
-#endif
    if (gDebug) {
       std::cout << "TKey Reading "<<nsize<< " bytes at address "<<fSeekKey<<std::endl;
    }
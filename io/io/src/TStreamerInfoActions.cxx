@@ -253,6 +253,55 @@ namespace TStreamerInfoActions
       return 0;
    }
 
+   // Fixed size arrays of basic types, including the runs of consecutive
+   // members of the same type that TStreamerInfo::Compile regroups.
+   // These avoid going through the generic TStreamerInfo::ReadBuffer and
+   // WriteBufferAux for each of them.
+
+   template <typename T>
+   INLINE_TEMPLATE_ARGS Int_t ReadBasicArray(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      T *x = (T*)( ((char*)addr) + config->fOffset );
+      buf.ReadFastArray(x, config->fLength);
+      return 0;
+   }
+
+   Int_t ReadFloat16Array(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      Float_t *x = (Float_t*)( ((char*)addr) + config->fOffset );
+      buf.ReadFastArrayFloat16(x, config->fLength, config->fCompInfo->fElem);
+      return 0;
+   }
+
+   Int_t ReadDouble32Array(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      Double_t *x = (Double_t*)( ((char*)addr) + config->fOffset );
+      buf.ReadFastArrayDouble32(x, config->fLength, config->fCompInfo->fElem);
+      return 0;
+   }
+
+   template <typename T>
+   INLINE_TEMPLATE_ARGS Int_t WriteBasicArray(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      T *x = (T*)( ((char*)addr) + config->fOffset );
+      buf.WriteFastArray(x, config->fLength);
+      return 0;
+   }
+
+   Int_t WriteFloat16Array(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      Float_t *x = (Float_t*)( ((char*)addr) + config->fOffset );
+      buf.WriteFastArrayFloat16(x, config->fLength, config->fCompInfo->fElem);
+      return 0;
+   }
+
+   Int_t WriteDouble32Array(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      Double_t *x = (Double_t*)( ((char*)addr) + config->fOffset );
+      buf.WriteFastArrayDouble32(x, config->fLength, config->fCompInfo->fElem);
+      return 0;
+   }
+
    INLINE_TEMPLATE_ARGS Int_t WriteTextTNamed(TBuffer &buf, void *addr, const TConfiguration *config)
    {
       void *x = (void *)(((char *)addr) + config->fOffset);
@@ -2987,6 +3036,117 @@ static TConfiguredAction GetCollectionWriteAction(TVirtualStreamerInfo *info, TS
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Add the read action of a fixed size array of basic types of the given type.
+
+static void AddReadBasicArrayAction(TStreamerInfoActions::TActionSequence *sequence, Int_t type, TConfiguration *conf)
+{
+   switch (type) {
+      case TStreamerInfo::kBool:    sequence->AddAction( ReadBasicArray<Bool_t>,    conf ); break;
+      case TStreamerInfo::kChar:    sequence->AddAction( ReadBasicArray<Char_t>,    conf ); break;
+      case TStreamerInfo::kShort:   sequence->AddAction( ReadBasicArray<Short_t>,   conf ); break;
+      case TStreamerInfo::kInt:     sequence->AddAction( ReadBasicArray<Int_t>,     conf ); break;
+      case TStreamerInfo::kLong:    sequence->AddAction( ReadBasicArray<Long_t>,    conf ); break;
+      case TStreamerInfo::kLong64:  sequence->AddAction( ReadBasicArray<Long64_t>,  conf ); break;
+      case TStreamerInfo::kFloat:   sequence->AddAction( ReadBasicArray<Float_t>,   conf ); break;
+      case TStreamerInfo::kDouble:  sequence->AddAction( ReadBasicArray<Double_t>,  conf ); break;
+      case TStreamerInfo::kUChar:   sequence->AddAction( ReadBasicArray<UChar_t>,   conf ); break;
+      case TStreamerInfo::kUShort:  sequence->AddAction( ReadBasicArray<UShort_t>,  conf ); break;
+      case TStreamerInfo::kUInt:    sequence->AddAction( ReadBasicArray<UInt_t>,    conf ); break;
+      case TStreamerInfo::kULong:   sequence->AddAction( ReadBasicArray<ULong_t>,   conf ); break;
+      case TStreamerInfo::kULong64: sequence->AddAction( ReadBasicArray<ULong64_t>, conf ); break;
+      case TStreamerInfo::kFloat16: sequence->AddAction( ReadFloat16Array,          conf ); break;
+      case TStreamerInfo::kDouble32:sequence->AddAction( ReadDouble32Array,         conf ); break;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the write action of a fixed size array of basic types of the given type.
+
+static void AddWriteBasicArrayAction(TStreamerInfoActions::TActionSequence *sequence, Int_t type, TConfiguration *conf)
+{
+   switch (type) {
+      case TStreamerInfo::kBool:    sequence->AddAction( WriteBasicArray<Bool_t>,    conf ); break;
+      case TStreamerInfo::kChar:    sequence->AddAction( WriteBasicArray<Char_t>,    conf ); break;
+      case TStreamerInfo::kShort:   sequence->AddAction( WriteBasicArray<Short_t>,   conf ); break;
+      case TStreamerInfo::kInt:     sequence->AddAction( WriteBasicArray<Int_t>,     conf ); break;
+      case TStreamerInfo::kLong:    sequence->AddAction( WriteBasicArray<Long_t>,    conf ); break;
+      case TStreamerInfo::kLong64:  sequence->AddAction( WriteBasicArray<Long64_t>,  conf ); break;
+      case TStreamerInfo::kFloat:   sequence->AddAction( WriteBasicArray<Float_t>,   conf ); break;
+      case TStreamerInfo::kDouble:  sequence->AddAction( WriteBasicArray<Double_t>,  conf ); break;
+      case TStreamerInfo::kUChar:   sequence->AddAction( WriteBasicArray<UChar_t>,   conf ); break;
+      case TStreamerInfo::kUShort:  sequence->AddAction( WriteBasicArray<UShort_t>,  conf ); break;
+      case TStreamerInfo::kUInt:    sequence->AddAction( WriteBasicArray<UInt_t>,    conf ); break;
+      case TStreamerInfo::kULong:   sequence->AddAction( WriteBasicArray<ULong_t>,   conf ); break;
+      case TStreamerInfo::kULong64: sequence->AddAction( WriteBasicArray<ULong64_t>, conf ); break;
+      case TStreamerInfo::kFloat16: sequence->AddAction( WriteFloat16Array,          conf ); break;
+      case TStreamerInfo::kDouble32:sequence->AddAction( WriteDouble32Array,         conf ); break;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the basic type of the compiled element if it is a member, a fixed
+/// size array or a regrouped run of a basic type that can be streamed as part
+/// of a larger array, and -1 otherwise.
+/// Float16_t and Double32_t are excluded since their ranges can differ.
+
+static Int_t GetContiguousBasicType(const TStreamerInfo::TCompInfo_t *compinfo)
+{
+   if (!compinfo->fElem || compinfo->fElem->TestBit(TStreamerElement::kCache) || compinfo->fOffset == TVirtualStreamerInfo::kMissing) {
+      return -1;
+   }
+   Int_t type = compinfo->fType;
+   if (TStreamerInfo::kOffsetL < type && type < TStreamerInfo::kOffsetP) {
+      type -= TStreamerInfo::kOffsetL;
+   }
+   switch (type) {
+      case TStreamerInfo::kBool:
+      case TStreamerInfo::kChar:
+      case TStreamerInfo::kShort:
+      case TStreamerInfo::kInt:
+      case TStreamerInfo::kLong:
+      case TStreamerInfo::kLong64:
+      case TStreamerInfo::kFloat:
+      case TStreamerInfo::kDouble:
+      case TStreamerInfo::kUChar:
+      case TStreamerInfo::kUShort:
+      case TStreamerInfo::kUInt:
+      case TStreamerInfo::kULong:
+      case TStreamerInfo::kULong64:
+         return type;
+      default:
+         return -1;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the index of the last of the compiled elements, starting at `first`,
+/// that hold the same basic type and are laid out back to back in memory, and
+/// set `length` to their total number of values.
+/// TStreamerInfo::Compile only regroups single members, this also covers the
+/// fixed size arrays.
+
+static Int_t GetBasicArrayRun(TStreamerInfo::TCompInfo_t **comp, Int_t first, Int_t ndata, UInt_t &length)
+{
+   length = comp[first]->fLength;
+   Int_t type = GetContiguousBasicType(comp[first]);
+   if (type < 0) {
+      return first;
+   }
+   Int_t asize = comp[first]->fElem->GetSize();
+   if (comp[first]->fElem->GetArrayLength()) {
+      asize /= comp[first]->fElem->GetArrayLength();
+   }
+   Int_t last = first;
+   while (last + 1 < ndata
+          && GetContiguousBasicType(comp[last + 1]) == type
+          && comp[last + 1]->fOffset == comp[last]->fOffset + comp[last]->fLength * asize) {
+      ++last;
+      length += comp[last]->fLength;
+   }
+   return last;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// loop on the TStreamerElement list
 /// regroup members with same type
@@ -3209,6 +3369,18 @@ void TStreamerInfo::Compile()
       if (!fCompOpt[i]->fElem || fCompOpt[i]->fElem->GetType()< 0) {
          continue;
       }
+      // Stream consecutive arrays of the same basic type with a single action.
+      // The object-wise sequences are never split per element, unlike the
+      // member-wise ones that TBranchElement selects from.
+      UInt_t length = 0;
+      Int_t last = TestBit(kCannotOptimize) ? i : GetBasicArrayRun(fCompOpt, i, fNdata, length);
+      if (last > i) {
+         Int_t type = GetContiguousBasicType(fCompOpt[i]);
+         AddReadBasicArrayAction(fReadObjectWise, type, new TConfiguration(this,i,fCompOpt[i],fCompOpt[i]->fOffset,length) );
+         AddWriteBasicArrayAction(fWriteObjectWise, type, new TConfiguration(this,i,fCompOpt[i],fCompOpt[i]->fOffset,length) );
+         i = last;
+         continue;
+      }
       AddReadAction(fReadObjectWise, i, fCompOpt[i]);
       AddWriteAction(fWriteObjectWise, i, fCompOpt[i]);
    }
@@ -3478,6 +3650,27 @@ void TStreamerInfo::AddReadAction(TStreamerInfoActions::TActionSequence *readSeq
          }
          break;
       }
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kBool:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kChar:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kShort:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kInt:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong64:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kFloat:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kDouble:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUChar:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUShort:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUInt:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong64:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kFloat16:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kDouble32:
+         if (TestBit(kCannotOptimize)) {
+            readSequence->AddAction( GenericReadAction, new TGenericConfiguration(this,i,compinfo) );
+         } else {
+            AddReadBasicArrayAction(readSequence, compinfo->fType - TStreamerInfo::kOffsetL, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) );
+         }
+         break;
       default:
          readSequence->AddAction( GenericReadAction, new TGenericConfiguration(this,i,compinfo) );
          break;
@@ -3666,6 +3859,27 @@ void TStreamerInfo::AddWriteAction(TStreamerInfoActions::TActionSequence *writeS
         }
         break;
      } */
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kBool:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kChar:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kShort:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kInt:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong64:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kFloat:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kDouble:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUChar:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUShort:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUInt:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong64:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kFloat16:
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kDouble32:
+         if (TestBit(kCannotOptimize)) {
+            writeSequence->AddAction( GenericWriteAction, new TGenericConfiguration(this,i,compinfo) );
+         } else {
+            AddWriteBasicArrayAction(writeSequence, compinfo->fType - TStreamerInfo::kOffsetL, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) );
+         }
+         break;
       default:
          writeSequence->AddAction( GenericWriteAction, new TGenericConfiguration(this,i,compinfo) );
          break;
@@ -0,0 +1,85 @@
+#ifndef ROOT_IO_TEST_BASICARRAYS
+#define ROOT_IO_TEST_BASICARRAYS
+
+#include "Rtypes.h"
+
+// Fixed size arrays of all the basic types, followed by runs of consecutive members of the same type that
+// TStreamerInfo::Compile regroups into a single array element.
+class BasicArrays {
+public:
+   Bool_t fBool[3];
+   Char_t fChar[3];
+   Short_t fShort[3];
+   Int_t fInt[3];
+   Long_t fLong[3];
+   Long64_t fLong64[3];
+   Float_t fFloat[3];
+   Double_t fDouble[3];
+   UChar_t fUChar[3];
+   UShort_t fUShort[3];
+   UInt_t fUInt[3];
+   ULong_t fULong[3];
+   ULong64_t fULong64[3];
+   Float16_t fFloat16[3];   //[0,100,12]
+   Double32_t fDouble32[3]; //[-10,10,20]
+   Double32_t fDouble32AsFloat[3];
+   Int_t fA;
+   Int_t fB;
+   Int_t fC;
+   Double_t fX;
+   Double_t fY;
+   Double32_t fU; //[0,1,16]
+   Double32_t fV; //[0,1,16]
+
+   virtual ~BasicArrays() {}
+   ClassDef(BasicArrays, 1)
+};
+
+// The same members, for a class whose streamer info is built while the optimization is disabled
+class BasicArraysNotOptimized {
+public:
+   Bool_t fBool[3];
+   Char_t fChar[3];
+   Short_t fShort[3];
+   Int_t fInt[3];
+   Long_t fLong[3];
+   Long64_t fLong64[3];
+   Float_t fFloat[3];
+   Double_t fDouble[3];
+   UChar_t fUChar[3];
+   UShort_t fUShort[3];
+   UInt_t fUInt[3];
+   ULong_t fULong[3];
+   ULong64_t fULong64[3];
+   Float16_t fFloat16[3];   //[0,100,12]
+   Double32_t fDouble32[3]; //[-10,10,20]
+   Double32_t fDouble32AsFloat[3];
+   Int_t fA;
+   Int_t fB;
+   Int_t fC;
+   Double_t fX;
+   Double_t fY;
+   Double32_t fU; //[0,1,16]
+   Double32_t fV; //[0,1,16]
+
+   virtual ~BasicArraysNotOptimized() {}
+   ClassDef(BasicArraysNotOptimized, 1)
+};
+
+// Consecutive arrays of the same basic type that are laid out back to back, with a single member regrouped into the
+// preceding array and one member of a different type in between
+class ContiguousArrays {
+public:
+   Int_t fFirst[2];
+   Int_t fSecond[3];
+   Int_t fScalar;
+   Int_t fThird[4];
+   Float_t fWeight;
+   Double_t fPosition[3];
+   Double_t fDirection[3];
+
+   virtual ~ContiguousArrays() {}
+   ClassDef(ContiguousArrays, 1)
+};
+
+#endif
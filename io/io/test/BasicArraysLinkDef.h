@@ -0,0 +1,7 @@
+#ifdef __ROOTCLING__
+
+#pragma link C++ class BasicArrays+;
+#pragma link C++ class BasicArraysNotOptimized+;
+#pragma link C++ class ContiguousArrays+;
+
+#endif
@@ -43,6 +43,35 @@ TEST(RRawFileUnix, ReadV)
    }
 }
 
+TEST(RRawFileUnix, ReadVAsync)
+{
+   auto file = "test_uring_readv_async";
+   auto filesize = 2 << 20;
+   FileRaii fileGuard(file, std::string(filesize, 'a')); // ~2MB
+   auto f = RRawFileUnix::Create(file);
+   EXPECT_TRUE(f->GetFeatures() & RRawFile::kFeatureHasAsyncIo);
+
+   // Two outstanding vector reads that together exceed the ring's queue depth
+   auto nReq = 1500;
+   auto iovecs1 = make_iovecs(nReq, filesize);
+   auto iovecs2 = make_iovecs(nReq, filesize);
+   auto handle1 = f->ReadVAsync(iovecs1.data(), nReq);
+   auto handle2 = f->ReadVAsync(iovecs2.data(), nReq);
+   f->WaitReadV(handle2);
+   EXPECT_TRUE(f->IsReadVDone(handle2));
+   f->WaitReadV(handle1);
+
+   for (auto iovecs : {iovecs1, iovecs2}) {
+      for (auto iovec : iovecs) {
+         EXPECT_EQ(std::min<std::size_t>(iovec.fSize, filesize - iovec.fOffset), iovec.fOutBytes);
+         for (std::size_t i = 0; i < iovec.fOutBytes; ++i) {
+            EXPECT_EQ('a', ((unsigned char*)iovec.fBuffer)[i]);
+         }
+         free(iovec.fBuffer);
+      }
+   }
+}
+
 TEST(RawUring, NopRoundTrip)
 {
    struct io_uring ring;
@@ -1,5 +1,9 @@
 #include "io_test.hxx"
 
+#include <ROOT/RRawFileLatency.hxx>
+
+#include <chrono>
+
 namespace {
 
 /**
@@ -138,6 +142,74 @@ TEST(RRawFile, ReadV)
 }
 
 
+TEST(RRawFile, ReadVAsync)
+{
+   FileRaii readvGuard("test_rawfile_readv_async", "Hello, World");
+   auto f = RRawFile::Create("test_rawfile_readv_async");
+
+   char buffer[3];
+   buffer[0] = buffer[1] = buffer[2] = 0;
+   RRawFile::RIOVec iovec[2];
+   iovec[0].fBuffer = &buffer[0];
+   iovec[0].fOffset = 7;
+   iovec[0].fSize = 2;
+   iovec[1].fBuffer = &buffer[2];
+   iovec[1].fOffset = 11;
+   iovec[1].fSize = 2;
+   auto handle = f->ReadVAsync(iovec, 2);
+   f->WaitReadV(handle);
+   EXPECT_TRUE(f->IsReadVDone(handle));
+
+   EXPECT_EQ(2U, iovec[0].fOutBytes);
+   EXPECT_EQ(1U, iovec[1].fOutBytes);
+   EXPECT_EQ('W', buffer[0]);
+   EXPECT_EQ('o', buffer[1]);
+   EXPECT_EQ('d', buffer[2]);
+
+   // The synchronous and the asynchronous API can be mixed
+   char c = 0;
+   iovec[0].fBuffer = &c;
+   iovec[0].fOffset = 0;
+   iovec[0].fSize = 1;
+   f->ReadV(iovec, 1);
+   EXPECT_EQ('H', c);
+}
+
+
+TEST(RRawFile, Latency)
+{
+   FileRaii latencyGuard("test_rawfile_latency", "Hello, World");
+   auto f = std::make_unique<ROOT::Internal::RRawFileLatency>(RRawFile::Create("test_rawfile_latency"),
+                                                              std::chrono::microseconds(10));
+   EXPECT_EQ(12U, f->GetSize());
+   EXPECT_EQ(0, f->GetFeatures() & RRawFile::kFeatureHasMmap);
+
+   char buffer[3];
+   RRawFile::RIOVec iovec[3];
+   for (unsigned i = 0; i < 3; ++i) {
+      iovec[i].fBuffer = &buffer[i];
+      iovec[i].fOffset = 4 * i;
+      iovec[i].fSize = 1;
+   }
+   f->ReadV(iovec, 3);
+   EXPECT_EQ(1U, f->GetNRoundTrips());
+   EXPECT_EQ('H', buffer[0]);
+   EXPECT_EQ('o', buffer[1]);
+   EXPECT_EQ('o', buffer[2]);
+
+   // Reads are not buffered by the wrapper
+   EXPECT_EQ(1U, f->ReadAt(&buffer[0], 1, 1));
+   EXPECT_EQ(1U, f->ReadAt(&buffer[1], 1, 2));
+   EXPECT_EQ(3U, f->GetNRoundTrips());
+   EXPECT_EQ('e', buffer[0]);
+   EXPECT_EQ('l', buffer[1]);
+
+   auto clone = f->Clone();
+   EXPECT_EQ(1U, clone->ReadAt(&buffer[0], 1, 11));
+   EXPECT_EQ('d', buffer[0]);
+}
+
+
 TEST(RRawFile, SplitUrl)
 {
    EXPECT_STREQ("C:\\Data\\events.root", RRawFile::GetLocation("C:\\Data\\events.root").c_str());
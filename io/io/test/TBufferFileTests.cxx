@@ -0,0 +1,91 @@
+#include "TBufferFile.h"
+#include "TStreamerElement.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+// Long enough for the vectorized kernels and their scalar tails.
+constexpr Int_t kMaxLength = 67;
+
+template <typename T>
+std::vector<T> MakeValues(Int_t n)
+{
+   std::vector<T> values(n);
+   for (Int_t i = 0; i < n; ++i)
+      values[i] = static_cast<T>((i % 2 ? -1 : 1) * (i * 1234567.89 + 0.5));
+   return values;
+}
+
+template <typename T>
+void CheckRoundTrip()
+{
+   for (Int_t n = 1; n <= kMaxLength; ++n) {
+      const auto values = MakeValues<T>(n);
+      TBufferFile wbuf(TBuffer::kWrite);
+      wbuf.WriteFastArray(values.data(), n);
+      wbuf.WriteArray(values.data(), n);
+
+      TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+      std::vector<T> fast(n);
+      rbuf.ReadFastArray(fast.data(), n);
+      T *array = nullptr;
+      EXPECT_EQ(rbuf.ReadArray(array), n);
+      EXPECT_EQ(rbuf.Length(), wbuf.Length());
+      for (Int_t i = 0; i < n; ++i) {
+         EXPECT_EQ(fast[i], values[i]) << "n = " << n << ", i = " << i;
+         EXPECT_EQ(array[i], values[i]) << "n = " << n << ", i = " << i;
+      }
+      delete[] array;
+   }
+}
+} // anonymous namespace
+
+TEST(TBufferFile, FastArrayRoundTrip)
+{
+   CheckRoundTrip<Short_t>();
+   CheckRoundTrip<Int_t>();
+   CheckRoundTrip<Long64_t>();
+   CheckRoundTrip<Float_t>();
+   CheckRoundTrip<Double_t>();
+}
+
+TEST(TBufferFile, Float16Double32Arrays)
+{
+   TStreamerElement rangeFloat("x", "[-10, 10]", 0, 0, "Float16_t");
+   TStreamerElement rangeDouble("x", "[-10, 10]", 0, 0, "Double32_t");
+   for (Int_t n = 1; n <= kMaxLength; ++n) {
+      std::vector<Float_t> floats(n);
+      std::vector<Double_t> doubles(n);
+      for (Int_t i = 0; i < n; ++i) {
+         floats[i] = static_cast<Float_t>(std::sin(i) * 9.);
+         doubles[i] = std::cos(i) * 9.;
+      }
+
+      TBufferFile wbuf(TBuffer::kWrite);
+      wbuf.WriteFastArrayFloat16(floats.data(), n);
+      wbuf.WriteFastArrayDouble32(doubles.data(), n);
+      wbuf.WriteFastArrayFloat16(floats.data(), n, &rangeFloat);
+      wbuf.WriteFastArrayDouble32(doubles.data(), n, &rangeDouble);
+
+      TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+      std::vector<Float_t> truncated(n), scaledFloats(n);
+      std::vector<Double_t> asFloats(n), scaledDoubles(n);
+      rbuf.ReadFastArrayFloat16(truncated.data(), n);
+      rbuf.ReadFastArrayDouble32(asFloats.data(), n);
+      rbuf.ReadFastArrayFloat16(scaledFloats.data(), n, &rangeFloat);
+      rbuf.ReadFastArrayDouble32(scaledDoubles.data(), n, &rangeDouble);
+      EXPECT_EQ(rbuf.Length(), wbuf.Length());
+
+      for (Int_t i = 0; i < n; ++i) {
+         // 12 bits of mantissa by default
+         EXPECT_NEAR(truncated[i], floats[i], std::abs(floats[i]) / 4096.) << "n = " << n << ", i = " << i;
+         EXPECT_EQ(asFloats[i], static_cast<Double_t>(static_cast<Float_t>(doubles[i])));
+         // 32 bits over the range
+         EXPECT_NEAR(scaledFloats[i], floats[i], 1e-5) << "n = " << n << ", i = " << i;
+         EXPECT_NEAR(scaledDoubles[i], doubles[i], 1e-8) << "n = " << n << ", i = " << i;
+      }
+   }
+}
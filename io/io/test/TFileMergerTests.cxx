@@ -2,7 +2,9 @@
 
 #include "TFileMerger.h"
 
+#include "RConfigure.h" // R__USE_IMT
 #include "TMemFile.h"
+#include "TROOT.h"
 #include "TTree.h"
 
 static void CreateATuple(TMemFile &file, const char *name, double value)
@@ -58,6 +60,109 @@ TEST(TFileMerger, CreateWithTFilePointer)
    CheckTree(result, "b_tree", 2);
 }
 
+TEST(TFileMerger, MergeWithDifferentCompression)
+{
+   TMemFile a("a.root", "RECREATE", "", 101);
+   CreateATuple(a, "the_tree", 1.);
+
+   TMemFile b("b.root", "RECREATE", "", 106);
+   CreateATuple(b, "the_tree", 2.);
+
+   TMemFile c("c.root", "RECREATE", "", 101);
+   CreateATuple(c, "the_tree", 3.);
+
+   TFileMerger merger;
+   auto output = std::unique_ptr<TMemFile>(new TMemFile("output.root", "CREATE", "", 101));
+   ASSERT_TRUE(merger.OutputFile(std::move(output)));
+
+   merger.AddFile(&a, false);
+   merger.AddFile(&b, false);
+   merger.AddFile(&c, false);
+   EXPECT_TRUE(merger.HasCompressionChange());
+   // Only the tree of b is re-compressed, the baskets of a and c are copied as they are.
+   merger.PartialMerge();
+
+   auto &result = *static_cast<TMemFile *>(merger.GetOutputFile());
+   auto t = static_cast<TTree *>(result.Get("the_tree"));
+   ASSERT_TRUE(t != nullptr);
+   EXPECT_EQ(3, t->GetEntries());
+   EXPECT_EQ(101, t->GetBranch("the_tree")->GetCompressionSettings());
+
+   double d;
+   t->SetBranchAddress("the_tree", &d);
+   for (int i = 0; i < 3; ++i) {
+      t->GetEntry(i);
+      EXPECT_EQ(i + 1., d);
+   }
+   t->ResetBranchAddresses();
+}
+
+#ifdef R__USE_IMT
+// Create a tree whose branches are spread over many small baskets, storing firstValue, firstValue + 1, ...
+static void CreateATupleWithBaskets(TMemFile &file, const char *name, int firstValue, int nEntries)
+{
+   auto mytree = new TTree(name, "A tree");
+   // See CreateATuple
+   mytree->SetImplicitMT(false);
+   mytree->SetDirectory(&file);
+   int value;
+   double half;
+   mytree->Branch("value", &value, 1000);
+   mytree->Branch("half", &half, 1000);
+   for (int i = 0; i < nEntries; ++i) {
+      value = firstValue + i;
+      half = 0.5 * value;
+      mytree->Fill();
+   }
+   file.Write();
+}
+
+TEST(TFileMerger, MergeWithDifferentCompressionMT)
+{
+   constexpr int kEntries = 2000;
+   TMemFile a("a.root", "RECREATE", "", 101);
+   CreateATupleWithBaskets(a, "the_tree", 0, kEntries);
+
+   TMemFile b("b.root", "RECREATE", "", 106);
+   CreateATupleWithBaskets(b, "the_tree", kEntries, kEntries);
+
+   TMemFile c("c.root", "RECREATE", "", 101);
+   CreateATupleWithBaskets(c, "the_tree", 2 * kEntries, kEntries);
+   // The fast cloning of the baskets of a and c is only pipelined for trees with more than one basket
+   ASSERT_LT(1, static_cast<TTree *>(a.Get("the_tree"))->GetBranch("value")->GetWriteBasket());
+
+   TFileMerger merger;
+   auto output = std::unique_ptr<TMemFile>(new TMemFile("output.root", "CREATE", "", 101));
+   ASSERT_TRUE(merger.OutputFile(std::move(output)));
+
+   merger.AddFile(&a, false);
+   merger.AddFile(&b, false);
+   merger.AddFile(&c, false);
+   EXPECT_TRUE(merger.HasCompressionChange());
+   ROOT::EnableImplicitMT();
+   merger.PartialMerge();
+   ROOT::DisableImplicitMT();
+
+   auto &result = *static_cast<TMemFile *>(merger.GetOutputFile());
+   auto t = static_cast<TTree *>(result.Get("the_tree"));
+   ASSERT_TRUE(t != nullptr);
+   EXPECT_EQ(3 * kEntries, t->GetEntries());
+   EXPECT_EQ(101, t->GetBranch("value")->GetCompressionSettings());
+   EXPECT_EQ(101, t->GetBranch("half")->GetCompressionSettings());
+
+   int value;
+   double half;
+   t->SetBranchAddress("value", &value);
+   t->SetBranchAddress("half", &half);
+   for (int i = 0; i < 3 * kEntries; ++i) {
+      t->GetEntry(i);
+      EXPECT_EQ(i, value);
+      EXPECT_EQ(0.5 * i, half);
+   }
+   t->ResetBranchAddresses();
+}
+#endif
+
 TEST(TFileMerger, CreateWithUnwritableTFilePointer)
 {
    TFileMerger merger;
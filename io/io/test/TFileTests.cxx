@@ -1,7 +1,20 @@
+#include "TBranch.h"
 #include "TFile.h"
+#include "TH1F.h"
+#include "TKey.h"
+#include "TNamed.h"
+#include "TROOT.h"
+#include "TSystem.h"
+#include "TTree.h"
 
 #include "gtest/gtest.h"
 
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
 // Tests ROOT-9857
 TEST(TFile, ReadFromSameFile)
 {
@@ -21,4 +34,233 @@ TEST(TFile, ReadFromSameFile)
    auto o2 = f2.Get(objpath);
 
    EXPECT_TRUE(o1 != o2) << "Same objects read from two different files have the same pointer!";
-}
\ No newline at end of file
+}
+
+TEST(TFile, ConcurrentRead)
+{
+   const auto filename = "ConcurrentRead.root";
+   constexpr int kNObjects = 64;
+   constexpr int kNThreads = 4;
+   {
+      TFile f(filename, "RECREATE");
+      for (int i = 0; i < kNObjects; ++i) {
+         TNamed named(("obj" + std::to_string(i)).c_str(), std::string(100 + i, 'a' + i % 26).c_str());
+         named.Write();
+      }
+   }
+
+   ROOT::EnableThreadSafety();
+   TFile f((std::string(filename) + "?concurrentread").c_str());
+   ASSERT_FALSE(f.IsZombie());
+   EXPECT_TRUE(f.TestBit(TFile::kConcurrentRead));
+   EXPECT_TRUE(f.IsConcurrentRead());
+
+   std::atomic<int> nErrors{0};
+   std::vector<std::thread> threads;
+   for (int t = 0; t < kNThreads; ++t) {
+      threads.emplace_back([&f, &nErrors, t]() {
+         for (int i = 0; i < kNObjects; ++i) {
+            const int n = (i + t * kNObjects / kNThreads) % kNObjects;
+            TKey *key = f.GetKey(("obj" + std::to_string(n)).c_str());
+            std::unique_ptr<TNamed> named(key ? dynamic_cast<TNamed *>(key->ReadObj()) : nullptr);
+            if (!named || std::string(named->GetTitle()) != std::string(100 + n, 'a' + n % 26))
+               ++nErrors;
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+
+   EXPECT_EQ(nErrors, 0);
+   EXPECT_GE(f.GetReadCalls(), kNThreads * kNObjects);
+
+   // Not applicable to files opened for writing.
+   {
+      TFile w("ConcurrentReadUpdate.root?concurrentread", "RECREATE");
+      EXPECT_FALSE(w.IsConcurrentRead());
+   }
+
+   gSystem->Unlink(filename);
+   gSystem->Unlink("ConcurrentReadUpdate.root");
+}
+
+TEST(TFile, ConcurrentReadTree)
+{
+   const auto filename = "ConcurrentReadTree.root";
+   constexpr Long64_t kNEntries = 10000;
+   constexpr int kNThreads = 4;
+   {
+      TFile f(filename, "RECREATE");
+      TTree t("tree", "tree");
+      Int_t i;
+      // Small baskets, to have many reads per thread
+      t.Branch("i", &i, "i/I", 1000);
+      for (i = 0; i < kNEntries; ++i)
+         t.Fill();
+      t.Write();
+   }
+
+   ROOT::EnableThreadSafety();
+   TFile f((std::string(filename) + "?concurrentread").c_str());
+   ASSERT_FALSE(f.IsZombie());
+   ASSERT_TRUE(f.IsConcurrentRead());
+
+   // One tree per thread, read without TTreeCache so that each basket is read by TBasket::ReadBasketBuffers
+   std::vector<std::unique_ptr<TTree>> trees;
+   for (int t = 0; t < kNThreads; ++t) {
+      TKey *key = f.GetKey("tree");
+      ASSERT_NE(nullptr, key);
+      trees.emplace_back(static_cast<TTree *>(key->ReadObj()));
+      ASSERT_NE(nullptr, trees.back());
+      trees.back()->SetCacheSize(0);
+   }
+
+   // The positions of the baskets, read all at once by TFile::ReadBuffers
+   TBranch *branch = trees[0]->GetBranch("i");
+   ASSERT_NE(nullptr, branch);
+   const Int_t nBaskets = branch->GetWriteBasket();
+   ASSERT_GT(nBaskets, kNThreads);
+   std::vector<Long64_t> pos(nBaskets);
+   std::vector<Int_t> len(branch->GetBasketBytes(), branch->GetBasketBytes() + nBaskets);
+   Long64_t totalLen = 0;
+   for (Int_t b = 0; b < nBaskets; ++b) {
+      pos[b] = branch->GetBasketSeek(b);
+      totalLen += len[b];
+   }
+   std::vector<char> expected(totalLen);
+   ASSERT_FALSE(f.ReadBuffers(expected.data(), pos.data(), len.data(), nBaskets));
+
+   std::atomic<int> nErrors{0};
+   std::vector<std::thread> threads;
+   for (int t = 0; t < kNThreads; ++t) {
+      threads.emplace_back([&, t]() {
+         TTree *tree = trees[t].get();
+         Int_t i = -1;
+         tree->SetBranchAddress("i", &i);
+         for (Long64_t e = 0; e < kNEntries; ++e) {
+            const Long64_t entry = (e + t * kNEntries / kNThreads) % kNEntries;
+            if (tree->GetEntry(entry) <= 0 || i != entry)
+               ++nErrors;
+         }
+
+         std::vector<char> buffer(totalLen);
+         if (f.ReadBuffers(buffer.data(), pos.data(), len.data(), nBaskets) || buffer != expected)
+            ++nErrors;
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+
+   EXPECT_EQ(nErrors, 0);
+
+   trees.clear();
+   f.Close();
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, ConcurrentReadTreeWithCache)
+{
+   const auto filename = "ConcurrentReadTreeWithCache.root";
+   constexpr Long64_t kNEntries = 10000;
+   constexpr int kNThreads = 4;
+   {
+      TFile f(filename, "RECREATE");
+      TTree t("tree", "tree");
+      TTree cached("cached", "cached");
+      Int_t i;
+      t.Branch("i", &i, "i/I", 1000);
+      cached.Branch("i", &i, "i/I", 1000);
+      for (i = 0; i < kNEntries; ++i) {
+         t.Fill();
+         cached.Fill();
+      }
+      t.Write();
+      cached.Write();
+   }
+
+   ROOT::EnableThreadSafety();
+   TFile f((std::string(filename) + "?concurrentread").c_str());
+   ASSERT_FALSE(f.IsZombie());
+   ASSERT_TRUE(f.IsConcurrentRead());
+
+   std::vector<std::unique_ptr<TTree>> trees;
+   for (int t = 0; t < kNThreads; ++t) {
+      TKey *key = f.GetKey("tree");
+      ASSERT_NE(nullptr, key);
+      trees.emplace_back(static_cast<TTree *>(key->ReadObj()));
+      ASSERT_NE(nullptr, trees.back());
+      trees.back()->SetCacheSize(0);
+   }
+   // The trees above have no cache, but the read cache of the file is now the TTreeCache of this other tree,
+   // which their baskets are read through while it is filled from another thread.
+   std::unique_ptr<TTree> cached(f.Get<TTree>("cached"));
+   ASSERT_NE(nullptr, cached);
+   cached->SetCacheSize(100000);
+   ASSERT_NE(nullptr, f.GetCacheRead());
+
+   std::atomic<int> nErrors{0};
+   auto readTree = [&](TTree *tree, int t) {
+      Int_t i = -1;
+      tree->SetBranchAddress("i", &i);
+      for (Long64_t e = 0; e < kNEntries; ++e) {
+         const Long64_t entry = (e + t * kNEntries / kNThreads) % kNEntries;
+         if (tree->GetEntry(entry) <= 0 || i != entry)
+            ++nErrors;
+      }
+   };
+   std::vector<std::thread> threads;
+   threads.emplace_back(readTree, cached.get(), 0);
+   for (int t = 0; t < kNThreads; ++t)
+      threads.emplace_back(readTree, trees[t].get(), t);
+   for (auto &thread : threads)
+      thread.join();
+
+   EXPECT_EQ(nErrors, 0);
+
+   trees.clear();
+   cached.reset();
+   f.Close();
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, ConcurrentGet)
+{
+   const auto filename = "ConcurrentGet.root";
+   constexpr int kNHists = 20;
+   constexpr int kNThreads = 4;
+   {
+      TFile f(filename, "RECREATE");
+      for (int h = 0; h < kNHists; ++h) {
+         TH1F hist(("h" + std::to_string(h)).c_str(), "", 10, 0, 10);
+         hist.Fill(h % 10, h + 1);
+         hist.Write();
+      }
+   }
+
+   ROOT::EnableThreadSafety();
+   TFile f((std::string(filename) + "?concurrentread").c_str());
+   ASSERT_FALSE(f.IsZombie());
+
+   // The histograms are auto-added to the file while the other threads look them up in memory
+   std::atomic<int> nErrors{0};
+   std::vector<std::thread> threads;
+   for (int t = 0; t < kNThreads; ++t) {
+      threads.emplace_back([&, t]() {
+         for (int i = 0; i < kNHists; ++i) {
+            const int h = (i + t * kNHists / kNThreads) % kNHists;
+            auto hist = f.Get<TH1F>(("h" + std::to_string(h)).c_str());
+            if (!hist || hist->GetDirectory() != &f || hist->GetBinContent(h % 10 + 1) != h + 1)
+               ++nErrors;
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+
+   EXPECT_EQ(nErrors, 0);
+   for (int h = 0; h < kNHists; ++h)
+      EXPECT_NE(nullptr, f.GetList()->FindObject(("h" + std::to_string(h)).c_str()));
+
+   f.Close();
+   gSystem->Unlink(filename);
+}
@@ -0,0 +1,168 @@
+#include "BasicArrays.h"
+
+#include "TBufferFile.h"
+#include "TClass.h"
+#include "TStreamerElement.h"
+#include "TStreamerInfo.h"
+#include "TStreamerInfoActions.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+namespace {
+
+template <typename T>
+void FillBasicArrays(T &obj)
+{
+   for (int i = 0; i < 3; ++i) {
+      obj.fBool[i] = (i % 2 == 1);
+      obj.fChar[i] = 'a' + i;
+      obj.fShort[i] = -1000 * i - 1;
+      obj.fInt[i] = -100000 * i - 1;
+      obj.fLong[i] = -2000000000L + i;
+      obj.fLong64[i] = -(1LL << 40) * i - 1;
+      obj.fFloat[i] = 1.5f * i + 0.25f;
+      obj.fDouble[i] = 1e-3 * i + 1e10;
+      obj.fUChar[i] = 200 + i;
+      obj.fUShort[i] = 60000 + i;
+      obj.fUInt[i] = 4000000000u + i;
+      obj.fULong[i] = 4000000000ul + i;
+      obj.fULong64[i] = (1ULL << 63) + i;
+      obj.fFloat16[i] = 10.f * i + 5.f;
+      obj.fDouble32[i] = 5. * i - 5.;
+      obj.fDouble32AsFloat[i] = 1. / 3. * i;
+   }
+   obj.fA = 1;
+   obj.fB = -2;
+   obj.fC = 3;
+   obj.fX = 0.1;
+   obj.fY = -0.2;
+   obj.fU = 0.25;
+   obj.fV = 0.75;
+}
+
+template <typename T>
+void CheckBasicArrays(const T &expected, const T &obj)
+{
+   for (int i = 0; i < 3; ++i) {
+      EXPECT_EQ(expected.fBool[i], obj.fBool[i]);
+      EXPECT_EQ(expected.fChar[i], obj.fChar[i]);
+      EXPECT_EQ(expected.fShort[i], obj.fShort[i]);
+      EXPECT_EQ(expected.fInt[i], obj.fInt[i]);
+      EXPECT_EQ(expected.fLong[i], obj.fLong[i]);
+      EXPECT_EQ(expected.fLong64[i], obj.fLong64[i]);
+      EXPECT_EQ(expected.fFloat[i], obj.fFloat[i]);
+      EXPECT_EQ(expected.fDouble[i], obj.fDouble[i]);
+      EXPECT_EQ(expected.fUChar[i], obj.fUChar[i]);
+      EXPECT_EQ(expected.fUShort[i], obj.fUShort[i]);
+      EXPECT_EQ(expected.fUInt[i], obj.fUInt[i]);
+      EXPECT_EQ(expected.fULong[i], obj.fULong[i]);
+      EXPECT_EQ(expected.fULong64[i], obj.fULong64[i]);
+      // Truncated to 12 and 20 bits over the range of the member
+      EXPECT_NEAR(expected.fFloat16[i], obj.fFloat16[i], 100. / (1 << 12));
+      EXPECT_NEAR(expected.fDouble32[i], obj.fDouble32[i], 20. / (1 << 20));
+      // Stored as float
+      EXPECT_FLOAT_EQ(expected.fDouble32AsFloat[i], obj.fDouble32AsFloat[i]);
+   }
+   EXPECT_EQ(expected.fA, obj.fA);
+   EXPECT_EQ(expected.fB, obj.fB);
+   EXPECT_EQ(expected.fC, obj.fC);
+   EXPECT_EQ(expected.fX, obj.fX);
+   EXPECT_EQ(expected.fY, obj.fY);
+   EXPECT_NEAR(expected.fU, obj.fU, 1. / (1 << 16));
+   EXPECT_NEAR(expected.fV, obj.fV, 1. / (1 << 16));
+}
+
+template <typename T>
+std::unique_ptr<T> RoundTrip(const T &obj)
+{
+   TBufferFile writeBuffer(TBuffer::kWrite);
+   writeBuffer.WriteObjectAny(&obj, T::Class());
+   TBufferFile readBuffer(TBuffer::kRead, writeBuffer.Length(), writeBuffer.Buffer(), kFALSE);
+   return std::unique_ptr<T>(static_cast<T *>(readBuffer.ReadObjectAny(T::Class())));
+}
+
+/// Return the number of compiled elements of the given type that regroup several consecutive members
+int CountRegrouped(TStreamerInfo &info, Int_t type)
+{
+   int n = 0;
+   for (Int_t i = 0; i < info.GetNdata(); ++i) {
+      if (info.GetType(i) == TStreamerInfo::kOffsetL + type && info.GetElem(i)->GetArrayDim() == 0)
+         ++n;
+   }
+   return n;
+}
+
+} // anonymous namespace
+
+TEST(TStreamerInfoActions, BasicArrays)
+{
+   auto info = static_cast<TStreamerInfo *>(BasicArrays::Class()->GetStreamerInfo());
+   ASSERT_NE(nullptr, info);
+   EXPECT_FALSE(info->TestBit(TVirtualStreamerInfo::kCannotOptimize));
+   EXPECT_EQ(1, CountRegrouped(*info, TStreamerInfo::kInt));
+   EXPECT_EQ(1, CountRegrouped(*info, TStreamerInfo::kDouble));
+   EXPECT_EQ(1, CountRegrouped(*info, TStreamerInfo::kDouble32));
+
+   BasicArrays obj;
+   FillBasicArrays(obj);
+   auto result = RoundTrip(obj);
+   ASSERT_NE(nullptr, result);
+   CheckBasicArrays(obj, *result);
+}
+
+TEST(TStreamerInfoActions, BasicArraysNotOptimized)
+{
+   // The streamer info is built and compiled on first use, here with the generic actions
+   TVirtualStreamerInfo::Optimize(kFALSE);
+   auto info = static_cast<TStreamerInfo *>(BasicArraysNotOptimized::Class()->GetStreamerInfo());
+   TVirtualStreamerInfo::Optimize(kTRUE);
+   ASSERT_NE(nullptr, info);
+   EXPECT_TRUE(info->TestBit(TVirtualStreamerInfo::kCannotOptimize));
+   EXPECT_EQ(0, CountRegrouped(*info, TStreamerInfo::kInt));
+
+   BasicArraysNotOptimized obj;
+   FillBasicArrays(obj);
+   auto result = RoundTrip(obj);
+   ASSERT_NE(nullptr, result);
+   CheckBasicArrays(obj, *result);
+}
+
+TEST(TStreamerInfoActions, ContiguousArrays)
+{
+   auto info = static_cast<TStreamerInfo *>(ContiguousArrays::Class()->GetStreamerInfo());
+   ASSERT_NE(nullptr, info);
+   // fScalar is regrouped into fSecond by TStreamerInfo::Compile
+   EXPECT_EQ(6, info->GetNdata());
+   // The Int_t arrays and the Double_t arrays are each streamed by a single action
+   EXPECT_EQ(3u, info->GetReadObjectWiseActions()->fActions.size());
+   EXPECT_EQ(3u, info->GetWriteObjectWiseActions()->fActions.size());
+
+   ContiguousArrays obj{};
+   obj.fFirst[0] = 1;
+   obj.fFirst[1] = 2;
+   for (int i = 0; i < 3; ++i) {
+      obj.fSecond[i] = -10 * i;
+      obj.fPosition[i] = 0.5 * i;
+      obj.fDirection[i] = -1.5 * i;
+   }
+   obj.fScalar = 42;
+   for (int i = 0; i < 4; ++i)
+      obj.fThird[i] = 100 + i;
+   obj.fWeight = 0.125f;
+
+   auto result = RoundTrip(obj);
+   ASSERT_NE(nullptr, result);
+   for (int i = 0; i < 2; ++i)
+      EXPECT_EQ(obj.fFirst[i], result->fFirst[i]);
+   for (int i = 0; i < 3; ++i) {
+      EXPECT_EQ(obj.fSecond[i], result->fSecond[i]);
+      EXPECT_EQ(obj.fPosition[i], result->fPosition[i]);
+      EXPECT_EQ(obj.fDirection[i], result->fDirection[i]);
+   }
+   EXPECT_EQ(obj.fScalar, result->fScalar);
+   for (int i = 0; i < 4; ++i)
+      EXPECT_EQ(obj.fThird[i], result->fThird[i]);
+   EXPECT_EQ(obj.fWeight, result->fWeight);
+}
@@ -6,7 +6,7 @@ def get_argparse():
 The target file is newly created and must not exist, or if -f (\"force\") is given, must not be one of the source files.\n
 """
 	EPILOGUE = """
-If Target and source files have different compression settings a slower method is used.
+If Target and source files have different compression settings a slower method is used for the Trees of the source files whose compression differs.
 For options that takes a size as argument, a decimal number of bytes is expected.
 If the number ends with a ``k'', ``m'', ``g'', etc., the number is multiplied by 1000 (1K), 1000000 (1MB), 1000000000 (1G), etc.
 If this prefix is followed by i, the number is multiplied by the traditional 1024 (1KiB), 1048576 (1MiB), 1073741824 (1GiB), etc.
@@ -20,6 +20,7 @@ The prefix can be optionally followed by B whose casing is ignored, eg. 1k, 1K,
 	parser.add_argument("-O", help="Re-optimize basket size when merging TTree")
 	parser.add_argument("-v", help="Explicitly set the verbosity level: 0 request no output, 99 is the default")
 	parser.add_argument("-j", help="Parallelize the execution in multiple processes")
+	parser.add_argument("-mt", help="Merge in this process with multiple threads: the input files are opened concurrently and the raw baskets are read ahead while they are written")
 	parser.add_argument("-dbg", help="Parallelize the execution in multiple processes in debug mode (Does not delete partial files stored inside working directory)")
 	parser.add_argument("-d", help="Carry out the partial multiprocess execution in the specified directory")
 	parser.add_argument("-n", help="Open at most 'maxopenedfiles' at once (use 0 to request to use the system maximum)")
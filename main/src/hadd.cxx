@@ -27,6 +27,10 @@
   \param -O   Re-optimize basket size when merging TTree
   \param -v   Explicitly set the verbosity level: 0 request no output, 99 is the default
   \param -j   Parallelise the execution in multiple processes
+  \param -mt  Parallelise the execution with multiple threads of this process (optionally followed by the number
+              of threads): the input files are opened concurrently and, when merging TTrees in "fast" mode, the raw
+              baskets of the inputs are read ahead while they are written to the output by a single writer, so no
+              partial files are needed
   \param -dbg  Parallelise the execution in multiple processes in debug mode (Does not delete  partial  files  stored
               inside working directory)
   \param -d   Carry out the partial multiprocess execution in the specified directory
@@ -79,6 +83,8 @@
   the merge will be done without  unzipping or unstreaming the baskets
   (i.e. direct copy of the raw byte on disk). The "fast" mode is typically
   5 times faster than the mode unzipping and unstreaming the baskets.
+  If only some of the sources have a compression level different from the
+  target, only the Trees of those sources are unzipped and re-compressed.
 
   If the option -cachesize is used, hadd will resize (or disable if 0) the
   prefetching cache use to speed up I/O operations.
@@ -103,23 +109,30 @@
 #include "THashList.h"
 #include "TKey.h"
 #include "TClass.h"
+#include "TROOT.h"
 #include "TSystem.h"
 #include "TUUID.h"
 #include "ROOT/StringConv.hxx"
 #include "snprintf.h"
 
+#include <algorithm>
 #include <string>
 #include <iostream>
 #include <fstream>
 #include <cstdlib>
 #include <climits>
+#include <map>
 #include <sstream>
+#include <vector>
 #include "haddCommandLineOptionsHelp.h"
 
 #include "TFileMerger.h"
 #ifndef R__WIN32
 #include "ROOT/TProcessExecutor.hxx"
 #endif
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -139,6 +152,8 @@ int main( int argc, char **argv )
    Bool_t keepCompressionAsIs = kFALSE;
    Bool_t useFirstInputCompression = kFALSE;
    Bool_t multiproc = kFALSE;
+   Bool_t multithread = kFALSE;
+   UInt_t nThreads = 0;
    Bool_t debug = kFALSE;
    Int_t maxopenedfiles = 0;
    Int_t verbosity = 99;
@@ -213,6 +228,33 @@ int main( int argc, char **argv )
          }
          multiproc = kTRUE;
          ++ffirst;
+      } else if (strcmp(argv[a], "-mt") == 0) {
+         // If the number of threads is not specified, let ROOT pick the default.
+         if (a + 1 != argc && argv[a + 1][0] != '-') {
+            Long_t request = 1;
+            for (char *c = argv[a + 1]; *c != '\0'; ++c) {
+               if (!isdigit(*c)) {
+                  // Not a number of threads, this is the target or a source file.
+                  request = 0;
+                  break;
+               }
+            }
+            if (request == 1) {
+               request = strtol(argv[a + 1], 0, 10);
+               if (request < kMaxInt && request >= 0) {
+                  nThreads = (UInt_t)request;
+                  ++a;
+                  ++ffirst;
+               } else {
+                  std::cerr << "Error: could not parse the number of threads to use passed after -mt: " << argv[a + 1]
+                            << ". We will use the default value (number of logical cores).\n";
+                  ++a;
+                  ++ffirst;
+               }
+            }
+         }
+         multithread = kTRUE;
+         ++ffirst;
       } else if ( strcmp(argv[a],"-cachesize=") == 0 ) {
          int size;
          static const size_t arglen = strlen("-cachesize=");
@@ -339,7 +381,7 @@ int main( int argc, char **argv )
             }
          }
          char ft[7];
-         for (int alg = 0; !useFirstInputCompression && alg <= 5; ++alg) {
+         for (int alg = 0; !useFirstInputCompression && alg <= 6; ++alg) {
             for( int j=0; j<=9; ++j ) {
                const int comp = (alg*100)+j;
                snprintf(ft,7,"-f%s%d",prefix,comp);
@@ -361,6 +403,22 @@ int main( int argc, char **argv )
       }
    }
 
+   if (multithread) {
+      if (multiproc) {
+         std::cerr << "Error: options -j and -mt can not be used together. We will merge with multiple threads.\n";
+         multiproc = kFALSE;
+      }
+#ifdef R__USE_IMT
+      ROOT::EnableImplicitMT(nThreads);
+      if (verbosity > 1) {
+         std::cout << "hadd merging with " << ROOT::GetThreadPoolSize() << " threads.\n";
+      }
+#else
+      std::cerr << "Error: this hadd was built without multi-threading support, option -mt is ignored.\n";
+      multithread = kFALSE;
+#endif
+   }
+
    gSystem->Load("libTreePlayer");
 
    const char *targetname = 0;
@@ -460,7 +518,7 @@ int main( int argc, char **argv )
          if (!keepCompressionAsIs && merger.HasCompressionChange()) {
             // Don't warn if the user any request re-optimization.
             std::cout << "hadd Sources and Target have different compression levels" << std::endl;
-            std::cout << "hadd merging will be slower" << std::endl;
+            std::cout << "hadd merging the Trees of the sources with a different compression level will be slower" << std::endl;
          }
       }
       merger.SetNotrees(noTrees);
@@ -474,30 +532,90 @@ int main( int argc, char **argv )
       return status;
    };
 
+   // Open concurrently the input files that the merger keeps open at the same time, the others are opened
+   // (sequentially) by the merger once the first ones were merged.
+   auto openInputs = [&](TFileMerger &merger, int start, int nFiles) {
+      std::map<std::string, TFile *> inputs;
+#ifdef R__USE_IMT
+      std::vector<std::string> urls;
+      const auto maxInputs = static_cast<std::size_t>(std::max(merger.GetMaxOpenedFiles() - 1, 1));
+      for (auto i = start; i < (start + nFiles) && i < argc && urls.size() < maxInputs; i++) {
+         if (argv[i] && argv[i][0] == '@') {
+            std::ifstream indirect_file(argv[i] + 1);
+            std::string line;
+            while (urls.size() < maxInputs && std::getline(indirect_file, line)) {
+               if (line.length())
+                  urls.emplace_back(line);
+            }
+         } else {
+            urls.emplace_back(argv[i]);
+         }
+      }
+      ROOT::TThreadExecutor pool;
+      auto files = pool.Map([](const std::string &url) { return TFile::Open(url.c_str(), "READ"); }, urls);
+      for (std::size_t i = 0; i < urls.size(); ++i) {
+         // Zombie files are reopened by the merger, which reports the error.
+         if (files[i] && files[i]->IsZombie()) {
+            delete files[i];
+            files[i] = nullptr;
+         }
+         if (files[i] && !inputs.emplace(urls[i], files[i]).second)
+            delete files[i]; // the same file is merged twice, we only need to open it once here
+      }
+#else
+      (void)merger;
+      (void)start;
+      (void)nFiles;
+#endif
+      return inputs;
+   };
+
    auto sequentialMerge = [&](TFileMerger &merger, int start, int nFiles) {
 
+      std::map<std::string, TFile *> inputs;
+      if (multithread) {
+         inputs = openInputs(merger, start, nFiles);
+      }
+      // Add the input file, using the file opened by openInputs if any
+      auto addFile = [&](const char *url) {
+         auto input = inputs.find(url);
+         if (input == inputs.end())
+            return merger.AddFile(url);
+         TFile *file = input->second;
+         inputs.erase(input);
+         return merger.AddAdoptFile(file);
+      };
+      auto deleteUnusedInputs = [&]() {
+         for (auto &input : inputs)
+            delete input.second;
+      };
+
       for (auto i = start; i < (start + nFiles) && i < argc; i++) {
          if (argv[i] && argv[i][0] == '@') {
             std::ifstream indirect_file(argv[i] + 1);
             if (!indirect_file.is_open()) {
                std::cerr << "hadd could not open indirect file " << (argv[i] + 1) << std::endl;
+               deleteUnusedInputs();
                return kFALSE;
             }
             while (indirect_file) {
                std::string line;
-               if (std::getline(indirect_file, line) && line.length() && !merger.AddFile(line.c_str())) {
+               if (std::getline(indirect_file, line) && line.length() && !addFile(line.c_str())) {
+                  deleteUnusedInputs();
                   return kFALSE;
                }
             }
-         } else if (!merger.AddFile(argv[i])) {
+         } else if (!addFile(argv[i])) {
             if (skip_errors) {
                std::cerr << "hadd skipping file with error: " << argv[i] << std::endl;
             } else {
                std::cerr << "hadd exiting due to error in " << argv[i] << std::endl;
+               deleteUnusedInputs();
                return kFALSE;
             }
          }
       }
+      deleteUnusedInputs();
       return mergeFiles(merger);
    };
 
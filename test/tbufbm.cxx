@@ -0,0 +1,107 @@
+// @(#)root/test:$Id$
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "TBufferFile.h"
+#include "TStreamerElement.h"
+#include "TStopwatch.h"
+#include "TString.h"
+//
+// This program benchmarks the decoding of the arrays of fundamental types
+// read by TBufferFile: big-endian integers and floating point numbers,
+// Float16_t and Double32_t (truncated mantissa or range).
+//
+// Usage: tbufbm -h                   - to print a usage info
+//        tbufbm [nelements] [ntimes] - to run the benchmarks
+//
+// parameters:
+//       nelements     - number of elements of the arrays
+//       ntimes        - number of times each array is read
+//
+// On x86-64 the vectorized decoding kernels are selected at run time. Set
+// the environment variable ROOT_IO_KERNELS to "scalar" or "ssse3" to
+// compare with the other versions.
+
+int nelements = 10000;  // Number of elements of the arrays.
+int ntimes    = 10000;  // Number of times each array is read.
+
+//_____________________________________________________________
+
+template <typename T, typename Write, typename Read>
+void Bench(const char *name, Write write, Read read)
+{
+   std::vector<T> values(nelements);
+   for (Int_t i = 0; i < nelements; i++) values[i] = (T)((i % 7) * 3.25 - 8);
+
+   TBufferFile wbuf(TBuffer::kWrite);
+   write(wbuf, values.data());
+
+   TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+   TStopwatch timer;
+   timer.Start();
+   for (Int_t i = 0; i < ntimes; i++) {
+      rbuf.SetBufferOffset(0);
+      read(rbuf, values.data());
+   }
+   timer.Stop();
+
+   Double_t mbytes = (Double_t)nelements * sizeof(T) * ntimes / (1024 * 1024);
+   Double_t cpu = timer.CpuTime();
+   Printf("%-28s %8.3f s %10.1f MB/s", name, cpu, cpu > 0 ? mbytes / cpu : 0.);
+}
+
+int main(int argc, char **argv)
+{
+   if (argc == 2 && !strcmp(argv[1], "-h")) {
+      Printf("Usage: tbufbm [nelements] [ntimes]");
+      Printf("  nelements - number of elements of the arrays");
+      Printf("  ntimes    - number of times each array is read");
+      return 1;
+   }
+   if (argc > 1) nelements = atoi(argv[1]);
+   if (argc > 2) ntimes    = atoi(argv[2]);
+   if (nelements < 1) nelements = 1;
+   if (ntimes < 1)    ntimes    = 1;
+
+   const char *kernels = getenv("ROOT_IO_KERNELS");
+   Printf("Nelements = %d , Ntimes = %d , ROOT_IO_KERNELS = %s", nelements, ntimes, kernels ? kernels : "");
+   Printf("%-28s %10s %15s", "Array", "CPU time", "Decoded");
+
+   Int_t n = nelements;
+   Bench<Short_t>("Short_t",
+                  [n](TBuffer &b, Short_t *v) { b.WriteFastArray(v, n); },
+                  [n](TBuffer &b, Short_t *v) { b.ReadFastArray(v, n); });
+   Bench<Int_t>("Int_t",
+                [n](TBuffer &b, Int_t *v) { b.WriteFastArray(v, n); },
+                [n](TBuffer &b, Int_t *v) { b.ReadFastArray(v, n); });
+   Bench<Long64_t>("Long64_t",
+                   [n](TBuffer &b, Long64_t *v) { b.WriteFastArray(v, n); },
+                   [n](TBuffer &b, Long64_t *v) { b.ReadFastArray(v, n); });
+   Bench<Float_t>("Float_t",
+                  [n](TBuffer &b, Float_t *v) { b.WriteFastArray(v, n); },
+                  [n](TBuffer &b, Float_t *v) { b.ReadFastArray(v, n); });
+   Bench<Double_t>("Double_t",
+                   [n](TBuffer &b, Double_t *v) { b.WriteFastArray(v, n); },
+                   [n](TBuffer &b, Double_t *v) { b.ReadFastArray(v, n); });
+
+   TStreamerElement float16Range("x", "[-10,10]", 0, 0, "Float16_t");
+   TStreamerElement double32Range("x", "[-10,10]", 0, 0, "Double32_t");
+   Bench<Float_t>("Float16_t (12 bits)",
+                  [n](TBuffer &b, Float_t *v) { b.WriteFastArrayFloat16(v, n); },
+                  [n](TBuffer &b, Float_t *v) { b.ReadFastArrayFloat16(v, n); });
+   Bench<Float_t>("Float16_t [-10,10]",
+                  [&](TBuffer &b, Float_t *v) { b.WriteFastArrayFloat16(v, n, &float16Range); },
+                  [&](TBuffer &b, Float_t *v) { b.ReadFastArrayFloat16(v, n, &float16Range); });
+   Bench<Double_t>("Double32_t (float)",
+                   [n](TBuffer &b, Double_t *v) { b.WriteFastArrayDouble32(v, n); },
+                   [n](TBuffer &b, Double_t *v) { b.ReadFastArrayDouble32(v, n); });
+   Bench<Double_t>("Double32_t (12 bits)",
+                   [n](TBuffer &b, Double_t *v) { std::vector<Float_t> f(v, v + n);
+                                                  b.WriteFastArrayFloat16(f.data(), n); },
+                   [n](TBuffer &b, Double_t *v) { b.ReadFastArrayWithNbits(v, n, 12); });
+   Bench<Double_t>("Double32_t [-10,10]",
+                   [&](TBuffer &b, Double_t *v) { b.WriteFastArrayDouble32(v, n, &double32Range); },
+                   [&](TBuffer &b, Double_t *v) { b.ReadFastArrayDouble32(v, n, &double32Range); });
+   return 0;
+}
@@ -11,10 +11,16 @@
 
 #include "ROOT/RDataFrame.hxx"
 #include "ROOT/RDataSource.hxx"
+#include "ROOT/RDF/ActionHelpers.hxx" // RActionImpl
+#include "ROOT/RStringView.hxx"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace arrow {
+class Array;
+class DataType;
 class Table;
 }
 
@@ -22,6 +28,60 @@ namespace ROOT {
 namespace Internal {
 namespace RDF {
 class TValueGetter;
+
+/// Appends the values of a column to an arrow array, see RArrowSnapshotHelper.
+class RArrowColumnBuilderBase {
+public:
+   virtual ~RArrowColumnBuilderBase() = default;
+   /// Append the value at the given address, which must be of the type the builder was created for.
+   virtual void Append(const void *value) = 0;
+   /// Return the array of the values appended so far and reset the builder.
+   virtual std::shared_ptr<arrow::Array> Finish() = 0;
+   virtual std::shared_ptr<arrow::DataType> GetType() const = 0;
+};
+
+/// Return a builder for a column of the given type. Throws if the type cannot be stored in an arrow array.
+std::unique_ptr<RArrowColumnBuilderBase> MakeArrowColumnBuilder(const std::string &typeName);
+
+/// The action helper of ROOT::RDF::Experimental::SnapshotToArrow.
+/// Each slot appends its entries to its own arrow arrays, which become the chunks of the columns of the output table.
+class RArrowSnapshotHelper : public ROOT::Detail::RDF::RActionImpl<RArrowSnapshotHelper> {
+public:
+   using Result_t = std::shared_ptr<arrow::Table>;
+
+private:
+   std::string fFileName;
+   std::vector<std::string> fColumnNames;
+   /// Per-slot, per-column builders
+   std::vector<std::vector<std::unique_ptr<RArrowColumnBuilderBase>>> fBuilders;
+   std::shared_ptr<Result_t> fTable;
+
+public:
+   RArrowSnapshotHelper(std::string_view fileName, const std::vector<std::string> &columnNames,
+                        const std::vector<std::string> &columnTypes, unsigned int nSlots);
+   RArrowSnapshotHelper(RArrowSnapshotHelper &&) = default;
+   RArrowSnapshotHelper(const RArrowSnapshotHelper &) = delete;
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   template <typename... ColumnTypes>
+   void Exec(unsigned int slot, const ColumnTypes &... values)
+   {
+      auto &builders = fBuilders[slot];
+      unsigned int i = 0u;
+      int expander[] = {(builders[i++]->Append(&values), 0)..., 0};
+      (void)expander;
+   }
+
+   void Initialize() {}
+
+   void Finalize();
+
+   std::string GetActionName() { return "SnapshotToArrow"; }
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fTable; }
+};
+
 } // namespace RDF
 } // namespace Internal
 
@@ -57,6 +117,45 @@ public:
 /// \param[in] table an apache::arrow table to use as a source.
 RDataFrame MakeArrowDataFrame(std::shared_ptr<arrow::Table> table, std::vector<std::string> const &columns);
 
+namespace Experimental {
+
+// clang-format off
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Store the given columns in an arrow::Table and optionally write it to an Arrow IPC file.
+/// \tparam ColumnTypes the types of the columns. If not specified, they are inferred and the action is jitted.
+/// \param[in] node any node of a computation graph.
+/// \param[in] fileName the name of the Arrow IPC (a.k.a. Feather version 2) file to write, or an empty string to only
+///            build the table in memory.
+/// \param[in] columns the names of the columns to store.
+/// \return the table, wrapped in a RResultPtr.
+///
+/// Columns of fundamental type, std::string and RVecs of fundamental type are supported. Values are appended to
+/// arrow arrays with no intermediate conversion, and arrays of collections are filled with a single copy of each
+/// RVec's contiguous buffer. The file can be read, without deserialization cost, e.g. by `pyarrow.ipc.open_file`.
+/// As for Snapshot, in multi-thread runs each thread stores its entries in separate chunks, so the order of the
+/// entries is not preserved.
+///
+/// This action is *lazy*: upon invocation of this function the calculation is booked but not executed.
+///
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// auto table = ROOT::RDF::Experimental::SnapshotToArrow(df.Filter("x > 0"), "out.arrow", {"x", "v"});
+/// std::cout << (*table)->num_rows() << std::endl;
+/// ~~~
+// clang-format on
+template <typename... ColumnTypes, typename NodeType>
+RResultPtr<std::shared_ptr<arrow::Table>>
+SnapshotToArrow(NodeType node, std::string_view fileName, const std::vector<std::string> &columns)
+{
+   std::vector<std::string> columnTypes;
+   for (const auto &column : columns)
+      columnTypes.emplace_back(node.GetColumnType(column));
+   ROOT::Internal::RDF::RArrowSnapshotHelper helper(fileName, columns, columnTypes, node.GetNSlots());
+   return node.template Book<ColumnTypes...>(std::move(helper), columns);
+}
+
+} // namespace Experimental
+
 } // namespace RDF
 
 } // namespace ROOT
@@ -46,6 +46,7 @@
 #include "ROOT/RDF/RMergeableValue.hxx"
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <stdexcept>
@@ -58,6 +59,14 @@
 /// \cond HIDDEN_SYMBOLS
 
 namespace ROOT {
+namespace Experimental {
+class RNTupleFillContext;
+class RNTupleParallelWriter;
+namespace Detail {
+class RFieldBase;
+} // namespace Detail
+} // namespace Experimental
+
 namespace Detail {
 namespace RDF {
 template <typename Helper>
@@ -150,6 +159,14 @@ public:
    ULong64_t &PartialUpdate(unsigned int slot);
 
    std::string GetActionName() { return "Count"; }
+
+   /// Create a new helper with the same configuration that writes its result into the given std::shared_ptr, used to
+   /// compute systematic variations of the result.
+   CountHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<ULong64_t> *>(newResult);
+      return CountHelper(result, fCounts.size());
+   }
 };
 
 template <typename ProxiedVal_t>
@@ -271,6 +288,12 @@ public:
    }
 
    std::string GetActionName() { return "Fill"; }
+
+   FillHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<Hist_t> *>(newResult);
+      return FillHelper(result, fNSlots);
+   }
 };
 
 extern template void FillHelper::Exec(unsigned int, const std::vector<float> &);
@@ -469,6 +492,12 @@ public:
    }
 
    std::string GetActionName() { return "FillPar"; }
+
+   FillParHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<HIST> *>(newResult);
+      return FillParHelper(result, fObjects.size());
+   }
 };
 
 class FillTGraphHelper : public ROOT::Detail::RDF::RActionImpl<FillTGraphHelper> {
@@ -539,6 +568,12 @@ public:
 
    std::string GetActionName() { return "Graph"; }
 
+   FillTGraphHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<::TGraph> *>(newResult);
+      return FillTGraphHelper(result, fGraphs.size());
+   }
+
    Result_t &PartialUpdate(unsigned int slot) { return *fGraphs[slot]; }
 };
 
@@ -795,6 +830,12 @@ public:
    ResultType &PartialUpdate(unsigned int slot) { return fMins[slot]; }
 
    std::string GetActionName() { return "Min"; }
+
+   MinHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<ResultType> *>(newResult);
+      return MinHelper(result, fMins.size());
+   }
 };
 
 // TODO
@@ -846,6 +887,12 @@ public:
    ResultType &PartialUpdate(unsigned int slot) { return fMaxs[slot]; }
 
    std::string GetActionName() { return "Max"; }
+
+   MaxHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<ResultType> *>(newResult);
+      return MaxHelper(result, fMaxs.size());
+   }
 };
 
 // TODO
@@ -910,6 +957,12 @@ public:
    ResultType &PartialUpdate(unsigned int slot) { return fSums[slot]; }
 
    std::string GetActionName() { return "Sum"; }
+
+   SumHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<ResultType> *>(newResult);
+      return SumHelper(result, fSums.size());
+   }
 };
 
 class MeanHelper : public RActionImpl<MeanHelper> {
@@ -948,6 +1001,12 @@ public:
    double &PartialUpdate(unsigned int slot);
 
    std::string GetActionName() { return "Mean"; }
+
+   MeanHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<double> *>(newResult);
+      return MeanHelper(result, fSums.size());
+   }
 };
 
 extern template void MeanHelper::Exec(unsigned int, const std::vector<float> &);
@@ -996,6 +1055,12 @@ public:
    }
 
    std::string GetActionName() { return "StdDev"; }
+
+   StdDevHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<double> *>(newResult);
+      return StdDevHelper(result, fNSlots);
+   }
 };
 
 extern template void StdDevHelper::Exec(unsigned int, const std::vector<float> &);
@@ -1528,6 +1593,85 @@ public:
    std::string GetActionName() { return "Snapshot"; }
 };
 
+/// Writes the output of an RNTuple Snapshot through an RNTupleParallelWriter. Every processing slot fills its own
+/// RNTupleFillContext, so that clusters are built and compressed concurrently and appended to the output file without
+/// going through a merging thread. The fields are created from the type names of the columns.
+class RNTupleSnapshotWriter {
+   std::unique_ptr<TFile> fOutputFile; ///< Only used in "UPDATE" mode, must outlive fWriter
+   // a shared_ptr can be destructed also where RNTupleParallelWriter is an incomplete type (builds without root7)
+   std::shared_ptr<ROOT::Experimental::RNTupleParallelWriter> fWriter;
+   std::vector<std::shared_ptr<ROOT::Experimental::RNTupleFillContext>> fFillContexts;
+   /// The top-level fields of each fill context, in the order of the columns
+   std::vector<std::vector<ROOT::Experimental::Detail::RFieldBase *>> fFields;
+
+public:
+   RNTupleSnapshotWriter(unsigned int nSlots, const std::string &fileName, const std::string &ntupleName,
+                         const ColumnNames_t &fieldNames, const std::vector<std::string> &typeNames,
+                         const RSnapshotOptions &options);
+   RNTupleSnapshotWriter(const RNTupleSnapshotWriter &) = delete;
+   RNTupleSnapshotWriter &operator=(const RNTupleSnapshotWriter &) = delete;
+   ~RNTupleSnapshotWriter();
+
+   /// Create the fill context of the slot, if it does not exist yet. Fill contexts live until Finalize().
+   void InitSlot(unsigned int slot);
+   /// Append an entry; values holds the addresses of the column values, in the order of the fields
+   void Fill(unsigned int slot, void *const *values);
+   /// Commit the remaining entries of all fill contexts and close the output
+   void Finalize();
+};
+
+/// Helper object for a Snapshot action that writes an RNTuple, both in single- and in multi-thread runs
+template <typename... ColTypes>
+class SnapshotRNTupleHelper : public RActionImpl<SnapshotRNTupleHelper<ColTypes...>> {
+   const unsigned int fNSlots;
+   const std::string fFileName;           // name of the output file name
+   const std::string fNTupleName;         // name of output ntuple
+   const RSnapshotOptions fOptions;       // struct holding options to pass down to the RNTuple writer
+   const ColumnNames_t fOutputFieldNames;
+   std::unique_ptr<RNTupleSnapshotWriter> fWriter; // created in Initialize, destroyed in Finalize
+   std::function<void()> fOnFinalize;              // invoked once the output is closed
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotRNTupleHelper(const unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                         std::string_view ntuplename, const ColumnNames_t &bnames, const RSnapshotOptions &options,
+                         std::function<void()> onFinalize)
+      : fNSlots(nSlots), fFileName(filename), fNTupleName(ntuplename), fOptions(options),
+        fOutputFieldNames(ReplaceDotWithUnderscore(bnames)), fOnFinalize(std::move(onFinalize))
+   {
+      if (!dirname.empty())
+         throw std::runtime_error("Snapshot: RNTuple output cannot be written into a TFile subdirectory.");
+   }
+   SnapshotRNTupleHelper(const SnapshotRNTupleHelper &) = delete;
+   SnapshotRNTupleHelper(SnapshotRNTupleHelper &&) = default;
+
+   void Initialize()
+   {
+      fWriter = std::make_unique<RNTupleSnapshotWriter>(fNSlots, fFileName, fNTupleName, fOutputFieldNames,
+                                                        std::vector<std::string>{TypeID2TypeName(typeid(ColTypes))...},
+                                                        fOptions);
+   }
+
+   void InitTask(TTreeReader *, unsigned int slot) { fWriter->InitSlot(slot); }
+
+   void Exec(unsigned int slot, ColTypes &... values)
+   {
+      // one extra element so that the array is never empty
+      void *const valuePtrs[] = {static_cast<void *>(&values)..., nullptr};
+      fWriter->Fill(slot, valuePtrs);
+   }
+
+   void Finalize()
+   {
+      fWriter->Finalize();
+      fWriter.reset();
+      if (fOnFinalize)
+         fOnFinalize();
+   }
+
+   std::string GetActionName() { return "Snapshot"; }
+};
+
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
 class AggregateHelper : public RActionImpl<AggregateHelper<Acc, Merge, R, T, U, MustCopyAssign>> {
@@ -15,7 +15,11 @@
 #include "RDefineBase.hxx"
 #include "RDefineReader.hxx"
 #include "RDSColumnReader.hxx"
+#include "RLoopProfiler.hxx"
+#include "RSlotBatch.hxx"
 #include "RTreeColumnReader.hxx"
+#include "RVariationBase.hxx"
+#include "RVariationReader.hxx"
 
 #include <ROOT/RDataSource.hxx>
 #include <ROOT/TypeTraits.hxx>
@@ -25,7 +29,9 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <typeinfo> // for typeid
 #include <vector>
 
@@ -36,10 +42,68 @@ namespace RDF {
 using namespace ROOT::TypeTraits;
 namespace RDFDetail = ROOT::Detail::RDF;
 
+template <typename T>
+std::unique_ptr<RDFDetail::RColumnReaderBase>
+MakeTreeColumnReader(TTreeReader &r, const std::string &colName, std::true_type /* isBulkReadable */)
+{
+   return std::unique_ptr<RDFDetail::RColumnReaderBase>(new RTreeBulkColumnReader<T>(r, colName));
+}
+
+template <typename T>
+std::unique_ptr<RDFDetail::RColumnReaderBase>
+MakeTreeColumnReader(TTreeReader &r, const std::string &colName, std::false_type /* isBulkReadable */)
+{
+   return std::unique_ptr<RDFDetail::RColumnReaderBase>(new RTreeColumnReader<T>(r, colName));
+}
+
+/// Wrap the reader so that the time it spends reading is measured, if the event loop is profiled
+inline std::unique_ptr<RDFDetail::RColumnReaderBase>
+MakeProfiledReader(std::unique_ptr<RDFDetail::RColumnReaderBase> reader, RLoopProfiler *profiler, unsigned int slot)
+{
+   if (profiler == nullptr)
+      return reader;
+   return std::unique_ptr<RDFDetail::RColumnReaderBase>(new RProfiledColumnReader(std::move(reader), *profiler, slot));
+}
+
+/// Columns of these types can be read in batched mode, which requires copying their values, see RSlotBatch
+template <typename T>
+struct IsBatchReadable
+   : std::integral_constant<bool, std::is_default_constructible<T>::value && std::is_copy_assignable<T>::value> {
+};
+
+template <typename T>
+std::unique_ptr<RDFDetail::RColumnReaderBase>
+MakeBatchReader(std::unique_ptr<RDFDetail::RColumnReaderBase> reader, RSlotBatch &batch, const std::string &,
+                std::true_type /* isBatchReadable */)
+{
+   return std::unique_ptr<RDFDetail::RColumnReaderBase>(new RBatchColumnReader<T>(std::move(reader), batch));
+}
+
+template <typename T>
+std::unique_ptr<RDFDetail::RColumnReaderBase>
+MakeBatchReader(std::unique_ptr<RDFDetail::RColumnReaderBase>, RSlotBatch &, const std::string &colName,
+                std::false_type /* isBatchReadable */)
+{
+   throw std::runtime_error("RDataFrame: column \"" + colName +
+                            "\" cannot be read in batched mode because its values cannot be copied. Batched "
+                            "execution must be disabled for this computation graph.");
+}
+
+/// Wrap the reader so that it stores the values of all entries of a batch, if the task runs in batched mode
+template <typename T>
+std::unique_ptr<RDFDetail::RColumnReaderBase>
+MakeBatchedReader(std::unique_ptr<RDFDetail::RColumnReaderBase> reader, RSlotBatch *batch, const std::string &colName)
+{
+   if (batch == nullptr)
+      return reader;
+   return MakeBatchReader<T>(std::move(reader), *batch, colName, IsBatchReadable<T>{});
+}
+
 template <typename T>
 std::unique_ptr<RDFDetail::RColumnReaderBase>
 MakeColumnReader(unsigned int slot, RDFDetail::RDefineBase *define, TTreeReader *r, ROOT::RDF::RDataSource *ds,
-                 const std::vector<void *> *DSValuePtrsPtr, const std::string &colName)
+                 const std::vector<void *> *DSValuePtrsPtr, const std::string &colName, RLoopProfiler *profiler,
+                 RSlotBatch *batch)
 {
    using Ret_t = std::unique_ptr<RDFDetail::RColumnReaderBase>;
 
@@ -51,28 +115,43 @@ MakeColumnReader(unsigned int slot, RDFDetail::RDefineBase *define, TTreeReader
    if (DSValuePtrsPtr != nullptr) {
       // reading from a RDataSource with the old column reader interface
       auto &DSValuePtrs = *DSValuePtrsPtr;
-      return Ret_t(new RDSColumnReader<T>(DSValuePtrs[slot]));
+      return MakeBatchedReader<T>(Ret_t(new RDSColumnReader<T>(DSValuePtrs[slot])), batch, colName);
    }
 
    if (ds != nullptr) {
       // reading from a RDataSource with the new column reader interface
-      return ds->GetColumnReaders(slot, colName, typeid(T));
+      return MakeBatchedReader<T>(MakeProfiledReader(ds->GetColumnReaders(slot, colName, typeid(T)), profiler, slot),
+                                  batch, colName);
    }
 
    // reading from a TTree
-   return Ret_t(new RTreeColumnReader<T>(*r, colName));
+   return MakeBatchedReader<T>(
+      MakeProfiledReader(MakeTreeColumnReader<T>(*r, colName, IsBulkReadable<T>{}), profiler, slot), batch, colName);
 }
 
 template <typename T>
 std::unique_ptr<RDFDetail::RColumnReaderBase>
 MakeColumnReadersHelper(unsigned int slot, RDFDetail::RDefineBase *define,
                         const std::map<std::string, std::vector<void *>> &DSValuePtrsMap, TTreeReader *r,
-                        ROOT::RDF::RDataSource *ds, const std::string &colName)
+                        ROOT::RDF::RDataSource *ds, const std::string &colName, const RBookedDefines &customCols,
+                        const std::string &variation, RLoopProfiler *profiler, RSlotBatch *batch)
 {
+   if (variation != "nominal") {
+      // varied values take precedence over the nominal ones, be it a varied column or a column defined from one
+      if (auto *variationPtr = customCols.FindVariation(colName, variation)) {
+         return std::unique_ptr<RDFDetail::RColumnReaderBase>(
+            new RVariationReader(slot, *variationPtr, variation, typeid(T)));
+      }
+      if (define != nullptr) {
+         if (auto *variedDefine = define->GetVariedDefine(variation))
+            define = variedDefine;
+      }
+   }
+
    const auto DSValuePtrsIt = DSValuePtrsMap.find(colName);
    const std::vector<void *> *DSValuePtrsPtr = DSValuePtrsIt != DSValuePtrsMap.end() ? &DSValuePtrsIt->second : nullptr;
    R__ASSERT(define != nullptr || r != nullptr || DSValuePtrsPtr != nullptr || ds != nullptr);
-   return MakeColumnReader<T>(slot, define, r, ds, DSValuePtrsPtr, colName);
+   return MakeColumnReader<T>(slot, define, r, ds, DSValuePtrsPtr, colName, profiler, batch);
 }
 
 /// This type aggregates some of the arguments passed to InitColumnReaders.
@@ -85,14 +164,19 @@ struct RColumnReadersInfo {
    const bool *fIsDefine;
    const std::map<std::string, std::vector<void *>> &fDSValuePtrsMap;
    ROOT::RDF::RDataSource *fDataSource;
+   RLoopProfiler *fProfiler = nullptr; ///< Non-null if the reading times must be measured, see RLoopProfiler
+   RSlotBatch *fBatch = nullptr;       ///< Non-null if the task runs in batched mode, see RSlotBatch
 };
 
 /// Create a group of column readers, one per type in the parameter pack.
 /// colInfo.fColNames and colInfo.fIsDefine are expected to have size equal to the parameter pack, and elements ordered
 /// accordingly, i.e. fIsDefine[0] refers to fColNames[0] which is of type "ColTypes[0]".
+/// If `variation` is a "variationName:tag" string, the readers of the columns that depend on that variation return
+/// the varied values, see RInterface::Vary.
 template <typename... ColTypes>
 std::array<std::unique_ptr<RDFDetail::RColumnReaderBase>, sizeof...(ColTypes)>
-MakeColumnReaders(unsigned int slot, TTreeReader *r, TypeList<ColTypes...>, const RColumnReadersInfo &colInfo)
+MakeColumnReaders(unsigned int slot, TTreeReader *r, TypeList<ColTypes...>, const RColumnReadersInfo &colInfo,
+                  const std::string &variation = "nominal")
 {
    // see RColumnReadersInfo for why we pass these arguments like this rather than directly as function arguments
    const auto &colNames = colInfo.fColNames;
@@ -100,19 +184,25 @@ MakeColumnReaders(unsigned int slot, TTreeReader *r, TypeList<ColTypes...>, cons
    const bool *isDefine = colInfo.fIsDefine;
    const auto &DSValuePtrsMap = colInfo.fDSValuePtrsMap;
    auto *ds = colInfo.fDataSource;
+   auto *profiler = colInfo.fProfiler;
+   auto *batch = colInfo.fBatch;
 
    const auto &customColMap = customCols.GetColumns();
 
    int i = -1;
    std::array<std::unique_ptr<RDFDetail::RColumnReaderBase>, sizeof...(ColTypes)> ret{
       {{(++i, MakeColumnReadersHelper<ColTypes>(slot, isDefine[i] ? customColMap.at(colNames[i]).get() : nullptr,
-                                                DSValuePtrsMap, r, ds, colNames[i]))}...}};
+                                                DSValuePtrsMap, r, ds, colNames[i], customCols, variation, profiler,
+                                                batch))}...}};
    return ret;
 
    // avoid bogus "unused variable" warnings
    (void)ds;
+   (void)profiler;
+   (void)batch;
    (void)slot;
    (void)r;
+   (void)variation;
 }
 
 } // namespace RDF
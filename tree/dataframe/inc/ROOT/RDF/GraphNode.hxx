@@ -42,6 +42,7 @@ private:
    unsigned int fCounter; ///< Nodes may share the same name (e.g. Filter). To manage this situation in dot, each node
    ///< is represented by an unique id.
    std::string fName, fColor, fShape;
+   std::string fProfileSummary; ///< Statistics of the profiled event loops, empty if profiling was not enabled
    std::vector<std::string>
       fDefinedColumns; ///< Columns defined up to this node. By checking the defined columns between two consecutive
                        ///< nodes, it is possible to know if there was some Define in between.
@@ -97,6 +98,14 @@ public:
 
    bool GetIsNew() { return fIsNew; }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Sets the statistics of the profiled event loops to be shown with the node name
+   void SetProfileSummary(const std::string &summary) { fProfileSummary = summary; }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the label of the node in the dot representation
+   std::string GetLabel() const { return fProfileSummary.empty() ? fName : fName + "\n" + fProfileSummary; }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Gives a different shape based on the node type
    void SetRoot()
@@ -152,6 +152,22 @@ private:
    }
 
 public:
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the RLoopManager at the root of the computation graph the node belongs to
+   template <typename Proxied, typename DataSource>
+   static RLoopManager *GetLoopManager(const RInterface<Proxied, DataSource> &node)
+   {
+      return node.GetLoopManager();
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the RLoopManager at the root of the computation graph the result belongs to
+   template <typename T>
+   static RLoopManager *GetLoopManager(const RResultPtr<T> &resultPtr)
+   {
+      return resultPtr.fLoopManager;
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Functor. Initializes the static members and delegates the work to the right override.
    /// \tparam NodeType the RNode from which the graph has to be drawn
@@ -235,8 +235,34 @@ struct SnapshotHelperArgs {
    std::string fTreeName;
    std::vector<std::string> fOutputColNames;
    ROOT::RDF::RSnapshotOptions fOptions;
+   /// Invoked by RNTuple Snapshots once the output is written, see RInterface::MakeSnapshotDataFrame
+   std::function<void()> fOnFinalize;
 };
 
+/// Create an RNTupleDS that reads the given ntuple. Throws if ROOT was built without RNTuple support.
+std::unique_ptr<ROOT::RDF::RDataSource> MakeNTupleDataSource(const std::string &ntupleName, const std::string &fileName);
+
+/// The name of the TTree that stores the columns cached by RInterface::DiskCache
+constexpr const char *kDiskCacheTreeName = "rdfcache";
+
+/// Return the path of the on-disk cache of the dataset with the given description, creating cacheDir if needed.
+std::string GetDiskCacheFileName(const std::string &description, std::string_view cacheDir);
+
+/// Return the path of the file that a new on-disk cache is written to before CommitDiskCache moves it into place.
+std::string GetDiskCacheTmpFileName(const std::string &fileName);
+
+/// Return true if the file exists and is a complete on-disk cache of the dataset with the given description.
+bool IsValidDiskCache(const std::string &fileName, const std::string &description);
+
+/// Store the description of the cached dataset in the freshly written cache file, then atomically move the file to
+/// its final path, so that concurrent or interrupted jobs never see an incomplete cache.
+void CommitDiskCache(const std::string &tmpFileName, const std::string &fileName, const std::string &description);
+
+/// Compile the Filter and Define expressions that were jitted since the last call and are not in the persistent jit
+/// cache yet, and store them in the cache. Return the number of expressions stored.
+/// See ROOT::RDF::Experimental::SetJitCacheDir.
+unsigned int StoreJittedExprsInCache();
+
 // Snapshot action
 template <typename... ColTypes, typename PrevNodeType>
 std::unique_ptr<RActionBase>
@@ -251,7 +277,14 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
    const auto &options = snapHelperArgs->fOptions;
 
    std::unique_ptr<RActionBase> actionPtr;
-   if (!ROOT::IsImplicitMTEnabled()) {
+   if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+      // single- and multi-thread RNTuple snapshot
+      using Helper_t = SnapshotRNTupleHelper<ColTypes...>;
+      using Action_t = RAction<Helper_t, PrevNodeType>;
+      actionPtr.reset(new Action_t(
+         Helper_t(nSlots, filename, dirname, treename, outputColNames, options, snapHelperArgs->fOnFinalize), colNames,
+         prevNode, defines));
+   } else if (!ROOT::IsImplicitMTEnabled()) {
       // single-thread snapshot
       using Helper_t = SnapshotHelper<ColTypes...>;
       using Action_t = RAction<Helper_t, PrevNodeType>;
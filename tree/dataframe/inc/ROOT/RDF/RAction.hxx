@@ -17,10 +17,13 @@
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t, IsInternalColumn
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RSlotBatch.hxx"
 
+#include <algorithm>
 #include <array>
 #include <cstddef> // std::size_t
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -61,10 +64,14 @@ class R__CLING_PTRCHECK(off) RAction : public RActionBase {
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
 
+   /// The "variationName:tag" of the inputs this action reads, "nominal" for the nominal values
+   const std::string fVariation;
+
 public:
-   RAction(Helper &&h, const ColumnNames_t &columns, std::shared_ptr<PrevDataFrame> pd, const RBookedDefines &defines)
+   RAction(Helper &&h, const ColumnNames_t &columns, std::shared_ptr<PrevDataFrame> pd, const RBookedDefines &defines,
+           const std::string &variation = "nominal")
       : RActionBase(pd->GetLoopManagerUnchecked(), columns, defines), fHelper(std::forward<Helper>(h)),
-        fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr), fValues(GetNSlots()), fIsDefine()
+        fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr), fValues(GetNSlots()), fIsDefine(), fVariation(variation)
    {
       const auto nColumns = columns.size();
       const auto &customCols = GetDefines();
@@ -91,11 +98,15 @@ public:
 
    void InitSlot(TTreeReader *r, unsigned int slot) final
    {
+      auto *batch = fLoopManager->GetSlotBatch(slot);
       for (auto &bookedBranch : GetDefines().GetColumns())
-         bookedBranch.second->InitSlot(r, slot);
+         bookedBranch.second->InitSlot(r, slot, batch);
+      for (auto &variation : GetDefines().GetVariations())
+         variation->InitSlot(r, slot, batch);
       RDFInternal::RColumnReadersInfo info{RActionBase::GetColumnNames(), RActionBase::GetDefines(), fIsDefine.data(),
-                                           fLoopManager->GetDSValuePtrs(), fLoopManager->GetDataSource()};
-      fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
+                                           fLoopManager->GetDSValuePtrs(), fLoopManager->GetDataSource(), fProfiler,
+                                           batch};
+      fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fHelper.InitTask(r, slot);
    }
 
@@ -109,8 +120,24 @@ public:
    void Run(unsigned int slot, Long64_t entry) final
    {
       // check if entry passes all filters
-      if (fPrevData.CheckFilters(slot, entry))
+      if (fPrevData.CheckFilters(slot, entry)) {
+         RLoopProfiler::RNodeScope profile(fProfiler, fProfileId, slot);
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+      }
+   }
+
+   void RunBatch(unsigned int slot, RSlotBatch &batch) final
+   {
+      const char *mask = fPrevData.CheckFiltersBatch(slot, batch);
+      UpdateBatchInputs(slot, batch, mask, ColumnTypes_t{}, TypeInd_t{});
+      RBatchCurrentGuard guard(batch);
+      const auto size = batch.GetSize();
+      for (auto i = 0u; i < size; ++i) {
+         if (mask[i]) {
+            batch.SetCurrent(i);
+            CallExec(slot, batch.GetEntry(i), ColumnTypes_t{}, TypeInd_t{});
+         }
+      }
    }
 
    void TriggerChildrenCount() final { fPrevData.IncrChildrenCount(); }
@@ -120,6 +147,8 @@ public:
    {
       for (auto &column : GetDefines().GetColumns())
          column.second->FinaliseSlot(slot);
+      for (auto &variation : GetDefines().GetVariations())
+         variation->FinaliseSlot(slot);
       for (auto &v : fValues[slot])
          v.reset();
       fHelper.CallFinalizeTask(slot);
@@ -145,15 +174,49 @@ public:
 
       thisNode->AddDefinedColumns(GetDefines().GetNames());
       thisNode->SetAction(HasRun());
+      if (fProfiler != nullptr)
+         thisNode->SetProfileSummary(fProfiler->GetNodeSummary(fProfileId));
       upmostNode->SetPrevNode(prevNode);
       return thisNode;
    }
 
+   void SetProfiler(RLoopProfiler &profiler) final
+   {
+      std::string name = fHelper.GetActionName();
+      if (fVariation != "nominal")
+         name += " [" + fVariation + "]";
+      fProfiler = &profiler;
+      fProfileId = profiler.RegisterNode(RLoopProfiler::ENodeKind::kAction, name, this);
+      GetDefines().SetProfiler(profiler);
+   }
+
    /// This method is invoked to update a partial result during the event loop, right before passing the result to a
    /// user-defined callback registered via RResultPtr::RegisterCallback
    void *PartialUpdate(unsigned int slot) final { return PartialUpdateImpl(slot); }
 
+   std::vector<std::string> GetVariations() const final
+   {
+      auto variations = fPrevData.GetVariations();
+      RDFInternal::AddUnique(variations, GetDefines().GetVariationDeps(GetColumnNames()));
+      return variations;
+   }
+
+   std::unique_ptr<RActionBase> MakeVariedAction(const std::string &variation, void *newResult) final
+   {
+      return MakeVariedActionImpl(0, variation, newResult);
+   }
+
 private:
+   /// Evaluate the Defines read by this action for all the selected entries of the batch at once
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateBatchInputs(unsigned int slot, RSlotBatch &batch, const char *mask, TypeList<ColTypes...>,
+                          std::index_sequence<S...>)
+   {
+      using expander = int[];
+      (void)expander{0, ((void)fValues[slot][S]->template GetBatch<ColTypes>(batch, mask), 0)...};
+      (void)slot; // avoid "unused parameter" warnings
+   }
+
    // this overload is SFINAE'd out if Helper does not implement `PartialUpdate`
    // the template parameter is required to defer instantiation of the method to SFINAE time
    template <typename H = Helper>
@@ -164,6 +227,30 @@ private:
 
    // this one is always available but has lower precedence thanks to `...`
    void *PartialUpdateImpl(...) { throw std::runtime_error("This action does not support callbacks!"); }
+
+   // this overload is SFINAE'd out if Helper does not implement `MakeNew`
+   // the int/long tag makes it preferred to the overload below when both are viable
+   template <typename H = Helper>
+   auto MakeVariedActionImpl(int, const std::string &variation, void *newResult)
+      -> decltype(std::declval<H>().MakeNew(newResult), std::unique_ptr<RActionBase>())
+   {
+      // upstream filters that depend on the variation are varied as well, the others are shared with the nominal
+      std::shared_ptr<RNodeBase> prevNode = fPrevDataPtr;
+      const auto prevVariations = fPrevData.GetVariations();
+      if (std::find(prevVariations.begin(), prevVariations.end(), RDFInternal::GetVariationName(variation)) !=
+          prevVariations.end()) {
+         prevNode = fPrevData.GetVariedFilter(variation);
+      }
+      GetDefines().MakeVariedDefines(GetColumnNames(), variation);
+
+      return std::unique_ptr<RActionBase>(new RAction<Helper, RNodeBase, ColumnTypes_t>(
+         fHelper.MakeNew(newResult), GetColumnNames(), std::move(prevNode), GetDefines(), variation));
+   }
+
+   std::unique_ptr<RActionBase> MakeVariedActionImpl(long, const std::string &, void *)
+   {
+      throw std::logic_error("RDataFrame: this action does not support systematic variations.");
+   }
 };
 
 } // namespace RDF
@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ROOT {
 
@@ -34,6 +35,8 @@ namespace GraphDrawing {
 class GraphNode;
 }
 
+class RSlotBatch;
+
 using namespace ROOT::Detail::RDF;
 
 class RActionBase {
@@ -41,6 +44,8 @@ protected:
    /// A raw pointer to the RLoopManager at the root of this functional graph.
    /// Never null: children nodes have shared ownership of parent nodes in the graph.
    RLoopManager *fLoopManager;
+   RLoopProfiler *fProfiler = nullptr; ///< Non-owning ptr to the profiler of the event loop, if any
+   unsigned int fProfileId = 0;        ///< The identifier of this action in fProfiler
 
 private:
    const unsigned int fNSlots; ///< Number of thread slots used by this node.
@@ -57,9 +62,12 @@ public:
 
    const ColumnNames_t &GetColumnNames() const { return fColumnNames; }
    RBookedDefines &GetDefines() { return fDefines; }
+   const RBookedDefines &GetDefines() const { return fDefines; }
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
+   /// Run the action on the entries of the current batch of the slot, see RSlotBatch.
+   virtual void RunBatch(unsigned int slot, RSlotBatch &batch) = 0;
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
@@ -75,11 +83,21 @@ public:
 
    virtual std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> GetGraph() = 0;
 
+   /// Register this action and the columns it defines with the profiler of the event loop, see RLoopProfiler.
+   virtual void SetProfiler(RLoopProfiler &profiler) = 0;
+
    /**
       Retrieve a wrapper to the result of the action that knows how to merge
       with others of the same type.
    */
    virtual std::unique_ptr<RMergeableValueBase> GetMergeableValue() const = 0;
+
+   /// Return the names of the systematic variations that the result of this action depends on
+   virtual std::vector<std::string> GetVariations() const = 0;
+
+   /// Return a new action that computes the result for the given "variationName:tag" and writes it into newResult,
+   /// a type-erased pointer to a std::shared_ptr to the result type.
+   virtual std::unique_ptr<RActionBase> MakeVariedAction(const std::string &variation, void *newResult) = 0;
 };
 } // namespace RDF
 } // namespace Internal
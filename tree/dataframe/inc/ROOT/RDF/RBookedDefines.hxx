@@ -30,6 +30,9 @@ namespace RDF {
 
 namespace RDFDetail = ROOT::Detail::RDF;
 
+class RLoopProfiler;
+class RVariationBase;
+
 /**
  * \class ROOT::Internal::RDF::RBookedDefines
  * \ingroup dataframe
@@ -38,15 +41,18 @@ namespace RDFDetail = ROOT::Detail::RDF;
 
 class RBookedDefines {
    using RDefineBasePtrMap_t = std::map<std::string, std::shared_ptr<RDFDetail::RDefineBase>>;
+   using RVariationBasePtrs_t = std::vector<std::shared_ptr<RVariationBase>>;
    using ColumnNames_t = std::vector<std::string>;
 
    // Since RBookedDefines is meant to be an immutable, copy-on-write object, the actual values are set as const
    using RDefineBasePtrMapPtr_t = std::shared_ptr<const RDefineBasePtrMap_t>;
+   using RVariationBasePtrsPtr_t = std::shared_ptr<const RVariationBasePtrs_t>;
    using ColumnNamesPtr_t = std::shared_ptr<const ColumnNames_t>;
 
 private:
    RDefineBasePtrMapPtr_t fDefines;
    ColumnNamesPtr_t fDefinesNames;  // also abused to keep track of aliases for each branch of the computation graph
+   RVariationBasePtrsPtr_t fVariations; ///< The systematic variations booked with Vary
 
 public:
    ////////////////////////////////////////////////////////////////////////////
@@ -64,7 +70,7 @@ public:
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates the object starting from the provided maps
    RBookedDefines(RDefineBasePtrMapPtr_t defines, ColumnNamesPtr_t defineNames)
-      : fDefines(defines), fDefinesNames(defineNames)
+      : fDefines(defines), fDefinesNames(defineNames), fVariations(std::make_shared<RVariationBasePtrs_t>())
    {
    }
 
@@ -72,7 +78,8 @@ public:
    /// \brief Creates a new wrapper with empty maps
    RBookedDefines()
       : fDefines(std::make_shared<RDefineBasePtrMap_t>()),
-        fDefinesNames(std::make_shared<ColumnNames_t>())
+        fDefinesNames(std::make_shared<ColumnNames_t>()),
+        fVariations(std::make_shared<RVariationBasePtrs_t>())
    {
    }
 
@@ -100,6 +107,37 @@ public:
    /// in each branch of the computation graph.
    /// Internally it recreates the vector with the new name, and swaps it with the old one.
    void AddName(std::string_view name);
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the list of the pointers to the systematic variations
+   const RVariationBasePtrs_t &GetVariations() const { return *fVariations; }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Add a new systematic variation of a column.
+   /// Internally it recreates the list with the new variation, and swaps it with the old one.
+   void AddVariation(const std::shared_ptr<RVariationBase> &variation);
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return the variation of column colName that provides the given "variationName:tag", or nullptr.
+   RVariationBase *FindVariation(const std::string &colName, const std::string &variation) const;
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return the names of the systematic variations that the given columns depend on.
+   /// A column depends on a variation if it is varied itself or if it is a defined column that depends on it.
+   ColumnNames_t GetVariationDeps(const ColumnNames_t &columns) const;
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Create the varied clones of the defined columns among the given columns that depend on the given
+   /// "variationName:tag".
+   void MakeVariedDefines(const ColumnNames_t &columns, const std::string &variation) const;
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Append the descriptions of the defined columns among the given columns, see RDefineBase::AddDescription.
+   void AddDescriptions(const ColumnNames_t &columns, std::string &description) const;
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register the defined columns with the profiler of the event loop, see RLoopProfiler.
+   void SetProfiler(RLoopProfiler &profiler) const;
 };
 
 } // Namespace RDF
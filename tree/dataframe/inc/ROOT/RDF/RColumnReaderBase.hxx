@@ -14,6 +14,12 @@
 #include <Rtypes.h>
 
 namespace ROOT {
+namespace Internal {
+namespace RDF {
+class RSlotBatch;
+}
+} // namespace Internal
+
 namespace Detail {
 namespace RDF {
 
@@ -38,8 +44,19 @@ public:
       return *static_cast<T *>(GetImpl(entry));
    }
 
+   /// Return the address of the contiguous values of the entries of the current batch, or nullptr if this reader
+   /// cannot provide them, see ROOT::Internal::RDF::RSlotBatch. Only the values of the entries selected by `mask` are
+   /// guaranteed to be valid.
+   /// 	param T The column type
+   template <typename T>
+   T *GetBatch(ROOT::Internal::RDF::RSlotBatch &batch, const char *mask)
+   {
+      return static_cast<T *>(GetBatchImpl(batch, mask));
+   }
+
 private:
    virtual void *GetImpl(Long64_t entry) = 0;
+   virtual void *GetBatchImpl(ROOT::Internal::RDF::RSlotBatch &, const char *) { return nullptr; }
 };
 
 } // namespace RDF
@@ -14,15 +14,24 @@
 #include "ROOT/RDF/ColumnReaderUtils.hxx"
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/RSlotBatch.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RIntegerSequence.hxx"
 #include "ROOT/RStringView.hxx"
+#include "ROOT/RVec.hxx"
 #include "ROOT/TypeTraits.hxx"
 #include "RtypesCore.h"
 
+#include <algorithm>
 #include <array>
 #include <deque>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
 #include <type_traits>
+#include <typeinfo>
 #include <vector>
 
 class TTreeReader;
@@ -58,10 +67,22 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    // Avoid instantiating vector<bool> as `operator[]` returns temporaries in that case. Use std::deque instead.
    using ValuesPerSlot_t =
       typename std::conditional<std::is_same<ret_type, bool>::value, std::deque<ret_type>, std::vector<ret_type>>::type;
+   /// Only columns of fundamental types are evaluated in batches, see RSlotBatch
+   using IsBatched_t = std::integral_constant<bool, std::is_arithmetic<ret_type>::value>;
+   using BatchValue_t = typename std::conditional<IsBatched_t::value, ret_type, char>::type;
+
+   /// The values of the entries of the current batch of a slot
+   struct RBatchValues {
+      std::unique_ptr<BatchValue_t[]> fValues; ///< Not a std::vector, which does not store booleans contiguously
+      ROOT::RVec<char> fIsComputed;            ///< Whether fValues holds the value of the corresponding entry
+      unsigned int fNComputed = 0;             ///< The number of entries for which fValues holds the value
+      ULong64_t fBatchId = ULong64_t(-1);      ///< The identifier of the batch fValues refers to
+   };
 
    F fExpression;
    const ColumnNames_t fColumnNames;
    ValuesPerSlot_t fLastResults;
+   std::vector<RBatchValues> fBatchValues;
 
    /// Column readers per slot and per input column
    std::vector<std::array<std::unique_ptr<RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
@@ -69,6 +90,29 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
 
+   /// The "variationName:tag" of the inputs this column reads, "nominal" for the nominal values
+   const std::string fVariation;
+
+   /// The clones of this column that read varied inputs, per "variationName:tag"
+   std::map<std::string, std::unique_ptr<RDefineBase>> fVariedDefines;
+
+   // the varied clones work on copies of the expression
+   template <typename G = F>
+   typename std::enable_if<std::is_copy_constructible<G>::value, std::unique_ptr<RDefineBase>>::type
+   CloneForVariation(const std::string &variation)
+   {
+      return std::unique_ptr<RDefineBase>(new RDefine(fName, fType, fExpression, fColumnNames, fNSlots, fDefines,
+                                                      fDSValuePtrs, fDataSource, variation));
+   }
+
+   template <typename G = F>
+   typename std::enable_if<!std::is_copy_constructible<G>::value, std::unique_ptr<RDefineBase>>::type
+   CloneForVariation(const std::string &)
+   {
+      throw std::runtime_error("RDataFrame: column \"" + fName +
+                               "\" depends on a systematic variation but its expression cannot be copied.");
+   }
+
    template <typename... ColTypes, std::size_t... S>
    void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
    {
@@ -100,13 +144,107 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
       (void)entry;
    }
 
+   // evaluate the expression for the entry at position idx of the batch, reading the inputs from contiguous values
+   template <typename... ColTypes>
+   ret_type EvalBatchEntry(unsigned int, Long64_t, unsigned int idx, NoneTag, ColTypes *... values)
+   {
+      (void)idx; // avoid "unused parameter" warnings for expressions without inputs
+      return fExpression(values[idx]...);
+   }
+
+   template <typename... ColTypes>
+   ret_type EvalBatchEntry(unsigned int slot, Long64_t, unsigned int idx, SlotTag, ColTypes *... values)
+   {
+      (void)idx;
+      return fExpression(slot, values[idx]...);
+   }
+
+   template <typename... ColTypes>
+   ret_type EvalBatchEntry(unsigned int slot, Long64_t entry, unsigned int idx, SlotAndEntryTag, ColTypes *... values)
+   {
+      (void)idx;
+      return fExpression(slot, entry, values[idx]...);
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateBatchHelper(unsigned int slot, RDFInternal::RSlotBatch &batch, const char *mask, TypeList<ColTypes...>,
+                          std::index_sequence<S...>)
+   {
+      auto &batchValues = fBatchValues[slot];
+      const auto size = batch.GetSize();
+      if (batchValues.fBatchId != batch.GetId()) {
+         std::fill(batchValues.fIsComputed.begin(), batchValues.fIsComputed.begin() + size, 0);
+         batchValues.fNComputed = 0;
+         batchValues.fBatchId = batch.GetId();
+      }
+      if (batchValues.fNComputed == size)
+         return;
+
+      auto *values = batchValues.fValues.get();
+      auto *isComputed = batchValues.fIsComputed.data();
+      const auto inputs = std::make_tuple(fValues[slot][S]->template GetBatch<ColTypes>(batch, mask)...);
+      const std::array<bool, sizeof...(S)> hasInput{{(std::get<S>(inputs) != nullptr)...}};
+      if (std::find(hasInput.begin(), hasInput.end(), false) != hasInput.end()) {
+         // some inputs are not available as contiguous values, evaluate entry by entry
+         RDFInternal::RBatchCurrentGuard guard(batch);
+         for (auto i = 0u; i < size; ++i) {
+            if (mask[i] && !isComputed[i]) {
+               batch.SetCurrent(i);
+               const auto entry = batch.GetEntry(i);
+               UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+               fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
+               values[i] = fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()];
+               isComputed[i] = 1;
+            }
+         }
+      } else if (batchValues.fNComputed == 0 && std::find(mask, mask + size, 0) == mask + size) {
+         // the common case: a tight loop over all entries that the compiler can vectorize
+         for (auto i = 0u; i < size; ++i)
+            values[i] = EvalBatchEntry(slot, batch.GetEntry(i), i, ExtraArgsTag{}, std::get<S>(inputs)...);
+         std::fill(isComputed, isComputed + size, 1);
+      } else {
+         for (auto i = 0u; i < size; ++i) {
+            if (mask[i] && !isComputed[i]) {
+               values[i] = EvalBatchEntry(slot, batch.GetEntry(i), i, ExtraArgsTag{}, std::get<S>(inputs)...);
+               isComputed[i] = 1;
+            }
+         }
+      }
+      batchValues.fNComputed = static_cast<unsigned int>(std::count(isComputed, isComputed + size, 1));
+   }
+
+   void UpdateBatchImpl(unsigned int slot, RDFInternal::RSlotBatch &batch, const char *mask, std::true_type)
+   {
+      UpdateBatchHelper(slot, batch, mask, ColumnTypes_t{}, TypeInd_t{});
+   }
+
+   void UpdateBatchImpl(unsigned int, RDFInternal::RSlotBatch &, const char *, std::false_type) {}
+
+   /// If the value of the current entry of the batch of the slot was computed by UpdateBatch, copy it to fLastResults
+   bool ReadFromBatch(unsigned int slot, std::true_type)
+   {
+      auto *batch = fBatches[slot];
+      if (batch == nullptr)
+         return false;
+      const auto &batchValues = fBatchValues[slot];
+      const auto idx = batch->GetCurrent();
+      if (batchValues.fBatchId != batch->GetId() || !batchValues.fIsComputed[idx])
+         return false;
+      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] = batchValues.fValues[idx];
+      return true;
+   }
+
+   bool ReadFromBatch(unsigned int, std::false_type) { return false; }
+
 public:
    RDefine(std::string_view name, std::string_view type, F expression, const ColumnNames_t &columns,
            unsigned int nSlots, const RDFInternal::RBookedDefines &defines,
-           const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds)
+           const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds,
+           const std::string &variation = "nominal")
       : RDefineBase(name, type, nSlots, defines, DSValuePtrs, ds), fExpression(std::move(expression)),
-        fColumnNames(columns), fLastResults(fNSlots * RDFInternal::CacheLineStep<ret_type>()), fValues(fNSlots),
-        fIsDefine()
+        fColumnNames(columns), fLastResults(fNSlots * RDFInternal::CacheLineStep<ret_type>()), fBatchValues(fNSlots),
+        fValues(fNSlots),
+        fIsDefine(), fVariation(variation)
    {
       const auto nColumns = fColumnNames.size();
       for (auto i = 0u; i < nColumns; ++i)
@@ -116,13 +254,23 @@ public:
    RDefine(const RDefine &) = delete;
    RDefine &operator=(const RDefine &) = delete;
 
-   void InitSlot(TTreeReader *r, unsigned int slot) final
+   void InitSlot(TTreeReader *r, unsigned int slot, RDFInternal::RSlotBatch *batch) final
    {
       if (!fIsInitialized[slot]) {
          fIsInitialized[slot] = true;
-         RDFInternal::RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fDSValuePtrs, fDataSource};
-         fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
+         fBatches[slot] = batch;
+         RDFInternal::RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fDSValuePtrs, fDataSource,
+                                              fProfiler, batch};
+         fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+         if (batch != nullptr && IsBatched_t::value) {
+            auto &batchValues = fBatchValues[slot];
+            batchValues.fValues.reset(new BatchValue_t[batch->GetCapacity()]());
+            batchValues.fIsComputed.resize(batch->GetCapacity());
+            batchValues.fBatchId = ULong64_t(-1);
+         }
+         for (auto &variedDefine : fVariedDefines)
+            variedDefine.second->InitSlot(r, slot, batch);
       }
    }
 
@@ -136,12 +284,25 @@ public:
    void Update(unsigned int slot, Long64_t entry) final
    {
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
-         // evaluate this filter, cache the result
-         UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+         if (!ReadFromBatch(slot, IsBatched_t{})) {
+            // evaluate this column, cache the result
+            RDFInternal::RLoopProfiler::RNodeScope profile(fProfiler, fProfileId, slot);
+            UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+         }
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
       }
    }
 
+   void UpdateBatch(unsigned int slot, RDFInternal::RSlotBatch &batch, const char *mask) final
+   {
+      UpdateBatchImpl(slot, batch, mask, IsBatched_t{});
+   }
+
+   void *GetBatchValuePtr(unsigned int slot) final
+   {
+      return IsBatched_t::value ? fBatchValues[slot].fValues.get() : nullptr;
+   }
+
    const std::type_info &GetTypeId() const { return typeid(ret_type); }
 
    /// Clean-up operations to be performed at the end of a task.
@@ -150,9 +311,40 @@ public:
       if (fIsInitialized[slot]) {
          for (auto &v : fValues[slot])
             v.reset();
+         fBatches[slot] = nullptr;
          fIsInitialized[slot] = false;
+         for (auto &variedDefine : fVariedDefines)
+            variedDefine.second->FinaliseSlot(slot);
       }
    }
+
+   void AddDescription(std::string &description) const final
+   {
+      // the type of a compiled callable is the best proxy we have for its code
+      const std::string expression = fJittedExpression.empty() ? typeid(F).name() : fJittedExpression;
+      description += "\nDefine(" + fName + ";" + fType + ";" + expression;
+      for (const auto &column : fColumnNames)
+         description += ";" + column;
+      description += ")";
+      fDefines.AddDescriptions(fColumnNames, description);
+   }
+
+   std::vector<std::string> GetVariations() const final { return fDefines.GetVariationDeps(fColumnNames); }
+
+   void MakeVariedDefine(const std::string &variation) final
+   {
+      if (fVariedDefines.find(variation) != fVariedDefines.end())
+         return;
+      // the clone reads the varied clones of its input columns, which must exist before the event loop
+      fDefines.MakeVariedDefines(fColumnNames, variation);
+      fVariedDefines[variation] = CloneForVariation(variation);
+   }
+
+   RDefineBase *GetVariedDefine(const std::string &variation) final
+   {
+      auto it = fVariedDefines.find(variation);
+      return it == fVariedDefines.end() ? nullptr : it->second.get();
+   }
 };
 
 } // ns RDF
@@ -26,6 +26,12 @@ namespace ROOT {
 namespace RDF {
 class RDataSource;
 }
+namespace Internal {
+namespace RDF {
+class RLoopProfiler;
+class RSlotBatch;
+}
+} // namespace Internal
 namespace Detail {
 namespace RDF {
 
@@ -35,6 +41,7 @@ class RDefineBase {
 protected:
    const std::string fName; ///< The name of the custom column
    const std::string fType; ///< The type of the custom column as a text string
+   std::string fJittedExpression; ///< The expression of jitted columns, empty for columns that use compiled callables
    unsigned int fNChildren{0};      ///< number of nodes of the functional graph hanging from this object
    unsigned int fNStopsReceived{0}; ///< number of times that a children node signaled to stop processing entries.
    const unsigned int fNSlots;      ///< number of thread slots used by this node, inherited from parent node.
@@ -46,6 +53,9 @@ protected:
    std::deque<bool> fIsInitialized; // because vector<bool> is not thread-safe
    const std::map<std::string, std::vector<void *>> &fDSValuePtrs; // reference to RLoopManager's data member
    ROOT::RDF::RDataSource *fDataSource; ///< non-owning ptr to the RDataSource, if any. Used to retrieve column readers.
+   RDFInternal::RLoopProfiler *fProfiler = nullptr; ///< non-owning ptr to the profiler of the event loop, if any
+   unsigned int fProfileId = 0;                     ///< the identifier of this column in fProfiler
+   std::vector<RDFInternal::RSlotBatch *> fBatches; ///< per-slot batches of entries, null unless running batched
 
    static unsigned int GetNextID();
 
@@ -57,18 +67,44 @@ public:
    RDefineBase &operator=(const RDefineBase &) = delete;
    RDefineBase &operator=(RDefineBase &&) = delete;
    virtual ~RDefineBase();
-   virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
+   /// Get ready to process the entries of a task. `batch` is non-null if the task runs in batched mode, see RSlotBatch.
+   virtual void InitSlot(TTreeReader *r, unsigned int slot, RDFInternal::RSlotBatch *batch) = 0;
    /// Return the (type-erased) address of the Define'd value for the given processing slot.
    virtual void *GetValuePtr(unsigned int slot) = 0;
    virtual const std::type_info &GetTypeId() const = 0;
    std::string GetName() const;
    std::string GetTypeName() const;
+   void SetJittedExpression(const std::string &expression) { fJittedExpression = expression; }
+   /// Append to the given string a description of this column, of its expression and of its inputs.
+   /// Used to identify the on-disk caches written by RInterface::DiskCache.
+   virtual void AddDescription(std::string &description) const = 0;
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Compute the values of the entries of the current batch that are selected by `mask`, see RSlotBatch.
+   /// Does nothing for columns that are not evaluated in batches, i.e. columns whose type is not fundamental.
+   virtual void UpdateBatch(unsigned int /*slot*/, RDFInternal::RSlotBatch & /*batch*/, const char * /*mask*/) {}
+   /// Return the (type-erased) address of the contiguous values computed by UpdateBatch, or nullptr if this column is
+   /// not evaluated in batches.
+   virtual void *GetBatchValuePtr(unsigned int /*slot*/) { return nullptr; }
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinaliseSlot(unsigned int slot) = 0;
+   /// Measure the evaluations of this column with the given profiler, under the given node identifier.
+   virtual void SetProfiler(RDFInternal::RLoopProfiler *profiler, unsigned int profileId)
+   {
+      fProfiler = profiler;
+      fProfileId = profileId;
+   }
+   RDFInternal::RLoopProfiler *GetProfiler() const { return fProfiler; }
+   unsigned int GetProfileId() const { return fProfileId; }
    /// Return the unique identifier of this RDefineBase.
    unsigned int GetID() const { return fID; }
+   /// Return the names of the systematic variations that this column depends on, see RInterface::Vary.
+   virtual std::vector<std::string> GetVariations() const = 0;
+   /// Create, if it does not exist yet, the clone of this column that reads the given "variationName:tag" of its
+   /// inputs. Must be called before the event loop starts.
+   virtual void MakeVariedDefine(const std::string &variation) = 0;
+   /// Return the clone created by MakeVariedDefine, or nullptr if there is none for the given "variationName:tag".
+   virtual RDefineBase *GetVariedDefine(const std::string &variation) = 0;
 };
 
 } // ns RDF
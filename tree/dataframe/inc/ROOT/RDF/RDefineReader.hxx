@@ -43,6 +43,12 @@ class R__CLING_PTRCHECK(off) RDefineReader final : public ROOT::Detail::RDF::RCo
       return fCustomValuePtr;
    }
 
+   void *GetBatchImpl(RSlotBatch &batch, const char *mask) final
+   {
+      fDefine.UpdateBatch(fSlot, batch, mask);
+      return fDefine.GetBatchValuePtr(fSlot);
+   }
+
 public:
    RDefineReader(unsigned int slot, RDFDetail::RDefineBase &define, const std::type_info &tid)
       : fDefine(define), fCustomValuePtr(define.GetValuePtr(slot)), fSlot(slot)
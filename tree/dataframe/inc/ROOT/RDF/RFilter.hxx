@@ -17,13 +17,21 @@
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RSlotBatch.hxx"
 #include "ROOT/RIntegerSequence.hxx"
+#include "ROOT/RVec.hxx"
 #include "ROOT/TypeTraits.hxx"
 #include "RtypesCore.h"
 
 #include <algorithm>
+#include <array>
+#include <map>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
 #include <vector>
 
 namespace ROOT {
@@ -62,13 +70,45 @@ class R__CLING_PTRCHECK(off) RFilter final : public RFilterBase {
    std::vector<std::array<std::unique_ptr<RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
+   /// The "variationName:tag" of the inputs this filter reads, "nominal" for the nominal values
+   const std::string fVariation;
+   /// The clones of this filter that select entries according to varied inputs, per "variationName:tag"
+   std::map<std::string, std::shared_ptr<RNodeBase>> fVariedFilters;
+   /// Per-slot batches of entries, null unless the task runs in batched mode, see RSlotBatch
+   std::vector<RDFInternal::RSlotBatch *> fBatches;
+   /// Per-slot selection masks of the current batch
+   std::vector<ROOT::RVec<char>> fBatchMasks;
+   /// Per-slot identifiers of the batches fBatchMasks refer to
+   std::vector<ULong64_t> fBatchIds;
+
+   // the varied clones work on copies of the filter expression
+   template <typename G = FilterF>
+   typename std::enable_if<std::is_copy_constructible<G>::value, std::shared_ptr<RNodeBase>>::type
+   CloneForVariation(std::shared_ptr<RNodeBase> prevNode, const std::string &variation)
+   {
+      // the clones are unnamed so that they do not show up in the cut-flow report
+      auto variedFilter = std::make_shared<RFilter<FilterF, RNodeBase>>(fFilter, fColumnNames, std::move(prevNode),
+                                                                        fDefines, "", variation);
+      fLoopManager->Book(variedFilter.get());
+      return variedFilter;
+   }
+
+   template <typename G = FilterF>
+   typename std::enable_if<!std::is_copy_constructible<G>::value, std::shared_ptr<RNodeBase>>::type
+   CloneForVariation(std::shared_ptr<RNodeBase>, const std::string &)
+   {
+      throw std::runtime_error("RDataFrame: a filter depends on a systematic variation but its expression cannot be "
+                               "copied.");
+   }
 
 public:
    RFilter(FilterF f, const ColumnNames_t &columns, std::shared_ptr<PrevDataFrame> pd,
-           const RDFInternal::RBookedDefines &defines, std::string_view name = "")
+           const RDFInternal::RBookedDefines &defines, std::string_view name = "",
+           const std::string &variation = "nominal")
       : RFilterBase(pd->GetLoopManagerUnchecked(), name, pd->GetLoopManagerUnchecked()->GetNSlots(), defines),
         fFilter(std::move(f)), fColumnNames(columns), fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr),
-        fValues(fNSlots), fIsDefine()
+        fValues(fNSlots), fIsDefine(), fVariation(variation), fBatches(fNSlots, nullptr), fBatchMasks(fNSlots),
+        fBatchIds(fNSlots * RDFInternal::CacheLineStep<ULong64_t>(), ULong64_t(-1))
    {
       const auto nColumns = fColumnNames.size();
       for (auto i = 0u; i < nColumns; ++i)
@@ -83,13 +123,19 @@ public:
 
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
+      if (auto *batch = fBatches[slot])
+         return CheckFiltersBatch(slot, *batch)[batch->GetCurrent()];
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
          if (!fPrevData.CheckFilters(slot, entry)) {
             // a filter upstream returned false, cache the result
             fLastResult[slot * RDFInternal::CacheLineStep<int>()] = false;
          } else {
             // evaluate this filter, cache the result
-            auto passed = CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+            bool passed;
+            {
+               RDFInternal::RLoopProfiler::RNodeScope profile(fProfiler, fProfileId, slot);
+               passed = CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+            }
             passed ? ++fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()]
                    : ++fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()];
             fLastResult[slot * RDFInternal::CacheLineStep<int>()] = passed;
@@ -108,13 +154,65 @@ public:
       return fFilter(fValues[slot][S]->template Get<ColTypes>(entry)...);
    }
 
+   const char *CheckFiltersBatch(unsigned int slot, RDFInternal::RSlotBatch &batch) final
+   {
+      auto &mask = fBatchMasks[slot];
+      auto &batchId = fBatchIds[slot * RDFInternal::CacheLineStep<ULong64_t>()];
+      if (batchId != batch.GetId()) {
+         const char *prevMask = fPrevData.CheckFiltersBatch(slot, batch);
+         CheckFiltersBatchHelper(slot, batch, prevMask, mask.data(), ColumnTypes_t{}, TypeInd_t{});
+         ULong64_t nSelected = 0, nAccepted = 0;
+         const auto size = batch.GetSize();
+         for (auto i = 0u; i < size; ++i) {
+            nSelected += prevMask[i] != 0;
+            nAccepted += mask[i] != 0;
+         }
+         fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nAccepted;
+         fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nSelected - nAccepted;
+         batchId = batch.GetId();
+      }
+      return mask.data();
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void CheckFiltersBatchHelper(unsigned int slot, RDFInternal::RSlotBatch &batch, const char *prevMask, char *mask,
+                                TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      const auto size = batch.GetSize();
+      const auto inputs = std::make_tuple(fValues[slot][S]->template GetBatch<ColTypes>(batch, prevMask)...);
+      const std::array<bool, sizeof...(S)> hasInput{{(std::get<S>(inputs) != nullptr)...}};
+      if (std::find(hasInput.begin(), hasInput.end(), false) != hasInput.end()) {
+         // some inputs are not available as contiguous values, evaluate entry by entry
+         RDFInternal::RBatchCurrentGuard guard(batch);
+         for (auto i = 0u; i < size; ++i) {
+            batch.SetCurrent(i);
+            mask[i] = prevMask[i] && CheckFilterHelper(slot, batch.GetEntry(i), ColumnTypes_t{}, TypeInd_t{});
+         }
+      } else if (std::find(prevMask, prevMask + size, 0) == prevMask + size) {
+         // the common case: a tight loop over all entries that the compiler can vectorize
+         for (auto i = 0u; i < size; ++i)
+            mask[i] = static_cast<bool>(fFilter(std::get<S>(inputs)[i]...));
+      } else {
+         for (auto i = 0u; i < size; ++i)
+            mask[i] = prevMask[i] && fFilter(std::get<S>(inputs)[i]...);
+      }
+   }
+
    void InitSlot(TTreeReader *r, unsigned int slot) final
    {
+      auto *batch = fLoopManager->GetSlotBatch(slot);
+      fBatches[slot] = batch;
+      if (batch != nullptr) {
+         fBatchMasks[slot].resize(batch->GetCapacity());
+         fBatchIds[slot * RDFInternal::CacheLineStep<ULong64_t>()] = ULong64_t(-1);
+      }
       for (auto &bookedBranch : fDefines.GetColumns())
-         bookedBranch.second->InitSlot(r, slot);
+         bookedBranch.second->InitSlot(r, slot, batch);
+      for (auto &variation : fDefines.GetVariations())
+         variation->InitSlot(r, slot, batch);
       RDFInternal::RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fLoopManager->GetDSValuePtrs(),
-                                           fLoopManager->GetDataSource()};
-      fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
+                                           fLoopManager->GetDataSource(), fProfiler, batch};
+      fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
    }
 
    // recursive chain of `Report`s
@@ -154,14 +252,66 @@ public:
       filters.push_back(name);
    }
 
+   void SetProfiler(RDFInternal::RLoopProfiler &profiler) final
+   {
+      std::string name = HasName() ? fName : "Filter";
+      if (fVariation != "nominal")
+         name += " [" + fVariation + "]";
+      fProfiler = &profiler;
+      fProfileId = profiler.RegisterNode(RDFInternal::RLoopProfiler::ENodeKind::kFilter, name, this);
+      fDefines.SetProfiler(profiler);
+   }
+
+   void AddDescription(std::string &description) final
+   {
+      fPrevData.AddDescription(description);
+      // the type of a compiled callable is the best proxy we have for its code
+      const std::string expression = fJittedExpression.empty() ? typeid(FilterF).name() : fJittedExpression;
+      description += "\nFilter(" + fName + ";" + expression;
+      for (const auto &column : fColumnNames)
+         description += ";" + column;
+      description += ")";
+      fDefines.AddDescriptions(fColumnNames, description);
+   }
+
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinaliseSlot(unsigned int slot) final
    {
       for (auto &column : fDefines.GetColumns())
          column.second->FinaliseSlot(slot);
+      for (auto &variation : fDefines.GetVariations())
+         variation->FinaliseSlot(slot);
 
       for (auto &v : fValues[slot])
          v.reset();
+      fBatches[slot] = nullptr;
+   }
+
+   std::vector<std::string> GetVariations() const final
+   {
+      auto variations = fPrevData.GetVariations();
+      RDFInternal::AddUnique(variations, fDefines.GetVariationDeps(fColumnNames));
+      return variations;
+   }
+
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variation) final
+   {
+      auto it = fVariedFilters.find(variation);
+      if (it != fVariedFilters.end())
+         return it->second;
+
+      // upstream nodes that depend on the variation are varied as well, the others are shared with the nominal chain
+      std::shared_ptr<RNodeBase> prevNode = fPrevDataPtr;
+      const auto prevVariations = fPrevData.GetVariations();
+      if (std::find(prevVariations.begin(), prevVariations.end(), RDFInternal::GetVariationName(variation)) !=
+          prevVariations.end()) {
+         prevNode = fPrevData.GetVariedFilter(variation);
+      }
+      fDefines.MakeVariedDefines(fColumnNames, variation);
+
+      auto variedFilter = CloneForVariation(std::move(prevNode), variation);
+      fVariedFilters[variation] = variedFilter;
+      return variedFilter;
    }
 
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
@@ -179,6 +329,9 @@ public:
          return thisNode;
       }
 
+      if (fProfiler != nullptr)
+         thisNode->SetProfileSummary(fProfiler->GetNodeSummary(fProfileId));
+
       auto upmostNode = AddDefinesToGraph(thisNode, fDefines, prevColumns);
 
       // Keep track of the columns defined up to this point.
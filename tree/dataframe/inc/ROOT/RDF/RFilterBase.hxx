@@ -40,10 +40,14 @@ protected:
    std::vector<ULong64_t> fAccepted = {0};
    std::vector<ULong64_t> fRejected = {0};
    const std::string fName;
+   std::string fJittedExpression; ///< The expression of jitted filters, empty for filters that use compiled callables
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
 
    RDFInternal::RBookedDefines fDefines;
 
+   RDFInternal::RLoopProfiler *fProfiler = nullptr; ///< Non-owning ptr to the profiler of the event loop, if any
+   unsigned int fProfileId = 0;                     ///< The identifier of this filter in fProfiler
+
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
                const RDFInternal::RBookedDefines &defines);
@@ -54,6 +58,7 @@ public:
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    bool HasName() const;
    std::string GetName() const;
+   void SetJittedExpression(const std::string &expression) { fJittedExpression = expression; }
    virtual void FillReport(ROOT::RDF::RCutFlowReport &) const;
    virtual void TriggerChildrenCount() = 0;
    virtual void ResetReportCount()
@@ -67,6 +72,8 @@ public:
    virtual void FinaliseSlot(unsigned int slot) = 0;
    virtual void InitNode();
    virtual void AddFilterName(std::vector<std::string> &filters) = 0;
+   /// Register this filter and the columns it defines with the profiler of the event loop, see RLoopProfiler.
+   virtual void SetProfiler(RDFInternal::RLoopProfiler &profiler) = 0;
 };
 
 } // ns RDF
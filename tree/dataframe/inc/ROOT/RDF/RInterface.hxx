@@ -17,6 +17,7 @@
 #include "ROOT/RDF/HistoModels.hxx"
 #include "ROOT/RDF/InterfaceUtils.hxx"
 #include "ROOT/RDF/RRange.hxx"
+#include "ROOT/RDF/RVariation.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RIntegerSequence.hxx"
 #include "ROOT/RDF/RLazyDSImpl.hxx"
@@ -477,6 +478,104 @@ public:
       return newInterface;
    }
 
+   // clang-format off
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations for an existing column.
+   /// \param[in] colName The name of the column for which varied values are provided.
+   /// \param[in] expression Function, lambda expression, functor class or any other callable object producing the varied values. It must return an RVec with one varied value per tag.
+   /// \param[in] inputColumns Names of the columns/branches in input to the expression.
+   /// \param[in] variationTags The names of the varied values, e.g. {"down", "up"}.
+   /// \param[in] variationName The name of the systematic variation. Defaults to the name of the varied column.
+   /// \return the first node of the computation graph for which the variations are defined.
+   ///
+   /// The variations are not used by the results of the computation graph unless they are requested via
+   /// ROOT::RDF::Experimental::VariationsFor(). In that case, the nominal and all varied results are produced in the
+   /// same event loop: the expression is evaluated once per entry and all the nodes that depend on the varied column
+   /// (filters, defines and the action itself) are evaluated once per variation tag.
+   ///
+   /// Several columns can be varied together by registering variations with the same name and the same tags.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto nominal_hx =
+   ///    df.Vary("pt", [] (double pt) { return RVec<double>{pt * 0.9, pt * 1.1}; }, {"pt"}, {"down", "up"})
+   ///      .Filter("pt > k")
+   ///      .Define("x", someFunc, {"pt"})
+   ///      .Histo1D("x");
+   ///
+   /// auto hx = ROOT::RDF::Experimental::VariationsFor(nominal_hx);
+   /// hx["nominal"].Draw();
+   /// hx["pt:down"].Draw("SAME");
+   /// hx["pt:up"].Draw("SAME");
+   /// ~~~
+   template <typename F>
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, F expression, const ColumnNames_t &inputColumns,
+                                  const std::vector<std::string> &variationTags, std::string_view variationName = "")
+   {
+      const std::string theVariationName = variationName.empty() ? std::string(colName) : std::string(variationName);
+      if (theVariationName.find(':') != std::string::npos || theVariationName == "nominal") {
+         throw std::runtime_error("Vary: \"" + theVariationName + "\" is not a valid variation name.");
+      }
+      if (variationTags.empty())
+         throw std::runtime_error("Vary: at least one variation tag must be provided.");
+      if (std::set<std::string>(variationTags.begin(), variationTags.end()).size() != variationTags.size())
+         throw std::runtime_error("Vary: the variation tags of \"" + theVariationName + "\" must be unique.");
+
+      const auto validColName = GetValidatedColumnNames(1, {std::string(colName)})[0];
+      if (fDefines.FindVariation(validColName, theVariationName + ":" + variationTags[0]) != nullptr) {
+         throw std::runtime_error("Vary: column \"" + validColName + "\" already has a variation named \"" +
+                                  theVariationName + "\".");
+      }
+
+      using ColTypes_t = typename TTraits::CallableTraits<F>::arg_types;
+      using RetType_t = typename std::decay<typename TTraits::CallableTraits<F>::ret_type>::type;
+      static_assert(RDFInternal::IsRVec_t<RetType_t>::value,
+                    "Vary expressions must return an RVec with one value per variation tag.");
+
+      constexpr auto nColumns = ColTypes_t::list_size;
+      const auto validColumnNames = GetValidatedColumnNames(nColumns, inputColumns);
+      CheckAndFillDSColumns(validColumnNames, ColTypes_t());
+
+      auto retTypeName = RDFInternal::TypeID2TypeName(typeid(typename RetType_t::value_type));
+      if (retTypeName.empty())
+         retTypeName = "CLING_UNKNOWN_TYPE_" + RDFInternal::DemangleTypeIdName(typeid(typename RetType_t::value_type));
+
+      fLoopManager->AddVariation(theVariationName, variationTags);
+
+      auto variation = std::make_shared<RDFInternal::RVariation<F>>(
+         validColName, theVariationName, variationTags, retTypeName, std::move(expression), validColumnNames,
+         fLoopManager->GetNSlots(), fDefines, fLoopManager->GetDSValuePtrs(), fDataSource);
+
+      RDFInternal::RBookedDefines newCols(fDefines);
+      newCols.AddVariation(variation);
+
+      RInterface<Proxied, DS_t> newInterface(fProxiedPtr, *fLoopManager, std::move(newCols), fDataSource);
+
+      return newInterface;
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations for an existing column, with tags "0", "1", ..., nVariations-1.
+   /// \param[in] colName The name of the column for which varied values are provided.
+   /// \param[in] expression Function, lambda expression, functor class or any other callable object producing the varied values. It must return an RVec with nVariations values.
+   /// \param[in] inputColumns Names of the columns/branches in input to the expression.
+   /// \param[in] nVariations The number of varied values returned by the expression.
+   /// \param[in] variationName The name of the systematic variation. Defaults to the name of the varied column.
+   /// \return the first node of the computation graph for which the variations are defined.
+   ///
+   /// See the first Vary() overload for more information.
+   template <typename F>
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, F expression, const ColumnNames_t &inputColumns,
+                                  std::size_t nVariations, std::string_view variationName = "")
+   {
+      std::vector<std::string> variationTags;
+      variationTags.reserve(nVariations);
+      for (std::size_t i = 0u; i < nVariations; ++i)
+         variationTags.emplace_back(std::to_string(i));
+      return Vary(colName, std::move(expression), inputColumns, variationTags, variationName);
+   }
+   // clang-format on
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Allow to refer to a column with a different name.
    /// \param[in] alias name of the column alias
@@ -569,6 +668,15 @@ public:
    /// opts.fLazy = true;
    /// df.Snapshot("outputTree", "outputFile.root", {"x"}, opts);
    /// ~~~
+   ///
+   /// To write an RNTuple instead of a TTree (only available if ROOT was built with `root7=ON`), select the output
+   /// format in `RSnapshotOptions`. In multi-thread runs, each slot fills and compresses its own clusters, which are
+   /// appended to the output ntuple without going through a merging thread:
+   /// ~~~{.cpp}
+   /// RSnapshotOptions opts;
+   /// opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   /// df.Snapshot("outputNTuple", "outputFile.root", {"x"}, opts);
+   /// ~~~
    template <typename... ColumnTypes>
    RResultPtr<RInterface<RLoopManager>>
    Snapshot(std::string_view treename, std::string_view filename, const ColumnNames_t &columnList,
@@ -604,8 +712,7 @@ public:
       auto snapHelperArgs = std::make_shared<RDFInternal::SnapshotHelperArgs>(RDFInternal::SnapshotHelperArgs{
          std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options});
 
-      ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
+      auto newRDF = MakeSnapshotDataFrame(fullTreeName, filename, validCols, *snapHelperArgs);
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, RDFDetail::RInferredType>(
          validCols, newRDF, snapHelperArgs, validCols.size());
@@ -799,6 +906,61 @@ public:
       return Cache(selectedColumns);
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns to a persistent cache on disk, or reuse the cache written by a previous job.
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] cacheDir directory that stores the cache files. It is created if it does not exist.
+   /// \return a `RDataFrame` that reads the cached dataset from disk.
+   ///
+   /// Like Cache, this action returns a new `RDataFrame` object, completely detached from the originating
+   /// `RDataFrame`, that only contains the cached columns. Instead of being kept in memory, the columns are written
+   /// to a ROOT file in `cacheDir`: the cached dataset does not need to fit in memory and it outlives the process.
+   ///
+   /// The cache file is identified by a description of the cached dataset, which comprises the input files (with
+   /// their size and modification time, or for remote files their UUID, size and modification date), the Filters, Ranges and Defines that the cached columns depend on (with
+   /// the expressions of the jitted ones) and the names and types of the cached columns. If a cache file with the same
+   /// description exists, it is reused and no event loop runs. Otherwise, the event loop runs and writes a new cache
+   /// file, which is moved into place only once complete.
+   ///
+   /// \note Changes to the code of a compiled callable passed to Filter or Define cannot be detected. Remove the cache
+   /// files, or use a different cache directory, after such changes. Datasets read through an RDataSource are never
+   /// reused, as their content cannot be checked: for them, the event loop always runs and the cache is rewritten.
+   /// The same holds if one of the input files cannot be opened to compute the description.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto skim = df.Filter("pt > 20").Define("pt2", "pt * pt").DiskCache({"pt", "pt2"}, "/tmp/rdfcache");
+   /// ~~~
+   RInterface<RLoopManager> DiskCache(const ColumnNames_t &columnList, std::string_view cacheDir)
+   {
+      // the descriptions of the jitted nodes are only complete after jitting
+      fLoopManager->Jit();
+
+      const auto columnListWithoutSizeColumns = RDFInternal::FilterArraySizeColNames(columnList, "DiskCache");
+      const auto validColumnNames =
+         GetValidatedColumnNames(columnListWithoutSizeColumns.size(), columnListWithoutSizeColumns);
+      const auto colTypes = GetValidatedArgTypes(validColumnNames, fDefines, fLoopManager->GetTree(), fDataSource,
+                                                 "DiskCache", /*vector2rvec=*/false);
+
+      std::string description;
+      fProxiedPtr->AddDescription(description);
+      for (auto i = 0u; i < validColumnNames.size(); ++i) {
+         description += "\nColumn(" + columnListWithoutSizeColumns[i] + ";" + validColumnNames[i] + ";" +
+                        colTypes[i] + ")";
+      }
+      fDefines.AddDescriptions(validColumnNames, description);
+
+      const auto fileName = RDFInternal::GetDiskCacheFileName(description, cacheDir);
+      if (fDataSource != nullptr || !fLoopManager->IsDescriptionComplete() ||
+          !RDFInternal::IsValidDiskCache(fileName, description)) {
+         const auto tmpFileName = RDFInternal::GetDiskCacheTmpFileName(fileName);
+         Snapshot(RDFInternal::kDiskCacheTreeName, tmpFileName, columnListWithoutSizeColumns);
+         RDFInternal::CommitDiskCache(tmpFileName, fileName, description);
+      }
+
+      return MakeDiskCacheDataFrame(fileName, columnListWithoutSizeColumns);
+   }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates a node that filters entries based on range: [begin, end).
@@ -2701,8 +2863,7 @@ private:
       auto snapHelperArgs = std::make_shared<RDFInternal::SnapshotHelperArgs>(RDFInternal::SnapshotHelperArgs{
          std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options});
 
-      ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
+      auto newRDF = MakeSnapshotDataFrame(fullTreeName, filename, validCols, *snapHelperArgs);
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, ColumnTypes...>(validCols, newRDF, snapHelperArgs);
 
@@ -2711,6 +2872,43 @@ private:
       return resPtr;
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Create the RDataFrame returned by Snapshot, which reads the dataset written by the action.
+   /// A TTree output is read through a TChain, which only opens the file once the event loop starts. An RNTuple output
+   /// instead can only be opened once it is written: in that case the returned object is replaced with the actual
+   /// RDataFrame when the Snapshot action finishes.
+   /// The template parameter defers the use of RDataFrame, which is not a complete type yet, to instantiation time.
+   template <typename RDataFrame_t = ROOT::RDataFrame>
+   std::shared_ptr<RInterface<RLoopManager>>
+   MakeSnapshotDataFrame(std::string_view fullTreeName, std::string_view filename, const ColumnNames_t &validCols,
+                         RDFInternal::SnapshotHelperArgs &snapHelperArgs)
+   {
+      if (snapHelperArgs.fOptions.fOutputFormat != ESnapshotOutputFormat::kRNTuple) {
+         ::TDirectory::TContext ctxt;
+         return std::make_shared<RDataFrame_t>(fullTreeName, filename, validCols);
+      }
+
+      auto newRDF = std::make_shared<RInterface<RLoopManager>>(std::make_shared<RLoopManager>(0ull));
+      std::weak_ptr<RInterface<RLoopManager>> weakRDF = newRDF;
+      const auto ntupleName = snapHelperArgs.fTreeName;
+      const auto fileName = snapHelperArgs.fFileName;
+      snapHelperArgs.fOnFinalize = [weakRDF, ntupleName, fileName, validCols]() {
+         if (auto rdf = weakRDF.lock()) {
+            *rdf = RInterface<RLoopManager>(
+               std::make_shared<RLoopManager>(RDFInternal::MakeNTupleDataSource(ntupleName, fileName), validCols));
+         }
+      };
+      return newRDF;
+   }
+
+   /// Create the RDataFrame that reads an on-disk cache written by DiskCache.
+   /// As in MakeSnapshotDataFrame, the template parameter defers the use of the incomplete RDataFrame type.
+   template <typename RDataFrame_t = ROOT::RDataFrame>
+   RInterface<RLoopManager> MakeDiskCacheDataFrame(const std::string &fileName, const ColumnNames_t &columns)
+   {
+      return RDataFrame_t(RDFInternal::kDiskCacheTreeName, fileName, columns);
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Implementation of cache.
    template <typename... ColTypes, std::size_t... S>
@@ -47,6 +47,7 @@ public:
    void SetAction(std::unique_ptr<RActionBase> a) { fConcreteAction = std::move(a); }
 
    void Run(unsigned int slot, Long64_t entry) final;
+   void RunBatch(unsigned int slot, RSlotBatch &batch) final;
    void Initialize() final;
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void TriggerChildrenCount() final;
@@ -60,6 +61,10 @@ public:
 
    // Helper for RMergeableValue
    std::unique_ptr<ROOT::Detail::RDF::RMergeableValueBase> GetMergeableValue() const final;
+
+   std::vector<std::string> GetVariations() const final;
+   void SetProfiler(RLoopProfiler &profiler) final;
+   std::unique_ptr<RActionBase> MakeVariedAction(const std::string &variation, void *newResult) final;
 };
 
 } // ns RDF
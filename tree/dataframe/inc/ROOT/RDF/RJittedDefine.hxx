@@ -38,13 +38,24 @@ public:
    {
    }
 
-   void SetDefine(std::unique_ptr<RDefineBase> c) { fConcreteDefine = std::move(c); }
+   void SetDefine(std::unique_ptr<RDefineBase> c)
+   {
+      fConcreteDefine = std::move(c);
+      fConcreteDefine->SetJittedExpression(fJittedExpression);
+   }
 
-   void InitSlot(TTreeReader *r, unsigned int slot) final;
+   void InitSlot(TTreeReader *r, unsigned int slot, RDFInternal::RSlotBatch *batch) final;
    void *GetValuePtr(unsigned int slot) final;
    const std::type_info &GetTypeId() const final;
    void Update(unsigned int slot, Long64_t entry) final;
+   void UpdateBatch(unsigned int slot, RDFInternal::RSlotBatch &batch, const char *mask) final;
+   void *GetBatchValuePtr(unsigned int slot) final;
    void FinaliseSlot(unsigned int slot) final;
+   std::vector<std::string> GetVariations() const final;
+   void AddDescription(std::string &description) const final;
+   void SetProfiler(RDFInternal::RLoopProfiler *profiler, unsigned int profileId) final;
+   void MakeVariedDefine(const std::string &variation) final;
+   RDefineBase *GetVariedDefine(const std::string &variation) final;
 };
 
 } // ns RDF
@@ -47,6 +47,7 @@ public:
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    bool CheckFilters(unsigned int slot, Long64_t entry) final;
+   const char *CheckFiltersBatch(unsigned int slot, RDFInternal::RSlotBatch &batch) final;
    void Report(ROOT::RDF::RCutFlowReport &) const final;
    void PartialReport(ROOT::RDF::RCutFlowReport &) const final;
    void FillReport(ROOT::RDF::RCutFlowReport &) const final;
@@ -57,8 +58,12 @@ public:
    void ResetReportCount() final;
    void InitNode() final;
    void AddFilterName(std::vector<std::string> &filters) final;
+   void AddDescription(std::string &description) final;
    void FinaliseSlot(unsigned int slot) final;
+   void SetProfiler(RDFInternal::RLoopProfiler &profiler) final;
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph();
+   std::vector<std::string> GetVariations() const final;
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variation) final;
 };
 
 } // ns RDF
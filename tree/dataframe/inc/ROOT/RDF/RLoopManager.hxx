@@ -11,7 +11,9 @@
 #ifndef ROOT_RLOOPMANAGER
 #define ROOT_RLOOPMANAGER
 
+#include "ROOT/RDF/RLoopProfiler.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
+#include "ROOT/RDF/RSlotBatch.hxx"
 
 #include <functional>
 #include <map>
@@ -123,6 +125,22 @@ class RLoopManager : public RNodeBase {
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
 
+   /// The tags of the systematic variations booked via RInterface::Vary, per variation name
+   std::map<std::string, std::vector<std::string>> fVariationTags;
+
+   /// Collects the per-node statistics of the event loops, null unless profiling was enabled via EnableProfiling
+   std::unique_ptr<RDFInternal::RLoopProfiler> fProfiler;
+
+   /// The number of entries per batch, 0 unless batched execution was enabled via EnableBatching
+   unsigned int fBatchSize{0};
+   /// Whether the current event loop runs in batched mode, see RSlotBatch
+   bool fIsBatched{false};
+   /// Per-slot batches of entries, allocated when the first batched event loop starts
+   std::vector<std::unique_ptr<RDFInternal::RSlotBatch>> fSlotBatches;
+
+   /// False if the last call to AddDescription could not identify the content of an input file
+   bool fIsDescriptionComplete{true};
+
    void CheckIndexedFriends();
    void RunEmptySourceMT();
    void RunEmptySource();
@@ -130,7 +148,9 @@ class RLoopManager : public RNodeBase {
    void RunTreeReader();
    void RunDataSourceMT();
    void RunDataSource();
+   bool SetDataSourceEntry(unsigned int slot, ULong64_t entry);
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   void RunBatch(unsigned int slot);
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
    void CleanUpNodes();
@@ -160,6 +180,8 @@ public:
    void Book(RRangeBase *rangePtr);
    void Deregister(RRangeBase *rangePtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   /// End of recursive chain of calls: all entries of the batch are selected
+   const char *CheckFiltersBatch(unsigned int, RDFInternal::RSlotBatch &batch) final { return batch.GetAllPassMask(); }
    unsigned int GetNSlots() const { return fNSlots; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
@@ -175,9 +197,23 @@ public:
    bool HasDSValuePtrs(const std::string &col) const;
    const std::map<std::string, std::vector<void *>> &GetDSValuePtrs() const { return fDSValuePtrMap; }
    void AddDSValuePtrs(const std::string &col, const std::vector<void *> ptrs);
+   void AddVariation(const std::string &variationName, const std::vector<std::string> &tags);
+   const std::vector<std::string> &GetVariationTags(const std::string &variationName) const;
+   void EnableProfiling(unsigned int samplingPeriod);
+   RDFInternal::RLoopProfiler *GetProfiler() const { return fProfiler.get(); }
+   void EnableBatching(unsigned int batchSize);
+   /// Return the batch of entries of the slot, or nullptr if the current event loop does not run in batched mode
+   RDFInternal::RSlotBatch *GetSlotBatch(unsigned int slot) const
+   {
+      return fIsBatched ? fSlotBatches[slot].get() : nullptr;
+   }
 
    /// End of recursive chain of calls, does nothing
    void AddFilterName(std::vector<std::string> &) {}
+   /// Start of the recursive chain of calls: describe the input dataset
+   void AddDescription(std::string &description) final;
+   /// Whether the description of the input dataset changes with its content, so that a DiskCache may be reused
+   bool IsDescriptionComplete() const { return fIsDescriptionComplete; }
    /// For each booked filter, returns either the name or "Unnamed Filter"
    std::vector<std::string> GetFiltersNames();
 
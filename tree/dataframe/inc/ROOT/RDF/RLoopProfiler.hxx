@@ -0,0 +1,233 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RLOOPPROFILER
+#define ROOT_RDF_RLOOPPROFILER
+
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // CacheLineStep
+#include "RtypesCore.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RLoopProfiler
+\ingroup dataframe
+\brief Collects per-node timings and call counts during the event loops of a computation graph.
+
+Owned by the RLoopManager if profiling was enabled, see ROOT::RDF::Experimental::EnableProfiling.
+Calls are counted for every evaluation of a Define, Filter or action, but wall-clock times are only measured for one
+entry out of every fSamplingPeriod processed by each slot, and extrapolated to all entries. Times are exclusive:
+the time spent evaluating upstream Defines and reading column values is subtracted from the time of the node that
+requested them. The time spent reading TTree branches and loading data source entries is accounted separately as
+"read" time, the time spent in the event loop outside of nodes and reads is reported as framework overhead.
+
+Counters are per slot, so the event loop does not need any synchronization. Statistics accumulate over all event loops
+run after profiling was enabled.
+*/
+class RLoopProfiler {
+public:
+   using Clock_t = std::chrono::steady_clock;
+
+   enum class ENodeKind { kDefine, kFilter, kAction };
+
+   /// RAII object that measures an evaluation of a node. A null profiler disables the measurement.
+   class RNodeScope {
+      RLoopProfiler *fProfiler;
+      unsigned int fId;
+      unsigned int fSlot;
+      Long64_t fOuterChildTime = 0;
+      Clock_t::time_point fStart;
+
+   public:
+      RNodeScope(RLoopProfiler *profiler, unsigned int id, unsigned int slot)
+         : fProfiler(profiler), fId(id), fSlot(slot)
+      {
+         if (fProfiler == nullptr)
+            return;
+         auto &counters = fProfiler->fNodeCounters[slot][id];
+         ++counters.fCalls;
+         auto &slotData = fProfiler->GetSlotData(slot);
+         if (!slotData.fIsSampled) {
+            fProfiler = nullptr; // nothing to do at destruction
+            return;
+         }
+         ++counters.fSampledCalls;
+         fOuterChildTime = slotData.fChildTime;
+         slotData.fChildTime = 0;
+         fStart = Clock_t::now();
+      }
+      RNodeScope(const RNodeScope &) = delete;
+      RNodeScope &operator=(const RNodeScope &) = delete;
+      ~RNodeScope()
+      {
+         if (fProfiler == nullptr)
+            return;
+         const auto elapsed = ElapsedNs(fStart);
+         auto &slotData = fProfiler->GetSlotData(fSlot);
+         fProfiler->fNodeCounters[fSlot][fId].fTime += elapsed - slotData.fChildTime;
+         slotData.fChildTime = fOuterChildTime + elapsed;
+      }
+   };
+
+   /// RAII object that measures the time spent reading input data on a sampled entry.
+   class RReadScope {
+      RLoopProfiler *fProfiler;
+      unsigned int fSlot;
+      Clock_t::time_point fStart;
+
+   public:
+      RReadScope(RLoopProfiler *profiler, unsigned int slot) : fProfiler(profiler), fSlot(slot)
+      {
+         if (fProfiler == nullptr || !fProfiler->GetSlotData(slot).fIsSampled) {
+            fProfiler = nullptr;
+            return;
+         }
+         fStart = Clock_t::now();
+      }
+      RReadScope(const RReadScope &) = delete;
+      RReadScope &operator=(const RReadScope &) = delete;
+      ~RReadScope()
+      {
+         if (fProfiler == nullptr)
+            return;
+         const auto elapsed = ElapsedNs(fStart);
+         auto &slotData = fProfiler->GetSlotData(fSlot);
+         slotData.fReadTime += elapsed;
+         slotData.fChildTime += elapsed; // reads are not part of the exclusive time of the node that requested them
+      }
+   };
+
+private:
+   struct RNodeInfo {
+      ENodeKind fKind;
+      std::string fName;
+   };
+
+   /// Counters of one node in one slot
+   struct RNodeCounters {
+      ULong64_t fCalls = 0;        ///< Number of evaluations
+      ULong64_t fSampledCalls = 0; ///< Number of evaluations whose time was measured
+      Long64_t fTime = 0;          ///< Exclusive time of the measured evaluations, in nanoseconds
+   };
+
+   struct RSlotData {
+      ULong64_t fEntries = 0;        ///< Number of entries processed
+      ULong64_t fSampledEntries = 0; ///< Number of entries for which times were measured
+      Long64_t fChildTime = 0;       ///< Time measured in the nested scopes of the innermost open RNodeScope
+      Long64_t fReadTime = 0;        ///< Time spent reading input data on sampled entries, in nanoseconds
+      Long64_t fLoopTime = 0;        ///< Wall-clock time spent in event-loop tasks, in nanoseconds
+      Clock_t::time_point fTaskStart;
+      unsigned int fCountdown = 0; ///< Number of entries to skip before the next sampled entry
+      bool fIsSampled = false;     ///< Whether times are measured for the current entry
+   };
+
+   const unsigned int fNSlots;
+   const unsigned int fSamplingPeriod;
+   std::vector<RNodeInfo> fNodes;
+   std::map<const void *, unsigned int> fNodeIds;
+   /// Per-slot, per-node counters. Each slot owns a separate allocation, so slots do not share cache lines.
+   std::vector<std::vector<RNodeCounters>> fNodeCounters;
+   std::vector<RSlotData> fSlotData; ///< Per-slot data, stepped through with CacheLineStep to avoid false sharing
+
+   static Long64_t ElapsedNs(Clock_t::time_point start)
+   {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock_t::now() - start).count();
+   }
+
+   RSlotData &GetSlotData(unsigned int slot) { return fSlotData[slot * CacheLineStep<RSlotData>()]; }
+   const RSlotData &GetSlotData(unsigned int slot) const { return fSlotData[slot * CacheLineStep<RSlotData>()]; }
+
+   /// Estimated total exclusive time of the node in the slot, in seconds
+   double GetNodeTime(unsigned int id, unsigned int slot) const;
+   /// Estimated total read time of the slot, in seconds
+   double GetReadTime(unsigned int slot) const;
+   /// Estimated total exclusive time of all nodes in the slot, in seconds
+   double GetComputeTime(unsigned int slot) const;
+   /// Sum of the wall-clock times of the event-loop tasks over all slots, in seconds
+   double GetLoopTime() const;
+
+public:
+   RLoopProfiler(unsigned int nSlots, unsigned int samplingPeriod);
+   RLoopProfiler(const RLoopProfiler &) = delete;
+   RLoopProfiler &operator=(const RLoopProfiler &) = delete;
+
+   /// Return the identifier of the node, registering it if it was not registered yet. Must be called before
+   /// PrepareEventLoop.
+   unsigned int RegisterNode(ENodeKind kind, const std::string &name, const void *node);
+
+   /// Make room for the counters of the nodes registered since the last event loop.
+   void PrepareEventLoop();
+
+   void BeginTask(unsigned int slot) { GetSlotData(slot).fTaskStart = Clock_t::now(); }
+
+   void EndTask(unsigned int slot)
+   {
+      auto &slotData = GetSlotData(slot);
+      slotData.fLoopTime += ElapsedNs(slotData.fTaskStart);
+      slotData.fIsSampled = false;
+   }
+
+   /// Signal the start of the processing of a new entry, deciding whether its times are measured.
+   void BeginEntry(unsigned int slot)
+   {
+      auto &slotData = GetSlotData(slot);
+      ++slotData.fEntries;
+      slotData.fIsSampled = slotData.fCountdown == 0;
+      if (slotData.fIsSampled) {
+         ++slotData.fSampledEntries;
+         slotData.fCountdown = fSamplingPeriod - 1;
+      } else {
+         --slotData.fCountdown;
+      }
+   }
+
+   /// Return a short summary of the statistics of a node, used to annotate the graph produced by SaveGraph.
+   std::string GetNodeSummary(unsigned int id) const;
+
+   /// Return a short summary of the whole event loop, used to annotate the root of the graph produced by SaveGraph.
+   std::string GetLoopSummary() const;
+
+   /// Return the full report, as a JSON string.
+   std::string AsJSON() const;
+};
+
+/// A column reader that measures the time spent by the reader it wraps, see RLoopProfiler.
+class R__CLING_PTRCHECK(off) RProfiledColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> fReader;
+   RLoopProfiler &fProfiler;
+   unsigned int fSlot;
+
+   void *GetImpl(Long64_t entry) final
+   {
+      RLoopProfiler::RReadScope scope(&fProfiler, fSlot);
+      // the type is irrelevant, we only forward the type-erased address of the value
+      return &fReader->Get<char>(entry);
+   }
+
+public:
+   RProfiledColumnReader(std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> reader, RLoopProfiler &profiler,
+                         unsigned int slot)
+      : fReader(std::move(reader)), fProfiler(profiler), fSlot(slot)
+   {
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RLOOPPROFILER
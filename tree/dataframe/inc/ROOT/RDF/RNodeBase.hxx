@@ -14,6 +14,7 @@
 #include "RtypesCore.h"
 
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -27,6 +28,7 @@ namespace RDF {
 namespace GraphDrawing {
 class GraphNode;
 }
+class RSlotBatch;
 }
 }
 
@@ -48,6 +50,9 @@ public:
    RNodeBase(RLoopManager *lm = nullptr) : fLoopManager(lm) {}
    virtual ~RNodeBase() {}
    virtual bool CheckFilters(unsigned int, Long64_t) = 0;
+   /// Return the selection mask of the entries of the current batch of the slot, one element per entry of the batch.
+   /// Used in batched mode, see ROOT::Internal::RDF::RSlotBatch.
+   virtual const char *CheckFiltersBatch(unsigned int slot, ROOT::Internal::RDF::RSlotBatch &batch) = 0;
    virtual void Report(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void PartialReport(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void IncrChildrenCount() = 0;
@@ -55,6 +60,9 @@ public:
    virtual void AddFilterName(std::vector<std::string> &filters) = 0;
    // Helper function for SaveGraph
    virtual std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> GetGraph() = 0;
+   /// Append to the given string a description of the entries selected by this node: the dataset and the Filters
+   /// and Ranges upstream of this node. Used to identify the on-disk caches written by RInterface::DiskCache.
+   virtual void AddDescription(std::string &description) = 0;
 
    virtual void ResetChildrenCount()
    {
@@ -63,6 +71,16 @@ public:
    }
 
    virtual RLoopManager *GetLoopManagerUnchecked() { return fLoopManager; }
+
+   /// Return the names of the systematic variations that the selection of entries of this node depends on
+   virtual std::vector<std::string> GetVariations() const { return {}; }
+
+   /// Return a clone of this node that selects entries according to the given "variationName:tag", see
+   /// RInterface::Vary. Must only be called, before the event loop, on nodes that depend on that variation.
+   virtual std::shared_ptr<RNodeBase> GetVariedFilter(const std::string & /*variation*/)
+   {
+      throw std::logic_error("This node does not support systematic variations.");
+   }
 };
 } // ns RDF
 } // ns Detail
@@ -13,9 +13,14 @@
 
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
+#include "ROOT/RDF/RSlotBatch.hxx"
 #include "RtypesCore.h"
 
+#include <map>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace ROOT {
 
@@ -36,6 +41,8 @@ template <typename PrevData>
 class RRange final : public RRangeBase {
    const std::shared_ptr<PrevData> fPrevDataPtr;
    PrevData &fPrevData;
+   /// The clones of this range that sit downstream of varied filters, per "variationName:tag"
+   std::map<std::string, std::shared_ptr<RNodeBase>> fVariedRanges;
 
 public:
    RRange(unsigned int start, unsigned int stop, unsigned int stride, std::shared_ptr<PrevData> pd)
@@ -75,6 +82,12 @@ public:
       return fLastResult;
    }
 
+   /// The event loop never runs in batched mode when a Range is booked, see RLoopManager::Run
+   const char *CheckFiltersBatch(unsigned int, RDFInternal::RSlotBatch &) final
+   {
+      throw std::logic_error("RDataFrame: Range nodes cannot be evaluated in batched mode.");
+   }
+
    // recursive chain of `Report`s
    // RRange simply forwards these calls to the previous node
    void Report(ROOT::RDF::RCutFlowReport &rep) const final { fPrevData.PartialReport(rep); }
@@ -98,6 +111,29 @@ public:
 
    /// This function must be defined by all nodes, but only the filters will add their name
    void AddFilterName(std::vector<std::string> &filters) { fPrevData.AddFilterName(filters); }
+
+   void AddDescription(std::string &description) final
+   {
+      fPrevData.AddDescription(description);
+      description += "\nRange(" + std::to_string(fStart) + ";" + std::to_string(fStop) + ";" +
+                     std::to_string(fStride) + ")";
+   }
+
+   /// Ranges do not read columns: they depend on the variations their upstream filters depend on
+   std::vector<std::string> GetVariations() const final { return fPrevData.GetVariations(); }
+
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variation) final
+   {
+      auto it = fVariedRanges.find(variation);
+      if (it != fVariedRanges.end())
+         return it->second;
+
+      auto variedRange =
+         std::make_shared<RRange<RNodeBase>>(fStart, fStop, fStride, fPrevData.GetVariedFilter(variation));
+      fLoopManager->Book(variedRange.get());
+      fVariedRanges[variation] = variedRange;
+      return variedRange;
+   }
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
    {
       // TODO: Ranges node have no information about custom columns, hence it is not possible now
@@ -0,0 +1,142 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RSLOTBATCH
+#define ROOT_RDF_RSLOTBATCH
+
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RVec.hxx"
+#include "RtypesCore.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+class RSlotBatch;
+
+/// Base class of the column readers that store the values of the entries of a batch, see RSlotBatch.
+class R__CLING_PTRCHECK(off) RBatchColumnReaderBase : public ROOT::Detail::RDF::RColumnReaderBase {
+public:
+   /// Store the value of the given entry, which the data source is currently positioned at, at position idx
+   virtual void Gather(unsigned int idx, Long64_t entry) = 0;
+};
+
+/**
+\class ROOT::Internal::RDF::RSlotBatch
+\ingroup dataframe
+\brief The entries of a processing slot that are processed together in batched mode.
+
+Owned by the RLoopManager if batched execution was enabled, see ROOT::RDF::Experimental::EnableBatchedExecution.
+While the data source is positioned at each entry, the values of all input columns read by the computation graph are
+copied into contiguous per-column buffers. The nodes are then run once per batch: filters compute a selection mask for
+all entries of the batch and Defines of fundamental type compute their values for all selected entries in a tight loop
+over contiguous memory, which the compiler can vectorize.
+
+The per-entry interfaces of the nodes keep working in batched mode: they read the entry at GetCurrent().
+*/
+class RSlotBatch {
+   const unsigned int fCapacity;
+   std::vector<Long64_t> fEntries; ///< The entry numbers of the entries in the batch
+   ROOT::RVec<char> fAllPass;      ///< A selection mask that accepts all entries
+   std::vector<RBatchColumnReaderBase *> fReaders;
+   ULong64_t fId = 0;         ///< Changes every time a new batch is started, nodes use it to invalidate their caches
+   unsigned int fSize = 0;    ///< The number of entries in the batch
+   unsigned int fCurrent = 0; ///< The position in the batch of the entry that is currently processed
+
+public:
+   explicit RSlotBatch(unsigned int capacity) : fCapacity(capacity), fEntries(capacity), fAllPass(capacity, 1) {}
+   RSlotBatch(const RSlotBatch &) = delete;
+   RSlotBatch &operator=(const RSlotBatch &) = delete;
+
+   unsigned int GetCapacity() const { return fCapacity; }
+   unsigned int GetSize() const { return fSize; }
+   bool IsFull() const { return fSize == fCapacity; }
+   ULong64_t GetId() const { return fId; }
+   Long64_t GetEntry(unsigned int idx) const { return fEntries[idx]; }
+   unsigned int GetCurrent() const { return fCurrent; }
+   void SetCurrent(unsigned int idx) { fCurrent = idx; }
+   const char *GetAllPassMask() const { return fAllPass.data(); }
+
+   void Register(RBatchColumnReaderBase *reader) { fReaders.push_back(reader); }
+   void Deregister(RBatchColumnReaderBase *reader)
+   {
+      fReaders.erase(std::remove(fReaders.begin(), fReaders.end(), reader), fReaders.end());
+   }
+
+   /// Append the entry the data source is currently positioned at, storing the values of its input columns.
+   void AddEntry(Long64_t entry)
+   {
+      fCurrent = fSize;
+      fEntries[fSize] = entry;
+      for (auto *reader : fReaders)
+         reader->Gather(fSize, entry);
+      ++fSize;
+   }
+
+   /// Discard the entries of the batch and start a new one.
+   void Clear()
+   {
+      fSize = 0;
+      fCurrent = 0;
+      ++fId;
+   }
+};
+
+/// Saves the position of the current entry of a batch and restores it at destruction.
+class RBatchCurrentGuard {
+   RSlotBatch &fBatch;
+   const unsigned int fCurrent;
+
+public:
+   explicit RBatchCurrentGuard(RSlotBatch &batch) : fBatch(batch), fCurrent(batch.GetCurrent()) {}
+   RBatchCurrentGuard(const RBatchCurrentGuard &) = delete;
+   RBatchCurrentGuard &operator=(const RBatchCurrentGuard &) = delete;
+   ~RBatchCurrentGuard() { fBatch.SetCurrent(fCurrent); }
+};
+
+/// Column reader that stores the values read by another reader for all entries of a batch, see RSlotBatch.
+template <typename T>
+class R__CLING_PTRCHECK(off) RBatchColumnReader final : public RBatchColumnReaderBase {
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> fReader;
+   RSlotBatch &fBatch;
+   /// The values of the entries of the batch. Not a std::vector, which does not store booleans contiguously.
+   std::unique_ptr<T[]> fValues;
+   /// Per-entry reads return the address of this copy, as some actions expect the address of a column not to change
+   T fValue;
+
+   void *GetImpl(Long64_t) final
+   {
+      fValue = fValues[fBatch.GetCurrent()];
+      return &fValue;
+   }
+
+   void *GetBatchImpl(RSlotBatch &, const char *) final { return fValues.get(); }
+
+public:
+   RBatchColumnReader(std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> reader, RSlotBatch &batch)
+      : fReader(std::move(reader)), fBatch(batch), fValues(new T[batch.GetCapacity()]()), fValue()
+   {
+      fBatch.Register(this);
+   }
+   RBatchColumnReader(const RBatchColumnReader &) = delete;
+   RBatchColumnReader &operator=(const RBatchColumnReader &) = delete;
+   ~RBatchColumnReader() { fBatch.Deregister(this); }
+
+   void Gather(unsigned int idx, Long64_t entry) final { fValues[idx] = fReader->Get<T>(entry); }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RSLOTBATCH
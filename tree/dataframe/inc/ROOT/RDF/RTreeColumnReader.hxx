@@ -15,17 +15,62 @@
 #include <ROOT/RMakeUnique.hxx>
 #include <ROOT/RVec.hxx>
 #include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
+#include <TDataType.h>
 #include <TTreeReader.h>
 #include <TTreeReaderValue.h>
 #include <TTreeReaderArray.h>
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+class TBranch;
+class TBufferFile;
+class TTree;
 
 namespace ROOT {
 namespace Internal {
 namespace RDF {
 
+/// Reads the values of a branch basket by basket through the TBranch bulk API. The values of a basket are byte-swapped
+/// in place and served from a contiguous buffer, which avoids the per-entry overhead of TTreeReaderValue.
+/// Only branches with a single leaf holding one value of the requested fundamental type qualify; for all other
+/// branches, e.g. arrays or branches of friend trees, GetValuePtr() returns nullptr.
+class RTreeBulkBranchReader {
+   TTreeReader &fTreeReader;
+   std::string fBranchName;
+   EDataType fType;
+   std::size_t fValueSize;
+   /// The tree fBranch belongs to, which changes when a TChain moves on to the next tree
+   TTree *fTree = nullptr;
+   /// The branch in fTree or nullptr if it cannot be read in bulk
+   TBranch *fBranch = nullptr;
+   std::unique_ptr<TBufferFile> fBuffer;
+   /// The values of the current basket, copied out of fBuffer where they are not suitably aligned
+   std::vector<std::max_align_t> fValues;
+   /// The range of tree entries [fFirstEntry, fFirstEntry + fNEntries) currently held by fValues
+   Long64_t fFirstEntry = 0;
+   Long64_t fNEntries = 0;
+
+   bool ResolveBranch();
+   bool LoadBasket(Long64_t entry);
+
+public:
+   RTreeBulkBranchReader(TTreeReader &r, const std::string &branchName, EDataType type, std::size_t valueSize);
+   ~RTreeBulkBranchReader();
+
+   /// Returns the address of the value of the tree's current entry or nullptr if the branch cannot be read in bulk
+   void *GetValuePtr();
+};
+
+/// Columns of these types are read with RTreeBulkColumnReader if the branch allows for it
+template <typename T>
+struct IsBulkReadable : std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value> {
+};
+
 /// RTreeColumnReader specialization for TTree values read via TTreeReaderValues
 template <typename T>
 class R__CLING_PTRCHECK(off) RTreeColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
@@ -50,6 +95,31 @@ public:
    ~RTreeColumnReader() { fTreeValue.reset(); }
 };
 
+/// RTreeColumnReader for values of fundamental types that are read basket by basket via the TBranch bulk API,
+/// with a fallback to TTreeReaderValues for branches that do not support bulk reading.
+template <typename T>
+class R__CLING_PTRCHECK(off) RTreeBulkColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   RTreeBulkBranchReader fBulkReader;
+   std::unique_ptr<TTreeReaderValue<T>> fTreeValue;
+
+   void *GetImpl(Long64_t) final
+   {
+      if (auto valuePtr = fBulkReader.GetValuePtr())
+         return valuePtr;
+      return fTreeValue->Get();
+   }
+
+public:
+   RTreeBulkColumnReader(TTreeReader &r, const std::string &colName)
+      : fBulkReader(r, colName, TDataType::GetType(typeid(T)), sizeof(T)),
+        fTreeValue(std::make_unique<TTreeReaderValue<T>>(r, colName.c_str()))
+   {
+   }
+
+   /// See RTreeColumnReader for why the TTreeReaderValue is reset explicitly.
+   ~RTreeBulkColumnReader() { fTreeValue.reset(); }
+};
+
 /// RTreeColumnReader specialization for TTree values read via TTreeReaderArrays.
 ///
 /// TTreeReaderArrays are used whenever the RDF column type is RVec<T>.
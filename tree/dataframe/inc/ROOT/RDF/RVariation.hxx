@@ -0,0 +1,125 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RVARIATION
+#define ROOT_RVARIATION
+
+#include "ROOT/RDF/ColumnReaderUtils.hxx"
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
+#include "ROOT/RDF/Utils.hxx"
+#include "ROOT/RIntegerSequence.hxx"
+#include "ROOT/RStringView.hxx"
+#include "ROOT/RVec.hxx"
+#include "ROOT/TypeTraits.hxx"
+#include "RtypesCore.h"
+
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+using namespace ROOT::TypeTraits;
+
+/// The node computing the varied values of a column, see RInterface::Vary.
+/// The expression returns an RVec with one varied value per tag.
+template <typename F>
+class R__CLING_PTRCHECK(off) RVariation final : public RVariationBase {
+   using ColumnTypes_t = typename CallableTraits<F>::arg_types;
+   using TypeInd_t = std::make_index_sequence<ColumnTypes_t::list_size>;
+   using ret_type = typename std::decay<typename CallableTraits<F>::ret_type>::type;
+   static_assert(IsRVec_t<ret_type>::value, "Vary expressions must return an RVec with one value per variation tag");
+   using value_type = typename ret_type::value_type;
+
+   F fExpression;
+   const std::vector<std::string> fColumnNames;
+   /// The varied values per slot
+   std::vector<ret_type> fLastResults;
+
+   /// Column readers per slot and per input column
+   std::vector<std::array<std::unique_ptr<RDFDetail::RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
+
+   /// The nth flag signals whether the nth input column is a custom column or not.
+   std::array<bool, ColumnTypes_t::list_size> fIsDefine;
+
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      auto &results = fLastResults[slot * CacheLineStep<ret_type>()];
+      results = fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
+      if (results.size() != fTags.size()) {
+         throw std::runtime_error("The expression of variation \"" + fVariationName + "\" of column \"" +
+                                  fColumnName + "\" returned " + std::to_string(results.size()) + " values but " +
+                                  std::to_string(fTags.size()) + " were expected.");
+      }
+      // silence "unused parameter" warnings in gcc
+      (void)slot;
+      (void)entry;
+   }
+
+public:
+   RVariation(std::string_view columnName, std::string_view variationName, const std::vector<std::string> &tags,
+              std::string_view type, F expression, const std::vector<std::string> &columns, unsigned int nSlots,
+              const RBookedDefines &defines, const std::map<std::string, std::vector<void *>> &DSValuePtrs,
+              ROOT::RDF::RDataSource *ds)
+      : RVariationBase(columnName, variationName, tags, type, nSlots, defines, DSValuePtrs, ds),
+        fExpression(std::move(expression)), fColumnNames(columns),
+        fLastResults(fNSlots * CacheLineStep<ret_type>()), fValues(fNSlots), fIsDefine()
+   {
+      const auto nColumns = fColumnNames.size();
+      for (auto i = 0u; i < nColumns; ++i)
+         fIsDefine[i] = fDefines.HasName(fColumnNames[i]);
+   }
+
+   void InitSlot(TTreeReader *r, unsigned int slot, RSlotBatch *batch) final
+   {
+      if (!fIsInitialized[slot]) {
+         fIsInitialized[slot] = true;
+         RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fDSValuePtrs, fDataSource, nullptr, batch};
+         fValues[slot] = MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
+         fLastCheckedEntry[slot * CacheLineStep<Long64_t>()] = -1;
+      }
+   }
+
+   void *GetValuePtr(unsigned int slot, std::size_t tagIdx) final
+   {
+      return static_cast<void *>(&fLastResults[slot * CacheLineStep<ret_type>()][tagIdx]);
+   }
+
+   const std::type_info &GetTypeId() const final { return typeid(value_type); }
+
+   void Update(unsigned int slot, Long64_t entry) final
+   {
+      if (entry != fLastCheckedEntry[slot * CacheLineStep<Long64_t>()]) {
+         UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+         fLastCheckedEntry[slot * CacheLineStep<Long64_t>()] = entry;
+      }
+   }
+
+   void FinaliseSlot(unsigned int slot) final
+   {
+      if (fIsInitialized[slot]) {
+         for (auto &v : fValues[slot])
+            v.reset();
+         fIsInitialized[slot] = false;
+      }
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RVARIATION
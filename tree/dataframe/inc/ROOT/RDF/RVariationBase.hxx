@@ -0,0 +1,82 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RVARIATIONBASE
+#define ROOT_RVARIATIONBASE
+
+#include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RStringView.hxx"
+#include "RtypesCore.h"
+
+#include <cstddef> // std::size_t
+#include <deque>
+#include <map>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace RDF {
+class RDataSource;
+}
+namespace Internal {
+namespace RDF {
+
+class RSlotBatch;
+
+/// Base class for the nodes that compute the systematic variations of a column, booked via RInterface::Vary.
+/// For each entry, the node evaluates all the varied values of the column at once. Nodes that are evaluated for
+/// the variation "variationName:tag" read the value corresponding to the tag.
+class RVariationBase {
+protected:
+   const std::string fColumnName;           ///< The name of the varied column
+   const std::string fVariationName;        ///< The name of the systematic variation, e.g. "jes"
+   const std::vector<std::string> fTags;    ///< The tags of the varied values, e.g. {"down", "up"}
+   const std::string fType;                 ///< The type of the varied column as a text string
+   const unsigned int fNSlots;              ///< Number of thread slots used by this node
+   std::vector<Long64_t> fLastCheckedEntry;
+   RBookedDefines fDefines;
+   std::deque<bool> fIsInitialized; // because vector<bool> is not thread-safe
+   const std::map<std::string, std::vector<void *>> &fDSValuePtrs; // reference to RLoopManager's data member
+   ROOT::RDF::RDataSource *fDataSource; ///< non-owning ptr to the RDataSource, if any. Used to retrieve column readers.
+
+public:
+   RVariationBase(std::string_view columnName, std::string_view variationName, const std::vector<std::string> &tags,
+                  std::string_view type, unsigned int nSlots, const RBookedDefines &defines,
+                  const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds);
+   RVariationBase(const RVariationBase &) = delete;
+   RVariationBase &operator=(const RVariationBase &) = delete;
+   virtual ~RVariationBase();
+
+   const std::string &GetColumnName() const { return fColumnName; }
+   const std::string &GetVariationName() const { return fVariationName; }
+   const std::vector<std::string> &GetTags() const { return fTags; }
+   const std::string &GetTypeName() const { return fType; }
+   /// Return the index of the tag of the given "variationName:tag" string or fTags.size() if it is not known
+   std::size_t GetTagIndex(const std::string &variation) const;
+
+   /// Get ready to process the entries of a task. `batch` is non-null if the task runs in batched mode, see RSlotBatch.
+   virtual void InitSlot(TTreeReader *r, unsigned int slot, RSlotBatch *batch) = 0;
+   /// Return the (type-erased) address of the varied value with the given tag index for the given processing slot.
+   /// The address is only valid until the next call to Update.
+   virtual void *GetValuePtr(unsigned int slot, std::size_t tagIdx) = 0;
+   /// The type of the varied column, i.e. the value type of the RVec returned by the variation expression
+   virtual const std::type_info &GetTypeId() const = 0;
+   /// Compute the varied values corresponding to the given entry
+   virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Clean-up operations to be performed at the end of a task.
+   virtual void FinaliseSlot(unsigned int slot) = 0;
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RVARIATIONBASE
@@ -0,0 +1,52 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RVARIATIONREADER
+#define ROOT_RDF_RVARIATIONREADER
+
+#include "RColumnReaderBase.hxx"
+#include "RVariationBase.hxx"
+#include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <typeinfo>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// Column reader for one of the varied values of a column, see RInterface::Vary.
+class R__CLING_PTRCHECK(off) RVariationReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   /// Non-owning reference to the node that computes the varied values.
+   RVariationBase &fVariation;
+
+   /// The index of the varied value that this reader returns.
+   std::size_t fTagIdx;
+
+   /// The slot this value belongs to.
+   unsigned int fSlot = std::numeric_limits<unsigned int>::max();
+
+   void *GetImpl(Long64_t entry) final
+   {
+      fVariation.Update(fSlot, entry);
+      return fVariation.GetValuePtr(fSlot, fTagIdx);
+   }
+
+public:
+   /// `variationKey` is a "variationName:tag" string
+   RVariationReader(unsigned int slot, RVariationBase &variation, const std::string &variationKey,
+                    const std::type_info &tid);
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
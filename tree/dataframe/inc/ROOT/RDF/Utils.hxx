@@ -204,6 +204,12 @@ bool IsInternalColumn(std::string_view colName);
 /// Get optimal column width for printing a table given the names and the desired minimal space between columns
 unsigned int GetColumnWidth(const std::vector<std::string>& names, const unsigned int minColumnSpace = 8u);
 
+/// Return the name of the systematic variation a "variationName:tag" string refers to, see RInterface::Vary
+std::string GetVariationName(const std::string &variation);
+
+/// Add to `v` the elements of `other` that it does not contain yet
+void AddUnique(std::vector<std::string> &v, const std::vector<std::string> &other);
+
 // We could just check `#ifdef __cpp_lib_hardware_interference_size`, but at least on Mac 11
 // libc++ defines that macro but is missing the actual feature, so we use an ad-hoc ROOT macro instead.
 // See the relevant entry in cmake/modules/RootConfiguration.cmake for more info.
@@ -17,6 +17,7 @@
 #include <ROOT/RResultHandle.hxx>
 #include <ROOT/RDF/GraphUtils.hxx>
 #include <ROOT/RIntegerSequence.hxx>
+#include <ROOT/RStringView.hxx>
 #include <ROOT/TypeTraits.hxx>
 
 #include <algorithm> // std::transform
@@ -26,6 +27,8 @@
 #include <memory>
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
+#include <string>
 
 namespace ROOT {
 namespace Internal {
@@ -181,6 +184,125 @@ RNode AsRNode(NodeType node)
 // clang-format on
 void RunGraphs(std::vector<RResultHandle> handles);
 
+namespace Experimental {
+
+// clang-format off
+/// Enable the profiling of the event loops of a computation graph.
+/// \param[in] node any node of the graph, or any result booked on it.
+/// \param[in] samplingPeriod wall-clock times are measured for one entry out of every samplingPeriod entries processed by each thread.
+///
+/// The event loops that run after this call count the evaluations of each Define, Filter and action and measure
+/// their exclusive wall-clock time, i.e. excluding the time spent in upstream Defines and reading input columns.
+/// The time spent reading TTree branches and data source entries is reported separately, as is the time spent in
+/// the event loop machinery itself. Per-thread times are kept, which exposes load imbalance between threads.
+/// Since times are only measured on a sample of the entries and counters are never shared between threads, the
+/// overhead is small enough to leave profiling enabled in production. Statistics accumulate over all event loops
+/// that run after profiling is enabled.
+///
+/// Once enabled, SaveGraph annotates each node with its time, its share of the event loop time and its number of
+/// calls. The full report, including per-thread times, is returned in JSON format by SaveProfile.
+///
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// auto h = df.Filter("x > 0").Define("y", "x * x").Histo1D("y");
+/// ROOT::RDF::Experimental::EnableProfiling(df);
+/// h->Draw(); // runs the event loop
+/// ROOT::RDF::SaveGraph(df, "graph.dot");
+/// ROOT::RDF::Experimental::SaveProfile(df, "profile.json");
+/// ~~~
+// clang-format on
+template <typename NodeType>
+void EnableProfiling(NodeType node, unsigned int samplingPeriod = 16)
+{
+   ROOT::Internal::RDF::GraphDrawing::GraphCreatorHelper::GetLoopManager(node)->EnableProfiling(samplingPeriod);
+}
+
+// clang-format off
+/// Return the statistics of the profiled event loops of a computation graph in JSON format, see EnableProfiling.
+/// \param[in] node any node of the graph, or any result booked on it.
+///
+/// Times are in seconds. Each node reports its kind, name, number of calls, estimated total time, fraction of the
+/// event loop time, the time spent in each thread slot and the imbalance between slots (the ratio between the time
+/// of the busiest slot and the average over the slots that processed entries).
+// clang-format on
+template <typename NodeType>
+std::string SaveProfile(NodeType node)
+{
+   auto *profiler = ROOT::Internal::RDF::GraphDrawing::GraphCreatorHelper::GetLoopManager(node)->GetProfiler();
+   if (profiler == nullptr)
+      throw std::runtime_error(
+         "SaveProfile: profiling was not enabled for this computation graph, see EnableProfiling.");
+   return profiler->AsJSON();
+}
+
+// clang-format off
+/// Write the statistics of the profiled event loops of a computation graph in JSON format to the specified file.
+/// \param[in] node any node of the graph, or any result booked on it.
+/// \param[in] outputFile file where to save the report.
+// clang-format on
+template <typename NodeType>
+void SaveProfile(NodeType node, const std::string &outputFile)
+{
+   const auto json = SaveProfile(node);
+
+   std::ofstream out(outputFile);
+   if (!out.is_open())
+      throw std::runtime_error("Could not open output file \"" + outputFile + "\" for writing");
+
+   out << json;
+}
+
+// clang-format off
+/// Run the event loops of a computation graph in batched mode.
+/// \param[in] node any node of the graph, or any result booked on it.
+/// \param[in] batchSize the number of entries that each thread processes at a time.
+///
+/// The entries of each thread are processed in batches: the values of the input columns of all entries of a batch are
+/// read into contiguous buffers, then each Filter evaluates a selection mask for the whole batch and each Define of
+/// fundamental type computes its values for all selected entries at once. This amortizes the cost of the per-entry
+/// calls through the computation graph and lets the compiler vectorize simple numerical expressions.
+/// The event loops that are profiled, that have callbacks registered or that contain Ranges still run entry by entry.
+///
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// ROOT::RDF::Experimental::EnableBatchedExecution(df, 512);
+/// auto h = df.Filter("x > 0").Define("y", "x * x").Histo1D("y");
+/// ~~~
+// clang-format on
+template <typename NodeType>
+void EnableBatchedExecution(NodeType node, unsigned int batchSize = 256)
+{
+   ROOT::Internal::RDF::GraphDrawing::GraphCreatorHelper::GetLoopManager(node)->EnableBatching(batchSize);
+}
+
+// clang-format off
+/// Set the directory of the persistent cache of compiled Filter and Define expressions.
+/// \param[in] dir the cache directory, which is created if needed. An empty string disables the cache.
+///
+/// String expressions passed to Filter and Define are just-in-time compiled by the interpreter before the event loop
+/// starts, which can take a long time for large computation graphs. With the cache enabled, each expression is keyed by
+/// its source text and by the types of its input columns. Expressions that are not in the cache are compiled into a
+/// shared library in the cache directory after they have been jitted; later processes that use the same expressions
+/// load that library and do not generate code for them. The cache can be shared by concurrent processes, e.g. the jobs
+/// of a batch submission. Expressions that cannot be compiled outside of the interpreter, for example because they
+/// call functions declared at runtime, are always jitted.
+///
+/// The default directory is the value of the ROOT_RDF_JITCACHEDIR environment variable or, if that is not set, of the
+/// RDataFrame.JitCacheDir entry of the rootrc files. The cache is disabled if neither is set.
+///
+/// ~~~{.cpp}
+/// ROOT::RDF::Experimental::SetJitCacheDir("/scratch/rdfjitcache");
+/// ROOT::RDataFrame df("tree", "file.root");
+/// auto h = df.Filter("x > 0").Define("y", "x * x").Histo1D("y");
+/// ~~~
+// clang-format on
+void SetJitCacheDir(std::string_view dir);
+
+/// Return the directory of the persistent cache of compiled Filter and Define expressions, see SetJitCacheDir.
+std::string GetJitCacheDir();
+
+} // namespace Experimental
+
 } // namespace RDF
 } // namespace ROOT
 #endif
@@ -43,6 +43,13 @@ class RNTupleColumnReader;
 }
 
 class RNTupleDS final : public ROOT::RDF::RDataSource {
+   /// A value range of a column that restricts the entry ranges to the clusters that may contain such values
+   struct RClusterFilter {
+      DescriptorId_t fColumnId;
+      double fMin;
+      double fMax;
+   };
+
    /// Clones of the first source, one for each slot
    std::vector<std::unique_ptr<ROOT::Experimental::Detail::RPageSource>> fSources;
 
@@ -56,6 +63,7 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
 
    unsigned fNSlots = 0;
    bool fHasSeenAllRanges = false;
+   std::vector<RClusterFilter> fClusterFilters;
 
    /// Provides the RDF column "colName" given the field identified by fieldID. For records and collections,
    /// AddField recurses into the sub fields. The skeinIDs is the list of field IDs of the outer collections
@@ -80,6 +88,13 @@ public:
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
    std::string GetLabel() final { return "RNTupleDS"; }
 
+   /// Only provide the entries of clusters that, according to the cluster statistics, may contain values of
+   /// column colName within the closed interval [min, max].  The cluster filter is an optimization: entries of
+   /// the remaining clusters are provided unfiltered, so that the corresponding RDataFrame Filter is still required.
+   /// The column must be backed by a simple field of arithmetic type outside collections. Multiple cluster filters
+   /// are combined by logical AND. Throws an exception if the column is not suited for cluster filtering.
+   void AddClusterFilter(std::string_view colName, double min, double max);
+
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
 
    void Initialise() final;
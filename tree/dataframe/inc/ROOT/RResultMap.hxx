@@ -0,0 +1,158 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RRESULTMAP
+#define ROOT_RDF_RRESULTMAP
+
+#include "ROOT/RResultPtr.hxx"
+#include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility> // std::declval
+#include <vector>
+
+namespace ROOT {
+
+namespace Internal {
+namespace RDF {
+
+// this overload is chosen for results that can be attached to a directory, e.g. histograms: the varied results
+// must not be registered to gDirectory, exactly like the nominal result
+template <typename T>
+auto CloneResultImpl(const T &nominal, int) -> decltype(std::declval<T &>().SetDirectory(nullptr), std::shared_ptr<T>())
+{
+   auto clone = std::make_shared<T>(nominal);
+   clone->SetDirectory(nullptr);
+   return clone;
+}
+
+template <typename T>
+std::shared_ptr<T> CloneResultImpl(const T &nominal, long)
+{
+   return std::make_shared<T>(nominal);
+}
+
+/// Create the initial value of a varied result as a copy of the (not yet filled) nominal result
+template <typename T>
+std::shared_ptr<T> CloneResult(const T &nominal)
+{
+   return CloneResultImpl(nominal, 0);
+}
+
+} // namespace RDF
+} // namespace Internal
+
+namespace RDF {
+namespace Experimental {
+
+/**
+\class ROOT::RDF::Experimental::RResultMap
+\ingroup dataframe
+\brief The nominal and the systematically varied results of an RDataFrame action, see VariationsFor().
+\tparam T Type of the action result
+
+The results are accessed via the variation key, "nominal" for the nominal result or "variationName:tag" for the
+varied ones. Accessing any of the results triggers the event loop, if needed: all results are produced in the same
+event loop.
+*/
+template <typename T>
+class RResultMap {
+   template <typename T1>
+   friend RResultMap<T1> VariationsFor(RResultPtr<T1> resPtr);
+
+   /// The keys of the results, in booking order: the nominal result is always the first
+   std::vector<std::string> fKeys;
+   std::unordered_map<std::string, std::shared_ptr<T>> fMap;
+   /// The actions that produce the results. Ownership is shared with the RResultPtr of the nominal result.
+   std::vector<std::shared_ptr<ROOT::Internal::RDF::RActionBase>> fActions;
+   /// Non-owning pointer to the RLoopManager, which must be in scope while the results are accessed
+   ROOT::Detail::RDF::RLoopManager *fLoopManager;
+
+   RResultMap(std::vector<std::string> &&keys, std::unordered_map<std::string, std::shared_ptr<T>> &&map,
+              std::vector<std::shared_ptr<ROOT::Internal::RDF::RActionBase>> &&actions,
+              ROOT::Detail::RDF::RLoopManager *lm)
+      : fKeys(std::move(keys)), fMap(std::move(map)), fActions(std::move(actions)), fLoopManager(lm)
+   {
+   }
+
+public:
+   /// Return the result corresponding to the given key, running the event loop if needed.
+   /// Throws if the key is not known.
+   T &operator[](const std::string &key)
+   {
+      auto it = fMap.find(key);
+      if (it == fMap.end())
+         throw std::runtime_error("RResultMap: no result with key \"" + key + "\".");
+
+      for (auto &action : fActions) {
+         if (!action->HasRun()) {
+            fLoopManager->Run();
+            break;
+         }
+      }
+      return *it->second;
+   }
+
+   /// Return the keys of the results, "nominal" first
+   const std::vector<std::string> &GetKeys() const { return fKeys; }
+};
+
+/// \brief Produce all the systematic variations of the given result.
+/// \param[in] resPtr The nominal result of an action, booked but not yet computed.
+/// \return A RResultMap with the nominal result and one varied result for each tag of each variation it depends on.
+///
+/// The varied results are booked in the same computation graph as the nominal result and are filled in the same
+/// event loop. Only actions whose helper implements `MakeNew` (e.g. Count, Sum, Mean, Min, Max, StdDev, Graph and
+/// the histogram actions) support variations; an exception is thrown for the others, if the result depends on a
+/// variation. See RInterface::Vary for how to register the variations.
+template <typename T>
+RResultMap<T> VariationsFor(RResultPtr<T> resPtr)
+{
+   R__ASSERT(resPtr != nullptr && "Calling VariationsFor on an empty RResultPtr");
+
+   auto *lm = resPtr.fLoopManager;
+   // the graph of jitted nodes must be complete before it can be cloned
+   lm->Jit();
+
+   auto &nominalAction = resPtr.fActionPtr;
+   if (nominalAction->HasRun()) {
+      throw std::logic_error("VariationsFor: the result was already computed. Variations must be requested before "
+                             "the event loop runs.");
+   }
+
+   std::vector<std::string> keys{"nominal"};
+   std::unordered_map<std::string, std::shared_ptr<T>> results{{"nominal", resPtr.fObjPtr}};
+   std::vector<std::shared_ptr<ROOT::Internal::RDF::RActionBase>> actions{nominalAction};
+
+   for (const auto &variationName : nominalAction->GetVariations()) {
+      for (const auto &tag : lm->GetVariationTags(variationName)) {
+         const auto key = variationName + ":" + tag;
+         auto variedResult = ROOT::Internal::RDF::CloneResult(*resPtr.fObjPtr);
+         std::shared_ptr<ROOT::Internal::RDF::RActionBase> variedAction =
+            nominalAction->MakeVariedAction(key, &variedResult);
+         lm->Book(variedAction.get());
+
+         keys.emplace_back(key);
+         results[key] = std::move(variedResult);
+         actions.emplace_back(std::move(variedAction));
+      }
+   }
+
+   return RResultMap<T>(std::move(keys), std::move(results), std::move(actions), lm);
+}
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_RRESULTMAP
@@ -18,6 +18,13 @@
 namespace ROOT {
 
 namespace RDF {
+/// The data format in which Snapshot writes its output
+enum class ESnapshotOutputFormat {
+   kDefault, ///< Currently the same as kTTree
+   kTTree,   ///< Write a TTree, merging the output of the different threads through a TBufferMerger
+   kRNTuple  ///< Write an RNTuple: every thread compresses its own clusters, no merging thread is involved
+};
+
 /// A collection of options to steer the creation of the dataset on file
 struct RSnapshotOptions {
    using ECAlgo = ROOT::ECompressionAlgorithm;
@@ -37,6 +44,7 @@ struct RSnapshotOptions {
    int fSplitLevel = 99;                       ///< Split level of output tree
    bool fLazy = false;                         ///< Do not start the event loop when Snapshot is called
    bool fOverwriteIfExists = false; ///< If fMode is "UPDATE", overwrite object in output file if it already exists
+   ESnapshotOutputFormat fOutputFormat = ESnapshotOutputFormat::kDefault; ///< Which data format to write
 };
 } // ns RDF
 } // ns ROOT
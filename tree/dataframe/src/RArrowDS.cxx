@@ -23,6 +23,13 @@ ROOT::RDF::MakeArrowDataFrame, which accepts one parameter:
 The types of the columns are derived from the types in the associated
 arrow::Schema.
 
+Columns of fundamental type and lists of fundamental types are read without
+copies: the values passed to RDataFrame point directly to the arrow buffers,
+and lists are exposed as RVecs that adopt the memory of their elements.
+
+RDataFrame columns can be written to arrow tables and Arrow IPC files with
+ROOT::RDF::Experimental::SnapshotToArrow.
+
 */
 // clang-format on
 
@@ -34,13 +41,19 @@ arrow::Schema.
 
 #include <algorithm>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <typeinfo>
+#include <utility>
 
 #if defined(__GNUC__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wshadow"
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #endif
+#include <arrow/builder.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
 #include <arrow/table.h>
 #include <arrow/stl.h>
 #if defined(__GNUC__)
@@ -66,6 +79,7 @@ struct RootConversionTraits {};
    };
 
 ROOT_ARROW_STL_CONVERSION(bool, BooleanType)
+ROOT_ARROW_STL_CONVERSION(char, Int8Type)
 ROOT_ARROW_STL_CONVERSION(int8_t, Int8Type)
 ROOT_ARROW_STL_CONVERSION(int16_t, Int16Type)
 ROOT_ARROW_STL_CONVERSION(int32_t, Int32Type)
@@ -91,10 +105,16 @@ private:
    RVec<UInt_t> fCachedRVecUInt;
    RVec<Long64_t> fCachedRVecLong64;
    RVec<Int_t> fCachedRVecInt;
+   RVec<UShort_t> fCachedRVecUShort;
+   RVec<Short_t> fCachedRVecShort;
+   RVec<UChar_t> fCachedRVecUChar;
+   RVec<Char_t> fCachedRVecChar;
    std::string fCachedString;
    /// The entry in the array which should be looked up.
    ULong64_t fCurrentEntry;
 
+   /// Point the cached RVec to the values of the entry, without copying them: the RVec adopts the memory of the
+   /// arrow buffer.
    template <typename T>
    void *getTypeErasedPtrFrom(arrow::ListArray const &array, int32_t entry, RVec<T> &cache)
    {
@@ -114,6 +134,30 @@ public:
 
    void SetEntry(ULong64_t entry) { fCurrentEntry = entry; }
 
+   virtual arrow::Status Visit(arrow::Int8Array const &array) final
+   {
+      *fResult = (void *)(array.raw_values() + fCurrentEntry);
+      return arrow::Status::OK();
+   }
+
+   virtual arrow::Status Visit(arrow::UInt8Array const &array) final
+   {
+      *fResult = (void *)(array.raw_values() + fCurrentEntry);
+      return arrow::Status::OK();
+   }
+
+   virtual arrow::Status Visit(arrow::Int16Array const &array) final
+   {
+      *fResult = (void *)(array.raw_values() + fCurrentEntry);
+      return arrow::Status::OK();
+   }
+
+   virtual arrow::Status Visit(arrow::UInt16Array const &array) final
+   {
+      *fResult = (void *)(array.raw_values() + fCurrentEntry);
+      return arrow::Status::OK();
+   }
+
    /// Check if we are asking the same entry as before.
    virtual arrow::Status Visit(arrow::Int32Array const &array) final
    {
@@ -161,7 +205,10 @@ public:
 
    virtual arrow::Status Visit(arrow::StringArray const &array) final
    {
-      fCachedString = array.GetString(fCurrentEntry);
+      // assign rather than construct a new string, so that the capacity of the cached string is reused
+      int32_t length = 0;
+      const auto *data = array.GetValue(fCurrentEntry, &length);
+      fCachedString.assign(reinterpret_cast<const char *>(data), length);
       *fResult = reinterpret_cast<void *>(&fCachedString);
       return arrow::Status::OK();
    }
@@ -193,6 +240,22 @@ public:
          *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecLong64);
          return arrow::Status::OK();
       }
+      case arrow::Type::UINT16: {
+         *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecUShort);
+         return arrow::Status::OK();
+      }
+      case arrow::Type::INT16: {
+         *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecShort);
+         return arrow::Status::OK();
+      }
+      case arrow::Type::UINT8: {
+         *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecUChar);
+         return arrow::Status::OK();
+      }
+      case arrow::Type::INT8: {
+         *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecChar);
+         return arrow::Status::OK();
+      }
       default: return arrow::Status::TypeError("Type not supported");
       }
    }
@@ -286,6 +349,167 @@ public:
    }
 };
 
+static void ThrowIfNotOk(const arrow::Status &status, const std::string &what)
+{
+   if (!status.ok())
+      throw std::runtime_error("SnapshotToArrow: " + what + ": " + status.ToString());
+}
+
+/// Appends values of type T to an arrow array of type ArrowType.
+template <typename T, typename ArrowType>
+class RArrowColumnBuilder final : public RArrowColumnBuilderBase {
+   typename arrow::TypeTraits<ArrowType>::BuilderType fBuilder;
+
+public:
+   void Append(const void *value) final
+   {
+      ThrowIfNotOk(fBuilder.Append(*static_cast<const T *>(value)), "could not append a value");
+   }
+
+   std::shared_ptr<arrow::Array> Finish() final
+   {
+      std::shared_ptr<arrow::Array> array;
+      ThrowIfNotOk(fBuilder.Finish(&array), "could not build an array");
+      return array;
+   }
+
+   std::shared_ptr<arrow::DataType> GetType() const final { return arrow::TypeTraits<ArrowType>::type_singleton(); }
+};
+
+/// Appends RVec<T> values to an arrow list array with values of type ArrowType.
+/// The elements of each RVec are appended with a single copy of its contiguous buffer.
+template <typename T, typename ArrowType>
+class RArrowListColumnBuilder final : public RArrowColumnBuilderBase {
+   using ValueBuilder_t = typename arrow::TypeTraits<ArrowType>::BuilderType;
+   using CType_t = typename ArrowType::c_type;
+   static_assert(sizeof(T) == sizeof(CType_t), "The RVec elements do not have the layout of the arrow values.");
+
+   std::shared_ptr<ValueBuilder_t> fValueBuilder;
+   arrow::ListBuilder fBuilder;
+
+public:
+   RArrowListColumnBuilder()
+      : fValueBuilder(std::make_shared<ValueBuilder_t>()), fBuilder(arrow::default_memory_pool(), fValueBuilder)
+   {
+   }
+
+   void Append(const void *value) final
+   {
+      const auto &vec = *static_cast<const ROOT::VecOps::RVec<T> *>(value);
+      ThrowIfNotOk(fBuilder.Append(), "could not append a collection");
+      ThrowIfNotOk(fValueBuilder->AppendValues(reinterpret_cast<const CType_t *>(vec.data()), vec.size()),
+                   "could not append the elements of a collection");
+   }
+
+   std::shared_ptr<arrow::Array> Finish() final
+   {
+      std::shared_ptr<arrow::Array> array;
+      ThrowIfNotOk(fBuilder.Finish(&array), "could not build an array");
+      return array;
+   }
+
+   std::shared_ptr<arrow::DataType> GetType() const final
+   {
+      return arrow::list(arrow::TypeTraits<ArrowType>::type_singleton());
+   }
+};
+
+std::unique_ptr<RArrowColumnBuilderBase> MakeArrowColumnBuilder(const std::string &typeName)
+{
+   const std::type_info *type = nullptr;
+   try {
+      type = &TypeName2TypeID(typeName);
+   } catch (const std::runtime_error &) {
+      throw std::runtime_error("SnapshotToArrow: columns of type " + typeName + " are not supported.");
+   }
+
+#define ROOT_ARROW_COLUMN_BUILDER(c_type, ArrowType_)                                          \
+   if (*type == typeid(c_type))                                                                \
+      return std::make_unique<RArrowColumnBuilder<c_type, ::arrow::ArrowType_>>();             \
+   if (*type == typeid(ROOT::VecOps::RVec<c_type>))                                            \
+      return std::make_unique<RArrowListColumnBuilder<c_type, ::arrow::ArrowType_>>();
+
+   ROOT_ARROW_COLUMN_BUILDER(char, Int8Type)
+   ROOT_ARROW_COLUMN_BUILDER(unsigned char, UInt8Type)
+   ROOT_ARROW_COLUMN_BUILDER(short, Int16Type)
+   ROOT_ARROW_COLUMN_BUILDER(unsigned short, UInt16Type)
+   ROOT_ARROW_COLUMN_BUILDER(int, Int32Type)
+   ROOT_ARROW_COLUMN_BUILDER(unsigned int, UInt32Type)
+   ROOT_ARROW_COLUMN_BUILDER(Long64_t, Int64Type)
+   ROOT_ARROW_COLUMN_BUILDER(ULong64_t, UInt64Type)
+   ROOT_ARROW_COLUMN_BUILDER(float, FloatType)
+   ROOT_ARROW_COLUMN_BUILDER(double, DoubleType)
+#undef ROOT_ARROW_COLUMN_BUILDER
+
+   // RVec<bool> does not store its elements contiguously, so only plain booleans are supported
+   if (*type == typeid(bool))
+      return std::make_unique<RArrowColumnBuilder<bool, arrow::BooleanType>>();
+   if (*type == typeid(std::string))
+      return std::make_unique<RArrowColumnBuilder<std::string, arrow::StringType>>();
+
+   throw std::runtime_error("SnapshotToArrow: columns of type " + typeName + " are not supported.");
+}
+
+// To support both arrow 0.14.0, whose tables are made of arrow::Columns, and later versions
+template <typename ColumnType>
+std::shared_ptr<ColumnType>
+makeColumn(std::shared_ptr<arrow::Field> field, std::shared_ptr<arrow::ChunkedArray> chunkedArray)
+{
+   return std::make_shared<ColumnType>(field, chunkedArray);
+}
+
+template <>
+std::shared_ptr<arrow::ChunkedArray>
+makeColumn<arrow::ChunkedArray>(std::shared_ptr<arrow::Field>, std::shared_ptr<arrow::ChunkedArray> chunkedArray)
+{
+   return chunkedArray;
+}
+
+static void WriteArrowFile(const arrow::Table &table, const std::string &fileName)
+{
+   std::shared_ptr<arrow::io::FileOutputStream> stream;
+   ThrowIfNotOk(arrow::io::FileOutputStream::Open(fileName, &stream), "could not open " + fileName);
+   std::shared_ptr<arrow::ipc::RecordBatchWriter> writer;
+   ThrowIfNotOk(arrow::ipc::RecordBatchFileWriter::Open(stream.get(), table.schema(), &writer),
+                "could not write to " + fileName);
+   ThrowIfNotOk(writer->WriteTable(table), "could not write to " + fileName);
+   ThrowIfNotOk(writer->Close(), "could not write to " + fileName);
+   ThrowIfNotOk(stream->Close(), "could not close " + fileName);
+}
+
+RArrowSnapshotHelper::RArrowSnapshotHelper(std::string_view fileName, const std::vector<std::string> &columnNames,
+                                           const std::vector<std::string> &columnTypes, unsigned int nSlots)
+   : fFileName(fileName), fColumnNames(columnNames), fBuilders(nSlots), fTable(std::make_shared<Result_t>())
+{
+   for (auto &slotBuilders : fBuilders)
+      for (const auto &columnType : columnTypes)
+         slotBuilders.emplace_back(MakeArrowColumnBuilder(columnType));
+}
+
+void RArrowSnapshotHelper::Finalize()
+{
+   using ColumnType = decltype(std::declval<arrow::Table>().column(0))::element_type;
+
+   std::vector<std::shared_ptr<arrow::Field>> fields;
+   std::vector<std::shared_ptr<ColumnType>> columns;
+   for (auto i = 0u; i < fColumnNames.size(); ++i) {
+      // the arrays of the different slots become the chunks of the column, no copy needed
+      arrow::ArrayVector chunks;
+      for (auto &slotBuilders : fBuilders) {
+         auto array = slotBuilders[i]->Finish();
+         if (array->length() > 0)
+            chunks.emplace_back(std::move(array));
+      }
+      const auto type = fBuilders.front()[i]->GetType();
+      fields.emplace_back(arrow::field(fColumnNames[i], type));
+      columns.emplace_back(makeColumn<ColumnType>(fields.back(), std::make_shared<arrow::ChunkedArray>(chunks, type)));
+   }
+   *fTable = arrow::Table::Make(arrow::schema(fields), columns);
+
+   if (!fFileName.empty())
+      WriteArrowFile(**fTable, fFileName);
+}
+
 } // namespace RDF
 } // namespace Internal
 
@@ -319,6 +543,26 @@ public:
       fTypeName.push_back("UInt_t");
       return arrow::Status::OK();
    }
+   arrow::Status Visit(const arrow::Int16Type &) override
+   {
+      fTypeName.push_back("Short_t");
+      return arrow::Status::OK();
+   }
+   arrow::Status Visit(const arrow::UInt16Type &) override
+   {
+      fTypeName.push_back("UShort_t");
+      return arrow::Status::OK();
+   }
+   arrow::Status Visit(const arrow::Int8Type &) override
+   {
+      fTypeName.push_back("Char_t");
+      return arrow::Status::OK();
+   }
+   arrow::Status Visit(const arrow::UInt8Type &) override
+   {
+      fTypeName.push_back("UChar_t");
+      return arrow::Status::OK();
+   }
    arrow::Status Visit(const arrow::FloatType &) override
    {
       fTypeName.push_back("float");
@@ -371,6 +615,10 @@ public:
    virtual arrow::Status Visit(const arrow::UInt64Type &) override { return arrow::Status::OK(); }
    virtual arrow::Status Visit(const arrow::Int32Type &) override { return arrow::Status::OK(); }
    virtual arrow::Status Visit(const arrow::UInt32Type &) override { return arrow::Status::OK(); }
+   virtual arrow::Status Visit(const arrow::Int16Type &) override { return arrow::Status::OK(); }
+   virtual arrow::Status Visit(const arrow::UInt16Type &) override { return arrow::Status::OK(); }
+   virtual arrow::Status Visit(const arrow::Int8Type &) override { return arrow::Status::OK(); }
+   virtual arrow::Status Visit(const arrow::UInt8Type &) override { return arrow::Status::OK(); }
    virtual arrow::Status Visit(const arrow::FloatType &) override { return arrow::Status::OK(); }
    virtual arrow::Status Visit(const arrow::DoubleType &) override { return arrow::Status::OK(); }
    virtual arrow::Status Visit(const arrow::StringType &) override { return arrow::Status::OK(); }
@@ -10,6 +10,61 @@
 
 #include "ROOT/RDF/ActionHelpers.hxx"
 
+#ifdef R__RDF_HAS_RNTUPLE
+#include "ROOT/REntry.hxx"
+#include "ROOT/RField.hxx"
+#include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RNTupleOptions.hxx"
+#include "ROOT/RNTupleParallelWriter.hxx"
+#include "ROOT/RPageStorageFile.hxx"
+#endif
+
+#ifdef R__RDF_HAS_RNTUPLE
+namespace {
+using ROOT::Experimental::RField;
+using ROOT::Experimental::Detail::RFieldBase;
+
+/// RFieldBase::Create() reads RVecs as std::vectors, which have a different memory layout: the RVec columns of a
+/// Snapshot must be written through the RVec fields of the corresponding item type.
+std::unique_ptr<RFieldBase> MakeSnapshotField(const std::string &fieldName, const std::string &typeName)
+{
+   const std::string rvecPrefix = "ROOT::VecOps::RVec<";
+   if (typeName.compare(0, rvecPrefix.size(), rvecPrefix) != 0 || typeName == "ROOT::VecOps::RVec<bool>")
+      return RFieldBase::Create(fieldName, typeName).Unwrap();
+
+   const auto itemTypeName = typeName.substr(rvecPrefix.size(), typeName.size() - rvecPrefix.size() - 1);
+   const auto itemType = RFieldBase::Create("_0", itemTypeName).Unwrap()->GetType();
+   if (itemType == "char")
+      return std::make_unique<RField<ROOT::VecOps::RVec<char>>>(fieldName);
+   if (itemType == "std::int8_t")
+      return std::make_unique<RField<ROOT::VecOps::RVec<std::int8_t>>>(fieldName);
+   if (itemType == "std::uint8_t")
+      return std::make_unique<RField<ROOT::VecOps::RVec<std::uint8_t>>>(fieldName);
+   if (itemType == "std::int16_t")
+      return std::make_unique<RField<ROOT::VecOps::RVec<std::int16_t>>>(fieldName);
+   if (itemType == "std::uint16_t")
+      return std::make_unique<RField<ROOT::VecOps::RVec<std::uint16_t>>>(fieldName);
+   if (itemType == "std::int32_t")
+      return std::make_unique<RField<ROOT::VecOps::RVec<std::int32_t>>>(fieldName);
+   if (itemType == "std::uint32_t")
+      return std::make_unique<RField<ROOT::VecOps::RVec<std::uint32_t>>>(fieldName);
+   if (itemType == "std::int64_t")
+      return std::make_unique<RField<ROOT::VecOps::RVec<std::int64_t>>>(fieldName);
+   if (itemType == "std::uint64_t")
+      return std::make_unique<RField<ROOT::VecOps::RVec<std::uint64_t>>>(fieldName);
+   if (itemType == "float")
+      return std::make_unique<RField<ROOT::VecOps::RVec<float>>>(fieldName);
+   if (itemType == "double")
+      return std::make_unique<RField<ROOT::VecOps::RVec<double>>>(fieldName);
+   if (itemType == "std::string")
+      return std::make_unique<RField<ROOT::VecOps::RVec<std::string>>>(fieldName);
+
+   throw std::runtime_error("Snapshot: column \"" + fieldName + "\" of type " + typeName +
+                            " cannot be written to RNTuple.");
+}
+} // anonymous namespace
+#endif
+
 namespace ROOT {
 namespace Internal {
 namespace RDF {
@@ -264,6 +319,97 @@ void ValidateSnapshotOutput(const RSnapshotOptions &opts, const std::string &tre
    }
 }
 
+RNTupleSnapshotWriter::RNTupleSnapshotWriter(unsigned int nSlots, const std::string &fileName,
+                                             const std::string &ntupleName, const ColumnNames_t &fieldNames,
+                                             const std::vector<std::string> &typeNames,
+                                             const RSnapshotOptions &options)
+   : fFillContexts(nSlots), fFields(nSlots)
+{
+#ifdef R__RDF_HAS_RNTUPLE
+   auto model = ROOT::Experimental::RNTupleModel::Create();
+   for (std::size_t i = 0; i < fieldNames.size(); ++i)
+      model->AddField(MakeSnapshotField(fieldNames[i], typeNames[i]));
+
+   ROOT::Experimental::RNTupleWriteOptions writeOptions;
+   writeOptions.SetCompression(ROOT::CompressionSettings(options.fCompressionAlgorithm, options.fCompressionLevel));
+   // the fill contexts seal entire clusters, the sink writes them out as they come
+   writeOptions.SetUseBufferedWrite(false);
+
+   TString fileMode = options.fMode;
+   fileMode.ToLower();
+   if (fileMode == "recreate") {
+      fWriter = ROOT::Experimental::RNTupleParallelWriter::Recreate(std::move(model), ntupleName, fileName,
+                                                                    writeOptions);
+   } else if (fileMode == "update") {
+      fOutputFile.reset(TFile::Open(fileName.c_str(), "UPDATE"));
+      if (!fOutputFile || fOutputFile->IsZombie())
+         throw std::invalid_argument("Snapshot: cannot open file \"" + fileName + "\" in update mode");
+      if (fOutputFile->GetKey(ntupleName.c_str()) != nullptr) {
+         if (!options.fOverwriteIfExists) {
+            throw std::invalid_argument("Snapshot: ntuple \"" + ntupleName + "\" already present in file \"" +
+                                        fileName +
+                                        "\". If you want to delete the original ntuple and write another, please "
+                                        "set RSnapshotOptions::fOverwriteIfExists to true.");
+         }
+         fOutputFile->Delete((ntupleName + ";*").c_str());
+      }
+      auto sink =
+         std::make_unique<ROOT::Experimental::Detail::RPageSinkFile>(ntupleName, *fOutputFile, writeOptions);
+      fWriter = std::make_unique<ROOT::Experimental::RNTupleParallelWriter>(std::move(model), std::move(sink));
+   } else {
+      throw std::invalid_argument("Snapshot: file mode \"" + options.fMode +
+                                  "\" is not supported for RNTuple output, use \"RECREATE\" or \"UPDATE\".");
+   }
+#else
+   (void)fileName;
+   (void)ntupleName;
+   (void)fieldNames;
+   (void)typeNames;
+   (void)options;
+   throw std::runtime_error("Snapshot: RNTuple output requires ROOT to be built with root7=ON.");
+#endif
+}
+
+RNTupleSnapshotWriter::~RNTupleSnapshotWriter() = default;
+
+void RNTupleSnapshotWriter::InitSlot(unsigned int slot)
+{
+#ifdef R__RDF_HAS_RNTUPLE
+   if (fFillContexts[slot])
+      return;
+   fFillContexts[slot] = fWriter->CreateFillContext();
+   fFields[slot] = fFillContexts[slot]->GetModel()->GetFieldZero()->GetSubFields();
+#else
+   (void)slot;
+#endif
+}
+
+void RNTupleSnapshotWriter::Fill(unsigned int slot, void *const *values)
+{
+#ifdef R__RDF_HAS_RNTUPLE
+   // the addresses of the column values can change from entry to entry, hence the values are captured every time
+   ROOT::Experimental::REntry entry;
+   const auto &fields = fFields[slot];
+   for (std::size_t i = 0; i < fields.size(); ++i)
+      entry.CaptureValue(fields[i]->CaptureValue(values[i]));
+   fFillContexts[slot]->Fill(entry);
+#else
+   (void)slot;
+   (void)values;
+#endif
+}
+
+void RNTupleSnapshotWriter::Finalize()
+{
+   // the fill contexts commit their last cluster when destructed, the writer then commits the dataset
+   fFillContexts.clear();
+   fWriter.reset();
+   if (fOutputFile) {
+      fOutputFile->Close();
+      fOutputFile.reset();
+   }
+}
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
@@ -7,6 +7,10 @@
  *************************************************************************/
 
 #include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/RLoopProfiler.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // GetVariationName, AddUnique, IsInternalColumn
 
 namespace ROOT {
 namespace Internal {
@@ -38,6 +42,69 @@ void RBookedDefines::AddName(std::string_view name)
    fDefinesNames = newColsNames;
 }
 
+void RBookedDefines::AddVariation(const std::shared_ptr<RVariationBase> &variation)
+{
+   auto newVariations = std::make_shared<RVariationBasePtrs_t>(GetVariations());
+   newVariations->emplace_back(variation);
+   fVariations = newVariations;
+}
+
+RVariationBase *RBookedDefines::FindVariation(const std::string &colName, const std::string &variation) const
+{
+   for (const auto &v : GetVariations()) {
+      if (v->GetColumnName() == colName && v->GetTagIndex(variation) < v->GetTags().size())
+         return v.get();
+   }
+   return nullptr;
+}
+
+RBookedDefines::ColumnNames_t RBookedDefines::GetVariationDeps(const ColumnNames_t &columns) const
+{
+   ColumnNames_t deps;
+   for (const auto &colName : columns) {
+      for (const auto &v : GetVariations()) {
+         if (v->GetColumnName() == colName)
+            AddUnique(deps, {v->GetVariationName()});
+      }
+      const auto defineIt = fDefines->find(colName);
+      if (defineIt != fDefines->end())
+         AddUnique(deps, defineIt->second->GetVariations());
+   }
+   return deps;
+}
+
+void RBookedDefines::MakeVariedDefines(const ColumnNames_t &columns, const std::string &variation) const
+{
+   const auto variationName = GetVariationName(variation);
+   for (const auto &colName : columns) {
+      const auto defineIt = fDefines->find(colName);
+      if (defineIt == fDefines->end())
+         continue;
+      const auto defineDeps = defineIt->second->GetVariations();
+      if (std::find(defineDeps.begin(), defineDeps.end(), variationName) != defineDeps.end())
+         defineIt->second->MakeVariedDefine(variation);
+   }
+}
+
+void RBookedDefines::AddDescriptions(const ColumnNames_t &columns, std::string &description) const
+{
+   for (const auto &colName : columns) {
+      const auto defineIt = fDefines->find(colName);
+      if (defineIt != fDefines->end())
+         defineIt->second->AddDescription(description);
+   }
+}
+
+void RBookedDefines::SetProfiler(RLoopProfiler &profiler) const
+{
+   for (const auto &define : *fDefines) {
+      if (IsInternalColumn(define.first))
+         continue; // rdfentry_ and rdfslot_ are not shown in the computation graph either
+      const auto id = profiler.RegisterNode(RLoopProfiler::ENodeKind::kDefine, define.first, define.second.get());
+      define.second->SetProfiler(&profiler, id);
+   }
+}
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
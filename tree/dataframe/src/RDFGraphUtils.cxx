@@ -10,6 +10,7 @@
 
 #include "ROOT/RDF/RBookedDefines.hxx"
 #include "ROOT/RDF/GraphUtils.hxx"
+#include "ROOT/RDF/RLoopProfiler.hxx"
 
 #include <algorithm> // std::find
 
@@ -27,8 +28,9 @@ std::string GraphCreatorHelper::FromGraphLeafToDot(std::shared_ptr<GraphNode> le
 
    // Explore the graph bottom-up and store its dot representation.
    while (leaf) {
-      dotStringLabels << "\t" << leaf->fCounter << " [label=\"" << leaf->fName << "\", style=\"filled\", fillcolor=\""
-                      << leaf->fColor << "\", shape=\"" << leaf->fShape << "\"];\n";
+      dotStringLabels << "\t" << leaf->fCounter << " [label=\"" << leaf->GetLabel()
+                      << "\", style=\"filled\", fillcolor=\"" << leaf->fColor << "\", shape=\"" << leaf->fShape
+                      << "\"];\n";
       if (leaf->fPrevNode) {
          dotStringGraph << "\t" << leaf->fPrevNode->fCounter << " -> " << leaf->fCounter << ";\n";
       }
@@ -47,7 +49,7 @@ std::string GraphCreatorHelper::FromGraphActionsToDot(std::vector<std::shared_pt
 
    for (auto leaf : leaves) {
       while (leaf && !leaf->fIsExplored) {
-         dotStringLabels << "\t" << leaf->fCounter << " [label=\"" << leaf->fName
+         dotStringLabels << "\t" << leaf->fCounter << " [label=\"" << leaf->GetLabel()
                          << "\", style=\"filled\", fillcolor=\"" << leaf->fColor << "\", shape=\"" << leaf->fShape
                          << "\"];\n";
          if (leaf->fPrevNode) {
@@ -157,7 +159,10 @@ std::shared_ptr<GraphNode> AddDefinesToGraph(std::shared_ptr<GraphNode> node, co
          break; // we walked back through all new defines, the rest is stuff that was already in the graph
 
       // create a node for this new Define
-      auto defineNode = RDFGraphDrawing::CreateDefineNode(colName, defineMap.at(colName).get());
+      const auto *define = defineMap.at(colName).get();
+      auto defineNode = RDFGraphDrawing::CreateDefineNode(colName, define);
+      if (auto *profiler = define->GetProfiler())
+         defineNode->SetProfileSummary(profiler->GetNodeSummary(define->GetProfileId()));
       upmostNode->SetPrevNode(defineNode);
       upmostNode = defineNode;
    }
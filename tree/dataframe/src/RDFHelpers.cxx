@@ -9,17 +9,33 @@
  *************************************************************************/
 
 #include "ROOT/RDFHelpers.hxx"
+#include "TEnv.h"       // gEnv
 #include "TROOT.h"      // IsImplicitMTEnabled
 #include "TError.h"     // Warning
+#include "TSystem.h"    // Getenv
+#include "TVirtualMutex.h" // R__LOCKGUARD
 #include "RConfigure.h" // R__USE_IMT
 #ifdef R__USE_IMT
 #include "ROOT/TThreadExecutor.hxx"
 #endif // R__USE_IMT
 
 #include <set>
+#include <string>
 
 using ROOT::RDF::RResultHandle;
 
+namespace {
+std::string &JitCacheDir()
+{
+   static std::string dir = [] {
+      if (const char *envDir = gSystem->Getenv("ROOT_RDF_JITCACHEDIR"))
+         return std::string(envDir);
+      return std::string(gEnv->GetValue("RDataFrame.JitCacheDir", ""));
+   }();
+   return dir;
+}
+} // anonymous namespace
+
 void ROOT::RDF::RunGraphs(std::vector<RResultHandle> handles)
 {
    if (handles.empty()) {
@@ -57,3 +73,15 @@ void ROOT::RDF::RunGraphs(std::vector<RResultHandle> handles)
    for (auto &h : uniqueLoops)
       run(h);
 }
+
+void ROOT::RDF::Experimental::SetJitCacheDir(std::string_view dir)
+{
+   R__LOCKGUARD(gROOTMutex);
+   JitCacheDir() = std::string(dir);
+}
+
+std::string ROOT::RDF::Experimental::GetJitCacheDir()
+{
+   R__LOCKGUARD(gROOTMutex);
+   return JitCacheDir();
+}
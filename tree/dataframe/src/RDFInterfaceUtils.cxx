@@ -9,19 +9,29 @@
  *************************************************************************/
 
 #include <ROOT/RDF/InterfaceUtils.hxx>
+#ifdef R__RDF_HAS_RNTUPLE
+#include <ROOT/RNTupleDS.hxx>
+#include <ROOT/RPageStorage.hxx>
+#endif
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFHelpers.hxx> // GetJitCacheDir
 #include <ROOT/RStringView.hxx>
 #include <ROOT/TSeq.hxx>
 #include <RtypesCore.h>
 #include <TDirectory.h>
+#include <TError.h>
+#include <TFile.h>
 #include <TChain.h>
 #include <TClass.h>
 #include <TClassEdit.h>
 #include <TFriendElement.h>
 #include <TInterpreter.h>
+#include <TMD5.h>
 #include <TObject.h>
+#include <TObjString.h>
 #include <TPRegexp.h>
 #include <TString.h>
+#include <TSystem.h>
 #include <TTree.h>
 
 // pragma to disable warnings on Rcpp which have
@@ -37,6 +47,9 @@
 #endif
 
 #include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <map>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -191,14 +204,11 @@ static std::unordered_map<std::string, std::string> &GetJittedExprs() {
    return jittedExpressions;
 }
 
-static std::string
-BuildLambdaString(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
+/// Return the parameter list of the lambda that evaluates a jitted expression, e.g. "const float var0, RVecF& var1".
+static std::string BuildLambdaParameters(const ColumnNames_t &vars, const ColumnNames_t &varTypes)
 {
    R__ASSERT(vars.size() == varTypes.size());
 
-   TPRegexp re(R"(\breturn\b)");
-   const bool hasReturnStmt = re.MatchB(expr);
-
    static const std::vector<std::string> fundamentalTypes = {
       "int",
       "signed",
@@ -233,7 +243,6 @@ BuildLambdaString(const std::string &expr, const ColumnNames_t &vars, const Colu
    };
 
    std::stringstream ss;
-   ss << "[](";
    for (auto i = 0u; i < vars.size(); ++i) {
       std::string fullType;
       const auto &type = varTypes[i];
@@ -247,9 +256,21 @@ BuildLambdaString(const std::string &expr, const ColumnNames_t &vars, const Colu
       }
       ss << fullType << vars[i] << ", ";
    }
+   auto params = ss.str();
    if (!vars.empty())
-      ss.seekp(-2, ss.cur);
+      params.resize(params.size() - 2); // remove the last ", "
+
+   return params;
+}
+
+static std::string
+BuildLambdaString(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
+{
+   TPRegexp re(R"(\breturn\b)");
+   const bool hasReturnStmt = re.MatchB(expr);
 
+   std::stringstream ss;
+   ss << "[](" << BuildLambdaParameters(vars, varTypes);
    if (hasReturnStmt)
       ss << "){";
    else
@@ -259,8 +280,167 @@ BuildLambdaString(const std::string &expr, const ColumnNames_t &vars, const Colu
    return ss.str();
 }
 
+/// An entry of the persistent cache of compiled Filter/Define expressions, see ROOT::RDF::Experimental::SetJitCacheDir.
+/// Each expression is compiled into a function __rdf::rdfjit_<hash>, where the hash is computed from the lambda
+/// expression (which includes the types of the input columns) and the ROOT build. The entry is described by a small
+/// text file in the cache directory that stores the name of the shared library with the compiled function, the return
+/// type of the function and the full lambda expression.
+struct RJitCacheEntry {
+   std::string fCacheDir;
+   std::string fLambdaExpr;   ///< Compared with the stored expression, to rule out hash collisions
+   std::string fParams;       ///< The parameter list of the lambda expression
+   std::string fArgs;         ///< The names of the parameters, to forward them to the compiled function
+   std::string fFuncName;     ///< The name of the compiled function in namespace __rdf
+   std::string fDescFileName; ///< The file that describes the entry
+   std::string fRetType;      ///< The return type of the expression, only known after it has been jitted
+};
+
+enum class EJitCacheLookup { kHit, kMiss, kUncacheable };
+
+static std::string MD5String(const std::string &s)
+{
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(s.data()), s.size());
+   md5.Final();
+   return md5.AsString();
+}
+
+static RJitCacheEntry MakeJitCacheEntry(const std::string &lambdaExpr, const ColumnNames_t &vars,
+                                        const ColumnNames_t &varTypes, const std::string &cacheDir)
+{
+   std::string args;
+   for (const auto &var : vars)
+      args += (args.empty() ? "" : ", ") + var;
+
+   // code compiled by a different ROOT build might not be ABI-compatible
+   const auto hash = MD5String(lambdaExpr + '\n' + gROOT->GetVersion() + '\n' + gROOT->GetGitCommit());
+   const auto funcName = "rdfjit_" + hash;
+
+   return RJitCacheEntry{cacheDir, lambdaExpr, BuildLambdaParameters(vars, varTypes), args, funcName,
+                         cacheDir + "/" + funcName + ".desc", ""};
+}
+
+/// Declare the lambda lambdaBaseName in namespace __rdf as a thin wrapper around the function compiled by a previous
+/// process, if the expression is in the cache. Nothing is declared if kHit is not returned.
+static EJitCacheLookup DeclareFromJitCache(const RJitCacheEntry &entry, const std::string &lambdaBaseName)
+{
+   std::ifstream descFile(entry.fDescFileName);
+   if (!descFile)
+      return EJitCacheLookup::kMiss;
+   std::string libName, retType;
+   std::getline(descFile, libName);
+   std::getline(descFile, retType);
+   const std::string storedExpr{std::istreambuf_iterator<char>(descFile), std::istreambuf_iterator<char>()};
+   if (storedExpr != entry.fLambdaExpr)
+      return EJitCacheLookup::kUncacheable; // a hash collision, do not overwrite the other entry
+   if (libName.empty())
+      return EJitCacheLookup::kUncacheable; // a previous process could not compile the expression
+   if (gSystem->Load(libName.c_str()) < 0)
+      return EJitCacheLookup::kMiss;
+
+   const auto toDeclare = "namespace __rdf {\n" + retType + " " + entry.fFuncName + "(" + entry.fParams +
+                          ");\nauto " + lambdaBaseName + " = [](" + entry.fParams + "){return " + entry.fFuncName +
+                          "(" + entry.fArgs + ");};\nusing " + lambdaBaseName + "_ret_t = " + retType + ";\n}";
+   try {
+      ROOT::Internal::RDF::InterpreterDeclare(toDeclare);
+   } catch (const std::runtime_error &) {
+      return EJitCacheLookup::kMiss;
+   }
+   return EJitCacheLookup::kHit;
+}
+
+/// Return the expressions that have been jitted but are not in the cache yet. They are compiled by
+/// StoreJittedExprsInCache.
+static std::vector<RJitCacheEntry> &GetPendingJitCacheEntries()
+{
+   static std::vector<RJitCacheEntry> entries;
+   return entries;
+}
+
+/// Write the file that describes the cache entry. An empty libName marks an expression that cannot be compiled.
+static void WriteJitCacheDescription(const RJitCacheEntry &entry, const std::string &libName)
+{
+   // write to a temporary file first, so that concurrent processes never read a partially written description
+   const auto tmpFileName = entry.fDescFileName + "." + std::to_string(gSystem->GetPid()) + ".tmp";
+   {
+      std::ofstream descFile(tmpFileName);
+      descFile << libName << '\n' << entry.fRetType << '\n' << entry.fLambdaExpr;
+      if (!descFile) {
+         gSystem->Unlink(tmpFileName.c_str());
+         return;
+      }
+   }
+   if (gSystem->Rename(tmpFileName.c_str(), entry.fDescFileName.c_str()) != 0)
+      gSystem->Unlink(tmpFileName.c_str());
+}
+
+/// Compile the functions of the given cache entries into a single shared library with ACLiC.
+/// Return the name of the library, or an empty string if compilation failed.
+static std::string CompileJitCacheEntries(const std::vector<RJitCacheEntry> &entries)
+{
+   const auto &cacheDir = entries.front().fCacheDir;
+   std::string funcNames;
+   for (const auto &entry : entries)
+      funcNames += entry.fFuncName;
+   // concurrent processes that compile the same expressions must not write to the same library
+   const auto libBaseName =
+      cacheDir + "/rdfjitlib_" + MD5String(funcNames) + "_" + std::to_string(gSystem->GetPid());
+   const auto srcFileName = libBaseName + ".cxx";
+   {
+      std::ofstream src(srcFileName);
+      src << "// Filter and Define expressions compiled by RDataFrame, see ROOT::RDF::Experimental::SetJitCacheDir\n"
+          << "#include \"ROOT/RVec.hxx\"\n#include \"TMath.h\"\n#include <cmath>\n#include <string>\n#include <vector>\n\n"
+          << "namespace __rdf {\n";
+      for (const auto &entry : entries)
+         src << entry.fRetType << " " << entry.fFuncName << "(" << entry.fParams << ")\n{\n   return "
+             << entry.fLambdaExpr << "(" << entry.fArgs << ");\n}\n";
+      src << "} // namespace __rdf\n";
+      if (!src)
+         return "";
+   }
+
+   // k: keep the library, c: do not load it now, O: optimize, s: silent, -: flat build directory
+   if (gSystem->CompileMacro(srcFileName.c_str(), "kcOs-", libBaseName.c_str(), cacheDir.c_str()) != 1) {
+      gSystem->Unlink(srcFileName.c_str());
+      return "";
+   }
+   return libBaseName + "." + gSystem->GetSoExt();
+}
+
+/// Compile the given cache entries into a single library and describe them in the cache. If the library cannot be
+/// built, bisect the entries to find the ones that do not compile, so that they are not retried by later processes.
+/// Return the number of entries stored together with a library.
+static unsigned int CompileAndStoreJitCacheEntries(const std::vector<RJitCacheEntry> &entries)
+{
+   const auto libName = CompileJitCacheEntries(entries);
+   if (!libName.empty()) {
+      for (const auto &entry : entries)
+         WriteJitCacheDescription(entry, libName);
+      return entries.size();
+   }
+   if (entries.size() == 1) {
+      WriteJitCacheDescription(entries.front(), "");
+      return 0u;
+   }
+
+   const auto half = entries.begin() + entries.size() / 2;
+   return CompileAndStoreJitCacheEntries(std::vector<RJitCacheEntry>(entries.begin(), half)) +
+          CompileAndStoreJitCacheEntries(std::vector<RJitCacheEntry>(half, entries.end()));
+}
+
+/// Each jitted lambda comes with a lambda_ret_t type alias for its return type.
+/// Resolve that alias and return the true type as string.
+static std::string RetTypeOfLambda(const std::string &lambdaName)
+{
+   const auto dt = gROOT->GetType((lambdaName + "_ret_t").c_str());
+   R__ASSERT(dt != nullptr);
+   const auto type = dt->GetFullTypeName();
+   return type;
+}
+
 /// Declare a lambda expression to the interpreter in namespace __rdf, return the name of the jitted lambda.
 /// If the lambda expression is already in GetJittedExprs, return the name for the lambda that has already been jitted.
+/// If the persistent jit cache is enabled and contains the expression, the lambda calls the precompiled function.
 static std::string DeclareLambda(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
 {
    R__LOCKGUARD(gROOTMutex);
@@ -278,10 +458,29 @@ static std::string DeclareLambda(const std::string &expr, const ColumnNames_t &v
    const auto lambdaBaseName = "lambda" + std::to_string(exprMap.size());
    const auto lambdaFullName = "__rdf::" + lambdaBaseName;
 
-   const auto toDeclare = "namespace __rdf {\nauto " + lambdaBaseName + " = " + lambdaExpr + ";\nusing " +
-                          lambdaBaseName + "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(" +
-                          lambdaBaseName + ")>::ret_type;\n}";
-   ROOT::Internal::RDF::InterpreterDeclare(toDeclare.c_str());
+   const auto cacheDir = ROOT::RDF::Experimental::GetJitCacheDir();
+   auto cacheLookup = EJitCacheLookup::kUncacheable;
+   if (!cacheDir.empty()) {
+      auto cacheEntry = MakeJitCacheEntry(lambdaExpr, vars, varTypes, cacheDir);
+      cacheLookup = DeclareFromJitCache(cacheEntry, lambdaBaseName);
+      if (cacheLookup == EJitCacheLookup::kMiss)
+         GetPendingJitCacheEntries().emplace_back(std::move(cacheEntry));
+   }
+
+   if (cacheLookup != EJitCacheLookup::kHit) {
+      const auto toDeclare = "namespace __rdf {\nauto " + lambdaBaseName + " = " + lambdaExpr + ";\nusing " +
+                             lambdaBaseName + "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(" +
+                             lambdaBaseName + ")>::ret_type;\n}";
+      try {
+         ROOT::Internal::RDF::InterpreterDeclare(toDeclare.c_str());
+      } catch (...) {
+         if (cacheLookup == EJitCacheLookup::kMiss)
+            GetPendingJitCacheEntries().pop_back();
+         throw;
+      }
+      if (cacheLookup == EJitCacheLookup::kMiss)
+         GetPendingJitCacheEntries().back().fRetType = RetTypeOfLambda(lambdaFullName);
+   }
 
    // InterpreterDeclare could throw. If it doesn't, mark the lambda as already jitted
    exprMap.insert({lambdaExpr, lambdaFullName});
@@ -289,15 +488,6 @@ static std::string DeclareLambda(const std::string &expr, const ColumnNames_t &v
    return lambdaFullName;
 }
 
-/// Each jitted lambda comes with a lambda_ret_t type alias for its return type.
-/// Resolve that alias and return the true type as string.
-static std::string RetTypeOfLambda(const std::string &lambdaName)
-{
-   const auto dt = gROOT->GetType((lambdaName + "_ret_t").c_str());
-   R__ASSERT(dt != nullptr);
-   const auto type = dt->GetFullTypeName();
-   return type;
-}
 
 static void GetTopLevelBranchNamesImpl(TTree &t, std::set<std::string> &bNamesReg, ColumnNames_t &bNames,
                                        std::set<TTree *> &analysedTrees, const std::string friendName = "")
@@ -616,6 +806,101 @@ ParsedTreePath ParseTreePath(std::string_view fullTreeName)
    return {std::string(treeName), std::string(dirName)};
 }
 
+std::unique_ptr<ROOT::RDF::RDataSource> MakeNTupleDataSource(const std::string &ntupleName, const std::string &fileName)
+{
+#ifdef R__RDF_HAS_RNTUPLE
+   auto pageSource = ROOT::Experimental::Detail::RPageSource::Create(ntupleName, fileName);
+   return std::make_unique<ROOT::Experimental::RNTupleDS>(std::move(pageSource));
+#else
+   (void)ntupleName;
+   (void)fileName;
+   throw std::runtime_error("Reading RNTuple data requires ROOT to be built with root7=ON.");
+#endif
+}
+
+/// The name of the key under which the description of the cached dataset is stored in the on-disk cache files
+static const char *const kDiskCacheDescriptionName = "rdfcache_description";
+
+std::string GetDiskCacheFileName(const std::string &description, std::string_view cacheDir)
+{
+   const std::string dirName(cacheDir);
+   if (gSystem->AccessPathName(dirName.c_str()) && gSystem->mkdir(dirName.c_str(), /*recursive=*/true) != 0)
+      throw std::runtime_error("DiskCache: could not create the cache directory \"" + dirName + "\".");
+
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(description.data()), description.size());
+   md5.Final();
+   return dirName + "/rdfcache_" + md5.AsString() + ".root";
+}
+
+std::string GetDiskCacheTmpFileName(const std::string &fileName)
+{
+   return fileName + "." + std::to_string(gSystem->GetPid()) + ".tmp";
+}
+
+bool IsValidDiskCache(const std::string &fileName, const std::string &description)
+{
+   // AccessPathName returns true if the file does _not_ exist
+   if (gSystem->AccessPathName(fileName.c_str()))
+      return false;
+
+   TDirectory::TContext ctxt;
+   std::unique_ptr<TFile> file(TFile::Open(fileName.c_str(), "READ"));
+   if (!file || file->IsZombie())
+      return false;
+   std::unique_ptr<TObjString> storedDescription(file->Get<TObjString>(kDiskCacheDescriptionName));
+   // the description is compared in full rather than through the hash in the file name, to rule out collisions
+   return storedDescription && storedDescription->GetString() == description.c_str() &&
+          file->GetKey(kDiskCacheTreeName) != nullptr;
+}
+
+void CommitDiskCache(const std::string &tmpFileName, const std::string &fileName, const std::string &description)
+{
+   {
+      TDirectory::TContext ctxt;
+      std::unique_ptr<TFile> file(TFile::Open(tmpFileName.c_str(), "UPDATE"));
+      if (!file || file->IsZombie())
+         throw std::runtime_error("DiskCache: could not open \"" + tmpFileName + "\" to store the cache description.");
+      TObjString storedDescription(description.c_str());
+      file->WriteTObject(&storedDescription, kDiskCacheDescriptionName);
+   }
+   if (gSystem->Rename(tmpFileName.c_str(), fileName.c_str()) != 0) {
+      gSystem->Unlink(tmpFileName.c_str());
+      throw std::runtime_error("DiskCache: could not move \"" + tmpFileName + "\" to \"" + fileName + "\".");
+   }
+}
+
+unsigned int StoreJittedExprsInCache()
+{
+   std::vector<RJitCacheEntry> pending;
+   {
+      R__LOCKGUARD(gROOTMutex);
+      pending = std::move(GetPendingJitCacheEntries());
+      GetPendingJitCacheEntries().clear();
+   }
+
+   // the cache directory might have been changed between the booking of different expressions
+   std::map<std::string, std::vector<RJitCacheEntry>> entriesPerDir;
+   for (auto &entry : pending)
+      entriesPerDir[entry.fCacheDir].emplace_back(std::move(entry));
+
+   // the compilation can take long and does not touch the pending entries, so it runs without holding gROOTMutex;
+   // the descriptions are published by an atomic rename, see WriteJitCacheDescription
+   unsigned int nStored = 0u;
+   for (const auto &dirAndEntries : entriesPerDir) {
+      const auto &cacheDir = dirAndEntries.first;
+      const auto &entries = dirAndEntries.second;
+      if (gSystem->AccessPathName(cacheDir.c_str()) && gSystem->mkdir(cacheDir.c_str(), /*recursive=*/true) != 0) {
+         Warning("RDataFrame", "Could not create the jit cache directory \"%s\".", cacheDir.c_str());
+         continue;
+      }
+
+      nStored += CompileAndStoreJitCacheEntries(entries);
+   }
+
+   return nStored;
+}
+
 std::string PrettyPrintAddr(const void *const addr)
 {
    std::stringstream s;
@@ -640,6 +925,8 @@ void BookFilterJit(const std::shared_ptr<RJittedFilter> &jittedFilter,
    if (type != "bool")
       std::runtime_error("Filter: the following expression does not evaluate to bool:\n" + std::string(expression));
 
+   jittedFilter->SetJittedExpression(std::string(expression));
+
    // definesOnHeap is deleted by the jitted call to JitFilterHelper
    ROOT::Internal::RDF::RBookedDefines *definesOnHeap = new ROOT::Internal::RDF::RBookedDefines(customCols);
    const auto definesOnHeapAddr = PrettyPrintAddr(definesOnHeap);
@@ -689,6 +976,7 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
    auto definesCopy = new RBookedDefines(customCols);
    auto definesAddr = PrettyPrintAddr(definesCopy);
    auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, type, lm.GetNSlots(), lm.GetDSValuePtrs());
+   jittedDefine->SetJittedExpression(std::string(expression));
 
    std::stringstream defineInvocation;
    defineInvocation << "ROOT::Internal::RDF::JitDefineHelper(" << lambdaName << ", new const char*["
@@ -26,6 +26,7 @@
 #include "TROOT.h" // IsImplicitMTEnabled, GetThreadPoolSize
 #include "TTree.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <string>
 #include <cstring>
@@ -355,6 +356,19 @@ bool IsInternalColumn(std::string_view colName)
    return goodPrefix && '_' == colName.back();                 // also ends with '_'
 }
 
+std::string GetVariationName(const std::string &variation)
+{
+   return variation.substr(0, variation.find(':'));
+}
+
+void AddUnique(std::vector<std::string> &v, const std::vector<std::string> &other)
+{
+   for (const auto &s : other) {
+      if (std::find(v.begin(), v.end(), s) == v.end())
+         v.emplace_back(s);
+   }
+}
+
 unsigned int GetColumnWidth(const std::vector<std::string>& names, const unsigned int minColumnSpace)
 {
    auto columnWidth = 0u;
@@ -84,6 +84,7 @@ Transformations are a way to manipulate the data.
 | DefineSlotEntry() | Same as DefineSlot(), but the entry number is passed in addition to the slot number. This is meant as a helper in case some dependency on the entry number needs to be honoured. |
 | Filter() | Filter rows based on user-defined conditions. |
 | Range() | Filter rows based on entry number (single-thread only). |
+| Vary() | Register systematic variations of a column. Varied results are requested with ROOT::RDF::Experimental::VariationsFor() and are produced in the same event loop as the nominal ones. |
 
 ### Actions
 Actions aggregate data into a result. Each one is described in more detail in the reference guide.
@@ -99,6 +100,7 @@ produce many different results in one event loop. Instant actions trigger the ev
 | Aggregate() | Execute a user-defined accumulation operation on the processed column values. |
 | Book() | Book execution of a custom action using a user-defined helper object. |
 | Cache() | Caches in contiguous memory columns' entries. Custom columns can be cached as well, filtered entries are not cached. Users can specify which columns to save (default is all). |
+| DiskCache() | Writes the selected columns to a file in a cache directory, keyed by a description of the dataset and of the computation graph. A later call with the same inputs and the same graph reuses the file instead of running the event loop. |
 | Count() | Return the number of events processed. Useful e.g. to get a quick count of the number of events passing a Filter. |
 | Display() | Provides a printable representation of the dataset contents. The method returns a RDisplay() instance which can be queried to get a compressed tabular representation on the standard output or a complete representation as a string. |
 | Fill() | Fill a user-defined object with the values of the specified columns, as if by calling `Obj.Fill(col1, col2, ...). |
@@ -133,6 +135,8 @@ produce many different results in one event loop. Instant actions trigger the ev
 | GetColumnTypeNamesList() | Return the list of type names of columns in the dataset. |
 | GetFilterNames() | Return the names of all filters in the computation graph. If called on a root node, all filters will be returned. For any other node, only the filters upstream of that node. |
 | SaveGraph() | Store the computation graph of an RDataFrame in graphviz format for easy inspection. |
+| [EnableProfiling()](\ref ROOT::RDF::Experimental::EnableProfiling) | Measure per-node times and call counts in the event loops, see [Profiling the event loop](\ref profiling). |
+| [EnableBatchedExecution()](\ref ROOT::RDF::Experimental::EnableBatchedExecution) | Evaluate Filters and Defines on blocks of entries at a time, see [Batched execution](\ref batched-execution). |
 | GetNRuns() | Return the number of event loops run by this RDataFrame instance so far. |
 | GetNSlots() | Return the number of processing slots that RDataFrame will use during the event loop (i.e. the concurrency level). |
 | Describe() | Get useful information describing the dataframe, e.g. columns and their types. |
@@ -720,6 +724,23 @@ first parameter is the slot number which ranges from 0 to ROOT::GetThreadPoolSiz
 - `DefineSlotEntry(name, f, columnList)`. In this case the callable f has this signature `R(unsigned int, ULong64_t,
 T1, T2, ...)`: the first parameter is the slot number while the second one the number of the entry being processed.
 
+### Systematic variations
+Vary() registers alternative values of a column, e.g. to evaluate a systematic uncertainty. The callable returns an RVec
+with one varied value per variation tag:
+
+~~~{.cpp}
+auto nominal_h = df.Vary("pt", [](double pt) { return RVec<double>{pt * 0.9, pt * 1.1}; }, {"pt"}, {"down", "up"})
+                   .Filter("pt > 20")
+                   .Histo1D("pt");
+auto hs = ROOT::RDF::Experimental::VariationsFor(nominal_h);
+hs["nominal"].Draw();
+hs["pt:up"].Draw("SAME");
+~~~
+
+VariationsFor() books one additional result per variation tag. All results are filled in the same event loop: the
+variation expression is evaluated once per entry, and only the filters, defines and actions that depend on the varied
+column are evaluated once more per tag.
+
 \anchor actions
 ## Actions
 ### Instant and lazy actions
@@ -797,6 +818,11 @@ See [Efficient analysis in Python](#python) for possible ways to speed up hot pa
 Just-in-time compilation happens once, right before starting an event loop. To reduce the runtime cost of this step, make sure to book all operations *for all RDataFrame computation graphs*
 before the first event loop is triggered: just-in-time compilation will happen once for all code required to be generated up to that point, also across different computation graphs.
 
+Applications that run the same computation graph many times in different processes, e.g. the jobs of a batch submission, can avoid recompiling the same Filter and Define expressions in every process
+with the experimental persistent cache of compiled expressions: after `ROOT::RDF::Experimental::SetJitCacheDir("/path/to/cache")` (or setting the `ROOT_RDF_JITCACHEDIR` environment variable),
+expressions are compiled into shared libraries stored in the cache directory the first time they are jitted, and later processes load them instead of generating their code again.
+See ROOT::RDF::Experimental::SetJitCacheDir for more details.
+
 Also make sure not to count the just-in-time compilation time (which happens once before the event loop and does not depend on the size of the dataset) as part of the event loop runtime (which scales with the size of the dataset). RDataFrame has an experimental logging feature that simplifies measuring the time spent in just-in-time compilation and in the event loop (as well as providing some more interesting information). It is activated like follows:
 ~~~{.cpp}
 #include <ROOT/RLogger.hxx>
@@ -1090,6 +1116,38 @@ ROOT::RDF::SaveGraph(rd1, "./mydot.dot");
 ROOT::RDF::SaveGraph(rd1);
 ~~~
 
+\anchor profiling
+### Profiling the event loop
+ROOT::RDF::Experimental::EnableProfiling() turns on the collection of per-node statistics for the following event
+loops: the number of evaluations of each Define, Filter and action, their exclusive wall-clock time, how it is split
+among processing slots, and how much of the event loop time is spent reading input data rather than evaluating nodes.
+Times are measured only on a sample of the entries, so the overhead is low enough to keep profiling on in production.
+Once profiling is enabled, SaveGraph() annotates each node with its statistics, and
+ROOT::RDF::Experimental::SaveProfile() returns or writes the full report in JSON format:
+~~~{.cpp}
+ROOT::RDF::Experimental::EnableProfiling(df);
+count->GetValue(); // runs the event loop
+ROOT::RDF::SaveGraph(df, "./annotated.dot");
+ROOT::RDF::Experimental::SaveProfile(df, "./profile.json");
+~~~
+
+\anchor batched-execution
+### Batched execution
+By default, the event loop pushes one entry at a time through the computation graph. For graphs made of simple
+numerical Filters and Defines, the per-entry function calls can cost more than the computations themselves.
+ROOT::RDF::Experimental::EnableBatchedExecution() makes the following event loops collect the entries of each
+processing slot in batches (256 entries by default): the values of the input columns are copied into contiguous
+buffers as entries are read, then each Filter computes a selection mask for the whole batch and each Define of
+fundamental type computes its values for all selected entries of the batch in a single loop, which the compiler can
+vectorize. Actions are invoked for the selected entries as usual.
+~~~{.cpp}
+ROOT::RDF::Experimental::EnableBatchedExecution(df);
+auto h = df.Define("pt", "sqrt(px*px + py*py)").Filter("pt > 10").Histo1D("pt");
+~~~
+Results do not change, but the order in which nodes are evaluated does: each action processes all entries of a batch
+before the next action runs. Batched execution does not apply to event loops that are profiled, that have callbacks
+registered or that contain Ranges. All input columns must be copiable.
+
 \anchor reference
 */
 // clang-format on
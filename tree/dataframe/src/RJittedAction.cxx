@@ -26,6 +26,12 @@ void RJittedAction::Run(unsigned int slot, Long64_t entry)
    fConcreteAction->Run(slot, entry);
 }
 
+void RJittedAction::RunBatch(unsigned int slot, RSlotBatch &batch)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   fConcreteAction->RunBatch(slot, batch);
+}
+
 void RJittedAction::Initialize()
 {
    R__ASSERT(fConcreteAction != nullptr);
@@ -93,3 +99,22 @@ std::unique_ptr<ROOT::Detail::RDF::RMergeableValueBase> RJittedAction::GetMergea
    R__ASSERT(fConcreteAction != nullptr);
    return fConcreteAction->GetMergeableValue();
 }
+
+void RJittedAction::SetProfiler(RLoopProfiler &profiler)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   fConcreteAction->SetProfiler(profiler);
+}
+
+std::vector<std::string> RJittedAction::GetVariations() const
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->GetVariations();
+}
+
+std::unique_ptr<ROOT::Internal::RDF::RActionBase>
+RJittedAction::MakeVariedAction(const std::string &variation, void *newResult)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->MakeVariedAction(variation, newResult);
+}
@@ -13,10 +13,10 @@
 
 using namespace ROOT::Detail::RDF;
 
-void RJittedDefine::InitSlot(TTreeReader *r, unsigned int slot)
+void RJittedDefine::InitSlot(TTreeReader *r, unsigned int slot, RDFInternal::RSlotBatch *batch)
 {
    R__ASSERT(fConcreteDefine != nullptr);
-   fConcreteDefine->InitSlot(r, slot);
+   fConcreteDefine->InitSlot(r, slot, batch);
 }
 
 void *RJittedDefine::GetValuePtr(unsigned int slot)
@@ -37,8 +37,51 @@ void RJittedDefine::Update(unsigned int slot, Long64_t entry)
    fConcreteDefine->Update(slot, entry);
 }
 
+void RJittedDefine::UpdateBatch(unsigned int slot, RDFInternal::RSlotBatch &batch, const char *mask)
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   fConcreteDefine->UpdateBatch(slot, batch, mask);
+}
+
+void *RJittedDefine::GetBatchValuePtr(unsigned int slot)
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   return fConcreteDefine->GetBatchValuePtr(slot);
+}
+
 void RJittedDefine::FinaliseSlot(unsigned int slot)
 {
    R__ASSERT(fConcreteDefine != nullptr);
    fConcreteDefine->FinaliseSlot(slot);
 }
+
+void RJittedDefine::AddDescription(std::string &description) const
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   fConcreteDefine->AddDescription(description);
+}
+
+void RJittedDefine::SetProfiler(RDFInternal::RLoopProfiler *profiler, unsigned int profileId)
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   RDefineBase::SetProfiler(profiler, profileId);
+   fConcreteDefine->SetProfiler(profiler, profileId);
+}
+
+std::vector<std::string> RJittedDefine::GetVariations() const
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   return fConcreteDefine->GetVariations();
+}
+
+void RJittedDefine::MakeVariedDefine(const std::string &variation)
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   fConcreteDefine->MakeVariedDefine(variation);
+}
+
+RDefineBase *RJittedDefine::GetVariedDefine(const std::string &variation)
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   return fConcreteDefine->GetVariedDefine(variation);
+}
@@ -21,6 +21,7 @@ RJittedFilter::RJittedFilter(RLoopManager *lm, std::string_view name)
 void RJittedFilter::SetFilter(std::unique_ptr<RFilterBase> f)
 {
    fConcreteFilter = std::move(f);
+   fConcreteFilter->SetJittedExpression(fJittedExpression);
 }
 
 void RJittedFilter::InitSlot(TTreeReader *r, unsigned int slot)
@@ -35,6 +36,12 @@ bool RJittedFilter::CheckFilters(unsigned int slot, Long64_t entry)
    return fConcreteFilter->CheckFilters(slot, entry);
 }
 
+const char *RJittedFilter::CheckFiltersBatch(unsigned int slot, RDFInternal::RSlotBatch &batch)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->CheckFiltersBatch(slot, batch);
+}
+
 void RJittedFilter::Report(ROOT::RDF::RCutFlowReport &cr) const
 {
    R__ASSERT(fConcreteFilter != nullptr);
@@ -89,6 +96,24 @@ void RJittedFilter::FinaliseSlot(unsigned int slot)
    fConcreteFilter->FinaliseSlot(slot);
 }
 
+void RJittedFilter::SetProfiler(RDFInternal::RLoopProfiler &profiler)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   fConcreteFilter->SetProfiler(profiler);
+}
+
+std::vector<std::string> RJittedFilter::GetVariations() const
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetVariations();
+}
+
+std::shared_ptr<RNodeBase> RJittedFilter::GetVariedFilter(const std::string &variation)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetVariedFilter(variation);
+}
+
 void RJittedFilter::InitNode()
 {
    R__ASSERT(fConcreteFilter != nullptr);
@@ -104,6 +129,15 @@ void RJittedFilter::AddFilterName(std::vector<std::string> &filters)
    fConcreteFilter->AddFilterName(filters);
 }
 
+void RJittedFilter::AddDescription(std::string &description)
+{
+   if (fConcreteFilter == nullptr) {
+      // No event loop performed yet, but the JITTING must be performed.
+      GetLoopManagerUnchecked()->Jit();
+   }
+   fConcreteFilter->AddDescription(description);
+}
+
 std::shared_ptr<RDFGraphDrawing::GraphNode> RJittedFilter::GetGraph()
 {
    if (fConcreteFilter != nullptr) {
@@ -7,8 +7,10 @@
  *************************************************************************/
 
 #include "RConfigure.h" // R__USE_IMT
+#include "ROOT/InternalTreeUtils.hxx" // GetFileNamesFromTree, GetFriendInfo
 #include "ROOT/RDataSource.hxx"
 #include "ROOT/RDF/GraphNode.hxx"
+#include "ROOT/RDF/InterfaceUtils.hxx" // StoreJittedExprsInCache
 #include "ROOT/RDF/RActionBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
@@ -25,6 +27,7 @@
 #include "TFriendElement.h"
 #include "TInterpreter.h"
 #include "TROOT.h" // IsImplicitMTEnabled
+#include "TSystem.h"
 #include "TTreeReader.h"
 #include "TTree.h" // For MaxTreeSizeRAII. Revert when #6640 will be solved.
 
@@ -381,6 +384,7 @@ void RLoopManager::RunEmptySourceMT()
          for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
             RunAndCheckFilters(slot, currEntry);
          }
+         RunBatch(slot);
       } catch (...) {
          // Error might throw in experiment frameworks like CMSSW
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -404,6 +408,7 @@ void RLoopManager::RunEmptySource()
       for (ULong64_t currEntry = 0; currEntry < fNEmptyEntries && fNStopsReceived < fNChildren; ++currEntry) {
          RunAndCheckFilters(0, currEntry);
       }
+      RunBatch(0);
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
       throw;
@@ -434,6 +439,7 @@ void RLoopManager::RunTreeProcessorMT()
          while (r.Next()) {
             RunAndCheckFilters(slot, count++);
          }
+         RunBatch(slot);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
@@ -458,6 +464,7 @@ void RLoopManager::RunTreeReader()
       while (r.Next() && fNStopsReceived < fNChildren) {
          RunAndCheckFilters(0, r.GetCurrentEntry());
       }
+      RunBatch(0);
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
       throw;
@@ -485,11 +492,12 @@ void RLoopManager::RunDataSource()
             const auto end = range.second;
             R__LOG_INFO(RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, 0u});
             for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
-               if (fDataSource->SetEntry(0u, entry)) {
+               if (SetDataSourceEntry(0u, entry)) {
                   RunAndCheckFilters(0u, entry);
                }
             }
          }
+         RunBatch(0u);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
@@ -520,10 +528,11 @@ void RLoopManager::RunDataSourceMT()
       R__LOG_INFO(RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, slot});
       try {
          for (auto entry = start; entry < end; ++entry) {
-            if (fDataSource->SetEntry(slot, entry)) {
+            if (SetDataSourceEntry(slot, entry)) {
                RunAndCheckFilters(slot, entry);
             }
          }
+         RunBatch(slot);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
@@ -541,10 +550,29 @@ void RLoopManager::RunDataSourceMT()
 #endif // not implemented otherwise (never called)
 }
 
+/// Load the given entry of the data source. If the event loop is profiled, the time spent is accounted as read time.
+bool RLoopManager::SetDataSourceEntry(unsigned int slot, ULong64_t entry)
+{
+   // the sampling decision of the previous entry of the slot is used, as the new entry is signaled to the profiler
+   // only in RunAndCheckFilters: with periodic sampling this measures the same fraction of entries
+   RDFInternal::RLoopProfiler::RReadScope profile(fProfiler.get(), slot);
+   return fDataSource->SetEntry(slot, entry);
+}
+
 /// Execute actions and make sure named filters are called for each event.
 /// Named filters must be called even if the analysis logic would not require it, lest they report confusing results.
+/// In batched mode, the entry is only added to the batch of the slot, which is processed once it is full.
 void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 {
+   if (fIsBatched) {
+      auto &batch = *fSlotBatches[slot];
+      batch.AddEntry(entry);
+      if (batch.IsFull())
+         RunBatch(slot);
+      return;
+   }
+   if (fProfiler)
+      fProfiler->BeginEntry(slot);
    for (auto &actionPtr : fBookedActions)
       actionPtr->Run(slot, entry);
    for (auto &namedFilterPtr : fBookedNamedFilters)
@@ -553,11 +581,32 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       callback(slot);
 }
 
+/// Execute actions and named filters on all entries of the batch of the slot, then start a new batch.
+/// Does nothing if the event loop does not run in batched mode. Must be called at the end of each task, while the data
+/// source is still positioned at the last entry of the batch.
+void RLoopManager::RunBatch(unsigned int slot)
+{
+   if (!fIsBatched)
+      return;
+   auto &batch = *fSlotBatches[slot];
+   if (batch.GetSize() > 0) {
+      for (auto &actionPtr : fBookedActions)
+         actionPtr->RunBatch(slot, batch);
+      for (auto &namedFilterPtr : fBookedNamedFilters)
+         namedFilterPtr->CheckFiltersBatch(slot, batch);
+   }
+   batch.Clear();
+}
+
 /// Build TTreeReaderValues for all nodes
 /// This method loops over all filters, actions and other booked objects and
 /// calls their `InitSlot` method, to get them ready for running a task.
 void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 {
+   if (fProfiler)
+      fProfiler->BeginTask(slot);
+   if (fIsBatched)
+      fSlotBatches[slot]->Clear(); // discard the entries left over by a task that was interrupted
    for (auto &ptr : fBookedActions)
       ptr->InitSlot(r, slot);
    for (auto &ptr : fBookedFilters)
@@ -579,12 +628,32 @@ void RLoopManager::InitNodes()
       range->InitNode();
    for (auto &ptr : fBookedActions)
       ptr->Initialize();
+
+   if (fProfiler) {
+      for (auto &filter : fBookedFilters)
+         filter->SetProfiler(*fProfiler);
+      for (auto &ptr : fBookedActions)
+         ptr->SetProfiler(*fProfiler);
+      fProfiler->PrepareEventLoop();
+   }
+
+   // profiling, callbacks and ranges need to see the entries one at a time
+   fIsBatched = fBatchSize > 0 && !fProfiler && fCallbacks.empty() && fBookedRanges.empty();
+   if (fBatchSize > 0 && !fIsBatched) {
+      R__LOG_INFO(RDFLogChannel()) << "Batched execution is disabled for this event loop, as the computation graph is "
+                                      "profiled or contains callbacks or Ranges.";
+   }
+   if (fIsBatched && fSlotBatches.empty()) {
+      for (auto slot = 0u; slot < fNSlots; ++slot)
+         fSlotBatches.emplace_back(new RDFInternal::RSlotBatch(fBatchSize));
+   }
 }
 
 /// Perform clean-up operations. To be called at the end of each event loop.
 void RLoopManager::CleanUpNodes()
 {
    fMustRunNamedFilters = false;
+   fIsBatched = false;
 
    // forget RActions and detach TResultProxies
    for (auto &ptr : fBookedActions)
@@ -612,6 +681,8 @@ void RLoopManager::CleanUpTask(unsigned int slot)
       ptr->FinalizeSlot(slot);
    for (auto &ptr : fBookedFilters)
       ptr->FinaliseSlot(slot);
+   if (fProfiler)
+      fProfiler->EndTask(slot);
 }
 
 /// Add RDF nodes that require just-in-time compilation to the computation graph.
@@ -633,6 +704,11 @@ void RLoopManager::Jit()
    s.Stop();
    R__LOG_INFO(RDFLogChannel()) << "Just-in-time compilation phase completed"
                                 << (s.RealTime() > 1e-3 ? " in " + std::to_string(s.RealTime()) + " seconds." : ".");
+
+   // expressions that were not found in the persistent jit cache are compiled now, for the benefit of later processes
+   const auto nStored = RDFInternal::StoreJittedExprsInCache();
+   if (nStored > 0)
+      R__LOG_INFO(RDFLogChannel()) << "Stored " << nStored << " compiled expressions in the jit cache.";
 }
 
 /// Trigger counting of number of children nodes for each node of the functional graph.
@@ -768,6 +844,30 @@ std::vector<std::string> RLoopManager::GetFiltersNames()
    return filters;
 }
 
+/// Enable the collection of per-node timings and call counts in the following event loops, see RLoopProfiler.
+/// Times are measured for one entry out of every samplingPeriod entries processed by each slot.
+void RLoopManager::EnableProfiling(unsigned int samplingPeriod)
+{
+   if (fProfiler) {
+      // nodes keep pointers to the existing profiler: replacing it is not an option
+      R__LOG_WARNING(RDFLogChannel()) << "Profiling was already enabled for this computation graph, the sampling "
+                                         "period is not changed.";
+      return;
+   }
+   fProfiler = std::make_unique<RDFInternal::RLoopProfiler>(fNSlots, samplingPeriod);
+}
+
+/// Run the following event loops in batched mode, see RSlotBatch
+void RLoopManager::EnableBatching(unsigned int batchSize)
+{
+   if (batchSize == 0)
+      throw std::invalid_argument("EnableBatchedExecution: the batch size must be at least 1.");
+   if (batchSize != fBatchSize) {
+      fBatchSize = batchSize;
+      fSlotBatches.clear(); // reallocated with the new size by the next event loop
+   }
+}
+
 std::vector<RNodeBase *> RLoopManager::GetGraphEdges() const
 {
    std::vector<RNodeBase *> nodes(fBookedFilters.size() + fBookedRanges.size());
@@ -797,10 +897,55 @@ std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> RLoopManager::GetG
 
    auto thisNode = std::make_shared<ROOT::Internal::RDF::GraphDrawing::GraphNode>(name);
    thisNode->SetRoot();
+   if (fProfiler)
+      thisNode->SetProfileSummary(fProfiler->GetLoopSummary());
    thisNode->SetCounter(0);
    return thisNode;
 }
 
+/// Append the name of the input file and a fingerprint of its content to the description.
+/// Local files are identified by their size and modification time. Files that cannot be stat'ed, e.g. remote ones,
+/// are opened and identified by their UUID, their size and the modification time stored in their header.
+/// Return false if the file cannot be identified.
+static bool AddFileDescription(const std::string &fileName, std::string &description)
+{
+   description += ";" + fileName;
+   FileStat_t stat;
+   if (gSystem->GetPathInfo(fileName.c_str(), stat) == 0) {
+      description += "," + std::to_string(stat.fSize) + "," + std::to_string(stat.fMtime);
+      return true;
+   }
+
+   std::unique_ptr<TFile> file(TFile::Open(fileName.c_str()));
+   if (!file || file->IsZombie())
+      return false;
+   description += "," + std::string(file->GetUUID().AsString()) + "," + std::to_string(file->GetSize()) + "," +
+                  std::to_string(file->GetModificationDate().Get());
+   return true;
+}
+
+void RLoopManager::AddDescription(std::string &description)
+{
+   fIsDescriptionComplete = true;
+   if (fTree) {
+      description += "Tree(" + std::string(fTree->GetName());
+      for (const auto &fileName : ROOT::Internal::TreeUtils::GetFileNamesFromTree(*fTree))
+         fIsDescriptionComplete &= AddFileDescription(fileName, description);
+      description += ")";
+      const auto friendInfo = ROOT::Internal::TreeUtils::GetFriendInfo(*fTree);
+      for (auto i = 0u; i < friendInfo.fFriendNames.size(); ++i) {
+         description += "\nFriend(" + friendInfo.fFriendNames[i].first + ";" + friendInfo.fFriendNames[i].second;
+         for (const auto &fileName : friendInfo.fFriendFileNames[i])
+            fIsDescriptionComplete &= AddFileDescription(fileName, description);
+         description += ")";
+      }
+   } else if (fDataSource) {
+      description += "DataSource(" + fDataSource->GetLabel() + ")";
+   } else {
+      description += "Empty(" + std::to_string(fNEmptyEntries) + ")";
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////
 /// Return all valid TTree::Branch names (caching results for subsequent calls).
 /// Never use fBranchNames directy, always request it through this method.
@@ -821,3 +966,24 @@ void RLoopManager::AddDSValuePtrs(const std::string &col, const std::vector<void
 {
    fDSValuePtrMap[col] = ptrs;
 }
+
+/// Register the tags of a systematic variation. Several columns can be varied together by booking variations with the
+/// same name: in that case the tags must be the same.
+void RLoopManager::AddVariation(const std::string &variationName, const std::vector<std::string> &tags)
+{
+   auto it = fVariationTags.find(variationName);
+   if (it == fVariationTags.end()) {
+      fVariationTags[variationName] = tags;
+   } else if (it->second != tags) {
+      throw std::runtime_error("Variation \"" + variationName +
+                               "\" was already booked with a different set of tags.");
+   }
+}
+
+const std::vector<std::string> &RLoopManager::GetVariationTags(const std::string &variationName) const
+{
+   auto it = fVariationTags.find(variationName);
+   if (it == fVariationTags.end())
+      throw std::runtime_error("Unknown variation \"" + variationName + "\".");
+   return it->second;
+}
@@ -0,0 +1,228 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RLoopProfiler.hxx"
+
+#include <algorithm> // std::max
+#include <cstdio>    // std::snprintf
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+const char *KindToString(ROOT::Internal::RDF::RLoopProfiler::ENodeKind kind)
+{
+   using ENodeKind = ROOT::Internal::RDF::RLoopProfiler::ENodeKind;
+   switch (kind) {
+   case ENodeKind::kDefine: return "Define";
+   case ENodeKind::kFilter: return "Filter";
+   case ENodeKind::kAction: return "Action";
+   }
+   return "";
+}
+
+std::string EscapeJSON(const std::string &s)
+{
+   std::string escaped;
+   escaped.reserve(s.size());
+   for (const char c : s) {
+      switch (c) {
+      case '"': escaped += "\\\""; break;
+      case '\\': escaped += "\\\\"; break;
+      case '\n': escaped += "\\n"; break;
+      case '\t': escaped += "\\t"; break;
+      default:
+         if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned int>(c));
+            escaped += buf;
+         } else {
+            escaped += c;
+         }
+      }
+   }
+   return escaped;
+}
+
+/// Format a duration in seconds with a unit that keeps the number readable
+std::string FormatTime(double seconds)
+{
+   char buf[32];
+   if (seconds >= 1.)
+      std::snprintf(buf, sizeof(buf), "%.3g s", seconds);
+   else if (seconds >= 1e-3)
+      std::snprintf(buf, sizeof(buf), "%.3g ms", seconds * 1e3);
+   else
+      std::snprintf(buf, sizeof(buf), "%.3g us", seconds * 1e6);
+   return buf;
+}
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+RLoopProfiler::RLoopProfiler(unsigned int nSlots, unsigned int samplingPeriod)
+   : fNSlots(nSlots), fSamplingPeriod(samplingPeriod), fNodeCounters(nSlots),
+     fSlotData(nSlots * CacheLineStep<RSlotData>())
+{
+   if (samplingPeriod == 0)
+      throw std::invalid_argument("RLoopProfiler: the sampling period must be at least 1.");
+}
+
+unsigned int RLoopProfiler::RegisterNode(ENodeKind kind, const std::string &name, const void *node)
+{
+   const auto it = fNodeIds.find(node);
+   if (it != fNodeIds.end())
+      return it->second;
+
+   const auto id = static_cast<unsigned int>(fNodes.size());
+   fNodes.push_back({kind, name});
+   fNodeIds.emplace(node, id);
+   return id;
+}
+
+void RLoopProfiler::PrepareEventLoop()
+{
+   for (auto &counters : fNodeCounters)
+      counters.resize(fNodes.size());
+}
+
+double RLoopProfiler::GetNodeTime(unsigned int id, unsigned int slot) const
+{
+   const auto &counters = fNodeCounters[slot];
+   if (id >= counters.size() || counters[id].fSampledCalls == 0)
+      return 0.;
+   const auto &c = counters[id];
+   return c.fTime * 1e-9 * c.fCalls / c.fSampledCalls;
+}
+
+double RLoopProfiler::GetReadTime(unsigned int slot) const
+{
+   const auto &slotData = GetSlotData(slot);
+   if (slotData.fSampledEntries == 0)
+      return 0.;
+   return slotData.fReadTime * 1e-9 * slotData.fEntries / slotData.fSampledEntries;
+}
+
+double RLoopProfiler::GetComputeTime(unsigned int slot) const
+{
+   double time = 0.;
+   for (auto id = 0u; id < fNodes.size(); ++id)
+      time += GetNodeTime(id, slot);
+   return time;
+}
+
+double RLoopProfiler::GetLoopTime() const
+{
+   double time = 0.;
+   for (auto slot = 0u; slot < fNSlots; ++slot)
+      time += GetSlotData(slot).fLoopTime * 1e-9;
+   return time;
+}
+
+std::string RLoopProfiler::GetNodeSummary(unsigned int id) const
+{
+   double time = 0.;
+   ULong64_t calls = 0;
+   for (auto slot = 0u; slot < fNSlots; ++slot) {
+      time += GetNodeTime(id, slot);
+      if (id < fNodeCounters[slot].size())
+         calls += fNodeCounters[slot][id].fCalls;
+   }
+   const auto loopTime = GetLoopTime();
+
+   std::stringstream ss;
+   ss << FormatTime(time);
+   if (loopTime > 0.) {
+      char buf[16];
+      std::snprintf(buf, sizeof(buf), "%.1f%%", 100. * time / loopTime);
+      ss << " (" << buf << ")";
+   }
+   ss << ", " << calls << " calls";
+   return ss.str();
+}
+
+std::string RLoopProfiler::GetLoopSummary() const
+{
+   const auto loopTime = GetLoopTime();
+   double readTime = 0., computeTime = 0.;
+   for (auto slot = 0u; slot < fNSlots; ++slot) {
+      readTime += GetReadTime(slot);
+      computeTime += GetComputeTime(slot);
+   }
+
+   std::string summary = FormatTime(loopTime) + " in event loops";
+   if (loopTime > 0.) {
+      char buf[64];
+      std::snprintf(buf, sizeof(buf), "\nread %.1f%%, nodes %.1f%%", 100. * readTime / loopTime,
+                    100. * computeTime / loopTime);
+      summary += buf;
+   }
+   return summary;
+}
+
+std::string RLoopProfiler::AsJSON() const
+{
+   std::stringstream ss;
+   ss.precision(6);
+
+   const auto totLoopTime = GetLoopTime();
+   double totReadTime = 0., totComputeTime = 0.;
+   std::vector<double> slotComputeTimes(fNSlots, 0.);
+   for (auto slot = 0u; slot < fNSlots; ++slot) {
+      slotComputeTimes[slot] = GetComputeTime(slot);
+      totReadTime += GetReadTime(slot);
+      totComputeTime += slotComputeTimes[slot];
+   }
+
+   ss << "{\n  \"samplingPeriod\": " << fSamplingPeriod << ",\n  \"nSlots\": " << fNSlots
+      << ",\n  \"loopTime\": " << totLoopTime << ",\n  \"readTime\": " << totReadTime
+      << ",\n  \"computeTime\": " << totComputeTime
+      << ",\n  \"overheadTime\": " << std::max(0., totLoopTime - totReadTime - totComputeTime) << ",\n  \"slots\": [";
+
+   unsigned int nActiveSlots = 0;
+   for (auto slot = 0u; slot < fNSlots; ++slot) {
+      const auto &slotData = GetSlotData(slot);
+      if (slotData.fEntries > 0)
+         ++nActiveSlots;
+      ss << (slot == 0 ? "\n" : ",\n") << "    {\"slot\": " << slot << ", \"entries\": " << slotData.fEntries
+         << ", \"loopTime\": " << slotData.fLoopTime * 1e-9 << ", \"readTime\": " << GetReadTime(slot)
+         << ", \"computeTime\": " << slotComputeTimes[slot] << "}";
+   }
+   ss << "\n  ],\n  \"nodes\": [";
+
+   for (auto id = 0u; id < fNodes.size(); ++id) {
+      double time = 0., maxSlotTime = 0.;
+      ULong64_t calls = 0;
+      std::stringstream slotTimes;
+      slotTimes.precision(6);
+      for (auto slot = 0u; slot < fNSlots; ++slot) {
+         const auto slotTime = GetNodeTime(id, slot);
+         time += slotTime;
+         maxSlotTime = std::max(maxSlotTime, slotTime);
+         if (id < fNodeCounters[slot].size())
+            calls += fNodeCounters[slot][id].fCalls;
+         slotTimes << (slot == 0 ? "" : ", ") << slotTime;
+      }
+      // ratio between the time spent by the busiest slot and the average over the slots that processed entries
+      const auto meanSlotTime = nActiveSlots > 0 ? time / nActiveSlots : 0.;
+      const auto imbalance = meanSlotTime > 0. ? maxSlotTime / meanSlotTime : 1.;
+
+      ss << (id == 0 ? "\n" : ",\n") << "    {\"id\": " << id << ", \"kind\": \"" << KindToString(fNodes[id].fKind)
+         << "\", \"name\": \"" << EscapeJSON(fNodes[id].fName) << "\", \"calls\": " << calls << ", \"time\": " << time
+         << ", \"fraction\": " << (totLoopTime > 0. ? time / totLoopTime : 0.) << ", \"imbalance\": " << imbalance
+         << ", \"slotTimes\": [" << slotTimes.str() << "]}";
+   }
+   ss << "\n  ]\n}\n";
+
+   return ss.str();
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
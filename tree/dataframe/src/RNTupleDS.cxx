@@ -15,6 +15,7 @@
  *************************************************************************/
 
 #include <ROOT/RDF/RColumnReaderBase.hxx>
+#include <ROOT/RError.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RFieldValue.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
@@ -25,6 +26,7 @@
 
 #include <TError.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -59,11 +61,10 @@ public:
    // Field is only used for reading
    void GenerateColumnsImpl() final { R__ASSERT(false && "Cardinality fields must only be used for reading"); }
 
-   void GenerateColumnsImpl(const RNTupleDescriptor &) final
+   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final
    {
-      RColumnModel model(EColumnType::kIndex, true /* isSorted*/);
-      fColumns.emplace_back(std::unique_ptr<ROOT::Experimental::Detail::RColumn>(
-         ROOT::Experimental::Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+      auto type = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex}, 0, desc);
+      fColumns.emplace_back(std::unique_ptr<ROOT::Experimental::Detail::RColumn>(CreateIndexColumn(type, 0)));
       fPrincipalColumn = fColumns[0].get();
    }
 
@@ -107,6 +108,11 @@ class RNTupleColumnReader : public ROOT::Detail::RDF::RColumnReaderBase {
    std::unique_ptr<RFieldBase> fField; ///< The field backing the RDF column
    RFieldValue fValue;                 ///< The memory location used to read from fField
    Long64_t fLastEntry;                ///< Last entry number that was read
+   /// For simple fields, the values are directly taken from the mapped page.  fBulkValues points to the value of
+   /// entry fBulkFirst in the page buffer; the following fBulkSize entries are available from there.
+   unsigned char *fBulkValues = nullptr;
+   Long64_t fBulkFirst = 0;
+   ROOT::Experimental::NTupleSize_t fBulkSize = 0;
 
 public:
    RNTupleColumnReader(std::unique_ptr<RFieldBase> f)
@@ -121,6 +127,8 @@ public:
       return std::make_unique<RNTupleColumnReader>(fField->Clone(fField->GetName()));
    }
 
+   const RFieldBase &GetField() const { return *fField; }
+
    /// Connect the field and its subfields to the page source
    void Connect(RPageSource &source)
    {
@@ -131,6 +139,14 @@ public:
 
    void *GetImpl(Long64_t entry) final
    {
+      if (fField->IsSimple()) {
+         if ((entry < fBulkFirst) || (entry >= fBulkFirst + static_cast<Long64_t>(fBulkSize))) {
+            fBulkValues = static_cast<unsigned char *>(fField->MapBulk(entry, fBulkSize));
+            fBulkFirst = entry;
+         }
+         return fBulkValues + (entry - fBulkFirst) * fField->GetValueSize();
+      }
+
       if (entry != fLastEntry) {
          fField->Read(entry, &fValue);
          fLastEntry = entry;
@@ -279,6 +295,30 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
    if (fHasSeenAllRanges)
       return ranges;
 
+   if (!fClusterFilters.empty()) {
+      // One entry range for each cluster that passes all the cluster filters, such that the clusters can be
+      // processed by different slots
+      auto clusterIds = fSources[0]->FindClustersInRange(fClusterFilters[0].fColumnId, fClusterFilters[0].fMin,
+                                                         fClusterFilters[0].fMax);
+      for (std::size_t i = 1; i < fClusterFilters.size(); ++i) {
+         const auto &filter = fClusterFilters[i];
+         const auto passed = fSources[0]->FindClustersInRange(filter.fColumnId, filter.fMin, filter.fMax);
+         clusterIds.erase(std::remove_if(clusterIds.begin(), clusterIds.end(),
+                                         [&passed](DescriptorId_t id) {
+                                            return std::find(passed.begin(), passed.end(), id) == passed.end();
+                                         }),
+                          clusterIds.end());
+      }
+      const auto &desc = fSources[0]->GetDescriptor();
+      for (auto clusterId : clusterIds) {
+         const auto &clusterDesc = desc.GetClusterDescriptor(clusterId);
+         ULong64_t start = clusterDesc.GetFirstEntryIndex();
+         ranges.emplace_back(start, start + clusterDesc.GetNEntries());
+      }
+      fHasSeenAllRanges = true;
+      return ranges;
+   }
+
    auto nEntries = fSources[0]->GetNEntries();
    const auto chunkSize = nEntries / fNSlots;
    const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
@@ -295,6 +335,22 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
    return ranges;
 }
 
+void RNTupleDS::AddClusterFilter(std::string_view colName, double min, double max)
+{
+   const auto itr = std::find(fColumnNames.begin(), fColumnNames.end(), colName);
+   if (itr == fColumnNames.end())
+      throw RException(R__FAIL("unknown column: " + std::string(colName)));
+   const auto &field = fColumnReaderPrototypes[std::distance(fColumnNames.begin(), itr)]->GetField();
+   // Simple fields store their values directly in the principal column; collections, strings, and
+   // cardinality columns are not simple
+   if (!field.IsSimple())
+      throw RException(R__FAIL("cluster filters require a column of arithmetic type: " + std::string(colName)));
+   const auto columnId = fSources[0]->GetDescriptor().FindColumnId(field.GetOnDiskId(), 0);
+   if (columnId == kInvalidDescriptorId)
+      throw RException(R__FAIL("no on-disk column for " + std::string(colName)));
+   fClusterFilters.push_back({columnId, min, max});
+}
+
 std::string RNTupleDS::GetTypeName(std::string_view colName) const
 {
    const auto index = std::distance(fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), colName));
@@ -0,0 +1,101 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RDF/RTreeColumnReader.hxx>
+#include <TBranch.h>
+#include <TBufferFile.h>
+#include <TClass.h>
+#include <TLeaf.h>
+#include <TMath.h>
+#include <TObjArray.h>
+#include <TTree.h>
+
+#include <cstring>
+
+ROOT::Internal::RDF::RTreeBulkBranchReader::RTreeBulkBranchReader(TTreeReader &r, const std::string &branchName,
+                                                                  EDataType type, std::size_t valueSize)
+   : fTreeReader(r), fBranchName(branchName), fType(type), fValueSize(valueSize),
+     fBuffer(std::make_unique<TBufferFile>(TBuffer::kWrite, 32 * 1024))
+{
+}
+
+ROOT::Internal::RDF::RTreeBulkBranchReader::~RTreeBulkBranchReader() = default;
+
+/// Finds the branch in the current tree of the reader and checks whether it can be read in bulk. The result is cached
+/// until the reader moves on to another tree.
+bool ROOT::Internal::RDF::RTreeBulkBranchReader::ResolveBranch()
+{
+   auto tree = fTreeReader.GetTree();
+   if (!tree)
+      return false;
+   // for a TChain, this is the tree currently being read
+   tree = tree->GetTree();
+   if (!tree)
+      return false;
+   if (tree == fTree)
+      return fBranch != nullptr;
+
+   fTree = tree;
+   fBranch = nullptr;
+   fNEntries = 0;
+
+   auto branch = tree->GetBranch(fBranchName.c_str());
+   // Branches of friend trees are indexed by different entry numbers, leave them to TTreeReader
+   if (!branch || branch->GetTree() != tree || branch->IsA() != TBranch::Class())
+      return false;
+   if (!branch->GetBulkRead().SupportsBulkRead())
+      return false;
+   auto leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->UncheckedAt(0));
+   if (leaf->GetLeafCount() || leaf->GetLenStatic() != 1 || static_cast<std::size_t>(leaf->GetLenType()) != fValueSize)
+      return false;
+   TClass *cl = nullptr;
+   EDataType type = kOther_t;
+   if (branch->GetExpectedType(cl, type) != 0 || cl || type != fType)
+      return false;
+
+   fBranch = branch;
+   return true;
+}
+
+/// Reads the basket that contains the given entry of fTree and copies its values to fValues
+bool ROOT::Internal::RDF::RTreeBulkBranchReader::LoadBasket(Long64_t entry)
+{
+   const auto basketEntry = fBranch->GetBasketEntry();
+   const auto basketIdx = TMath::BinarySearch(Long64_t(fBranch->GetWriteBasket()) + 1, basketEntry, entry);
+   if (basketIdx < 0)
+      return false;
+   // The bulk API only reads entire baskets, starting at their first entry
+   const auto firstEntry = basketEntry[basketIdx];
+   const auto nEntries = fBranch->GetBulkRead().GetBulkEntries(firstEntry, *fBuffer);
+   if (nEntries <= 0 || entry >= firstEntry + nEntries)
+      return false;
+   // The basket payload starts right after the key, at an arbitrary offset of the buffer
+   const std::size_t nBytes = nEntries * fValueSize;
+   fValues.resize((nBytes + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t));
+   std::memcpy(fValues.data(), fBuffer->GetCurrent(), nBytes);
+   fFirstEntry = firstEntry;
+   fNEntries = nEntries;
+   return true;
+}
+
+void *ROOT::Internal::RDF::RTreeBulkBranchReader::GetValuePtr()
+{
+   if (!ResolveBranch())
+      return nullptr;
+
+   const auto entry = fTree->GetReadEntry();
+   if (entry < fFirstEntry || entry >= fFirstEntry + fNEntries) {
+      if (!LoadBasket(entry)) {
+         // Fall back to TTreeReader for the rest of this tree
+         fBranch = nullptr;
+         fNEntries = 0;
+         return nullptr;
+      }
+   }
+   return reinterpret_cast<char *>(fValues.data()) + (entry - fFirstEntry) * fValueSize;
+}
@@ -0,0 +1,58 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RDF/RVariationBase.hxx>
+#include <ROOT/RDF/RVariationReader.hxx>
+#include <ROOT/RDF/Utils.hxx> // CacheLineStep, TypeID2TypeName
+#include <TError.h>             // R__ASSERT
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+using ROOT::Internal::RDF::RVariationBase;
+
+RVariationBase::RVariationBase(std::string_view columnName, std::string_view variationName,
+                               const std::vector<std::string> &tags, std::string_view type, unsigned int nSlots,
+                               const RBookedDefines &defines,
+                               const std::map<std::string, std::vector<void *>> &DSValuePtrs,
+                               ROOT::RDF::RDataSource *ds)
+   : fColumnName(columnName), fVariationName(variationName), fTags(tags), fType(type), fNSlots(nSlots),
+     fLastCheckedEntry(fNSlots * CacheLineStep<Long64_t>(), -1), fDefines(defines), fIsInitialized(nSlots, false),
+     fDSValuePtrs(DSValuePtrs), fDataSource(ds)
+{
+}
+
+// pin vtable
+RVariationBase::~RVariationBase() {}
+
+std::size_t RVariationBase::GetTagIndex(const std::string &variation) const
+{
+   if (variation.size() <= fVariationName.size() || variation.compare(0, fVariationName.size(), fVariationName) != 0 ||
+       variation[fVariationName.size()] != ':') {
+      return fTags.size();
+   }
+   const auto tag = variation.substr(fVariationName.size() + 1);
+   return std::distance(fTags.begin(), std::find(fTags.begin(), fTags.end(), tag));
+}
+
+ROOT::Internal::RDF::RVariationReader::RVariationReader(unsigned int slot, RVariationBase &variation,
+                                                        const std::string &variationKey, const std::type_info &tid)
+   : fVariation(variation), fTagIdx(variation.GetTagIndex(variationKey)), fSlot(slot)
+{
+   R__ASSERT(fTagIdx < variation.GetTags().size());
+   const auto &colTId = variation.GetTypeId();
+   // compare names rather than typeinfos, which may come from a compiled and a jitted context (see CheckDefineType)
+   if (0 != std::strcmp(colTId.name(), tid.name())) {
+      const auto colTypeName = TypeID2TypeName(colTId);
+      const auto typeName = TypeID2TypeName(tid);
+      throw std::runtime_error("RDataFrame: the varied values of column \"" + variation.GetColumnName() + "\" have type " +
+                               colTypeName + " but they were read as type " + typeName + ".");
+   }
+}
@@ -346,3 +346,90 @@ TEST(Cache, Alias)
    auto df4 = df3.Cache({"y"});
    EXPECT_EQ(df4.Sum("y").GetValue(), 3u);
 }
+
+// Remove the cache files and the cache directory left behind by DiskCache
+static void RemoveDiskCacheDir(const std::string &cacheDir)
+{
+   void *dir = gSystem->OpenDirectory(cacheDir.c_str());
+   if (!dir)
+      return;
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      const std::string entryName(entry);
+      if (entryName != "." && entryName != "..")
+         gSystem->Unlink((cacheDir + "/" + entryName).c_str());
+   }
+   gSystem->FreeDirectory(dir);
+   gSystem->Unlink(cacheDir.c_str());
+}
+
+TEST(Cache, DiskCache)
+{
+   const std::string cacheDir = "dataframe_cache_diskcache";
+   RemoveDiskCacheDir(cacheDir);
+   {
+      ROOT::RDataFrame df(10);
+      auto cached = df.Define("x", "int(rdfentry_)").Filter("x > 4").DiskCache({"x"}, cacheDir);
+      EXPECT_EQ(df.GetNRuns(), 1u);
+      EXPECT_EQ(cached.Sum<int>("x").GetValue(), 35);
+   }
+   {
+      // same dataset, same computation graph: the cache is reused and no event loop runs
+      ROOT::RDataFrame df(10);
+      auto cached = df.Define("x", "int(rdfentry_)").Filter("x > 4").DiskCache({"x"}, cacheDir);
+      EXPECT_EQ(df.GetNRuns(), 0u);
+      EXPECT_EQ(cached.Sum<int>("x").GetValue(), 35);
+   }
+   {
+      // a different filter expression invalidates the cache
+      ROOT::RDataFrame df(10);
+      auto cached = df.Define("x", "int(rdfentry_)").Filter("x > 6").DiskCache({"x"}, cacheDir);
+      EXPECT_EQ(df.GetNRuns(), 1u);
+      EXPECT_EQ(cached.Sum<int>("x").GetValue(), 24);
+   }
+   {
+      // so does a different input dataset
+      ROOT::RDataFrame df(12);
+      auto cached = df.Define("x", "int(rdfentry_)").Filter("x > 4").DiskCache({"x"}, cacheDir);
+      EXPECT_EQ(df.GetNRuns(), 1u);
+      EXPECT_EQ(cached.Sum<int>("x").GetValue(), 56);
+   }
+
+   RemoveDiskCacheDir(cacheDir);
+}
+
+TEST(Cache, DiskCacheFileInvalidation)
+{
+   const std::string cacheDir = "dataframe_cache_diskcache_file";
+   const std::string fileName = "dataframe_cache_diskcache_file.root";
+   RemoveDiskCacheDir(cacheDir);
+   auto writeInput = [&fileName](int nEntries) {
+      ROOT::RDataFrame(nEntries).Define("x", "int(rdfentry_)").Snapshot<int>("t", fileName, {"x"});
+   };
+
+   writeInput(10);
+   {
+      ROOT::RDataFrame df("t", fileName);
+      auto cached = df.Filter("x > 4").DiskCache({"x"}, cacheDir);
+      EXPECT_EQ(df.GetNRuns(), 1u);
+      EXPECT_EQ(cached.Sum<int>("x").GetValue(), 35);
+   }
+   {
+      // the input file is unchanged: the cache is reused
+      ROOT::RDataFrame df("t", fileName);
+      auto cached = df.Filter("x > 4").DiskCache({"x"}, cacheDir);
+      EXPECT_EQ(df.GetNRuns(), 0u);
+      EXPECT_EQ(cached.Sum<int>("x").GetValue(), 35);
+   }
+
+   // rewriting the input file with the same tree name but different content invalidates the cache
+   writeInput(12);
+   {
+      ROOT::RDataFrame df("t", fileName);
+      auto cached = df.Filter("x > 4").DiskCache({"x"}, cacheDir);
+      EXPECT_EQ(df.GetNRuns(), 1u);
+      EXPECT_EQ(cached.Sum<int>("x").GetValue(), 56);
+   }
+
+   gSystem->Unlink(fileName.c_str());
+   RemoveDiskCacheDir(cacheDir);
+}
@@ -8,7 +8,10 @@
 #include <RConfigure.h>
 
 #include <algorithm>
+#include <cstdlib>
 #include <deque>
+#include <fstream>
+#include <iterator>
 #include <vector>
 #include <string>
 
@@ -432,3 +435,119 @@ TEST(RunGraphs, AlreadyRun)
    ROOT_EXPECT_WARNING(ROOT::RDF::RunGraphs({r1, r2, r3, r4}), "RunGraphs",
                        "Got 4 handles from which 2 link to results which are already ready.");
 }
+
+TEST(Profiling, CountsAndAnnotations)
+{
+   ROOT::RDataFrame df(100);
+   auto sum = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                 .Filter([](double x) { return int(x) % 2 == 0; }, {"x"}, "even")
+                 .Sum<double>("x");
+   EXPECT_THROW(ROOT::RDF::Experimental::SaveProfile(df), std::runtime_error);
+
+   ROOT::RDF::Experimental::EnableProfiling(df, 1);
+   EXPECT_DOUBLE_EQ(*sum, 2450.);
+
+   const auto json = ROOT::RDF::Experimental::SaveProfile(df);
+   EXPECT_NE(json.find("\"kind\": \"Define\", \"name\": \"x\", \"calls\": 100,"), std::string::npos) << json;
+   EXPECT_NE(json.find("\"kind\": \"Filter\", \"name\": \"even\", \"calls\": 100,"), std::string::npos) << json;
+   EXPECT_NE(json.find("\"kind\": \"Action\", \"name\": \"Sum\", \"calls\": 50,"), std::string::npos) << json;
+   EXPECT_NE(json.find("\"entries\": 100,"), std::string::npos) << json;
+
+   const auto graph = ROOT::RDF::SaveGraph(df);
+   EXPECT_NE(graph.find("50 calls"), std::string::npos) << graph;
+   EXPECT_NE(graph.find("in event loops"), std::string::npos) << graph;
+}
+
+// Return the names of the files in the jit cache directory
+static std::vector<std::string> GetJitCacheFiles(const std::string &cacheDir)
+{
+   std::vector<std::string> fileNames;
+   void *dir = gSystem->OpenDirectory(cacheDir.c_str());
+   if (!dir)
+      return fileNames;
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      const std::string fileName = entry;
+      if (fileName != "." && fileName != "..")
+         fileNames.push_back(fileName);
+   }
+   gSystem->FreeDirectory(dir);
+   std::sort(fileNames.begin(), fileNames.end());
+   return fileNames;
+}
+
+static std::vector<std::string> GetJitCacheDescriptions(const std::vector<std::string> &fileNames)
+{
+   std::vector<std::string> descriptions;
+   std::copy_if(fileNames.begin(), fileNames.end(), std::back_inserter(descriptions), [](const std::string &f) {
+      return f.size() > 5 && f.compare(f.size() - 5, 5, ".desc") == 0;
+   });
+   return descriptions;
+}
+
+static void RemoveJitCacheDir(const std::string &cacheDir)
+{
+   for (const auto &fileName : GetJitCacheFiles(cacheDir))
+      gSystem->Unlink((cacheDir + "/" + fileName).c_str());
+   gSystem->Unlink(cacheDir.c_str());
+}
+
+TEST(JitCache, StoresExpressions)
+{
+   const std::string cacheDir = "dataframe_helpers_jitcache";
+   RemoveJitCacheDir(cacheDir);
+   ROOT::RDF::Experimental::SetJitCacheDir(cacheDir);
+   EXPECT_EQ(ROOT::RDF::Experimental::GetJitCacheDir(), cacheDir);
+
+   ROOT::RDataFrame df(100);
+   auto sum = df.Filter("rdfentry_ % 7 == 0").Define("jitcache_y", "rdfentry_ * 3").Sum<ULong64_t>("jitcache_y");
+   EXPECT_EQ(*sum, 3ull * 7ull * (14ull * 15ull / 2ull));
+   ROOT::RDF::Experimental::SetJitCacheDir("");
+
+   // one description per expression, whether or not a compiler was available to build the library
+   EXPECT_EQ(GetJitCacheDescriptions(GetJitCacheFiles(cacheDir)).size(), 2u);
+
+   RemoveJitCacheDir(cacheDir);
+}
+
+TEST(JitCache, ReusesExpressionsOfOtherProcesses)
+{
+   const std::string cacheDir = "dataframe_helpers_jitcache_reuse";
+   RemoveJitCacheDir(cacheDir);
+   ROOT::RDF::Experimental::SetJitCacheDir(cacheDir);
+
+   // the expressions must not have been jitted by this process before, otherwise they are not looked up in the cache
+   auto computeSum = []() {
+      ROOT::RDataFrame df(100);
+      return df.Filter("rdfentry_ % 5 == 1")
+         .Define("jitcache_reuse_y", "rdfentry_ * 2 + 1")
+         .Sum<ULong64_t>("jitcache_reuse_y")
+         .GetValue();
+   };
+   // entries 1, 6, ..., 96
+   const ULong64_t expected = 2ull * (20ull + 5ull * (19ull * 20ull / 2ull)) + 20ull;
+
+   // a child process jits the expressions and stores them in the cache
+   EXPECT_EXIT(std::exit(computeSum() == expected ? 0 : 1), ::testing::ExitedWithCode(0), "");
+
+   const auto filesBefore = GetJitCacheFiles(cacheDir);
+   const auto descriptions = GetJitCacheDescriptions(filesBefore);
+   ASSERT_EQ(descriptions.size(), 2u);
+   for (const auto &description : descriptions) {
+      std::ifstream descFile(cacheDir + "/" + description);
+      std::string libName;
+      std::getline(descFile, libName);
+      if (libName.empty()) {
+         // no compiler was available to build the library, so there is nothing to reuse
+         ROOT::RDF::Experimental::SetJitCacheDir("");
+         RemoveJitCacheDir(cacheDir);
+         return;
+      }
+   }
+
+   // this process finds both expressions in the cache: the result is the same and no new library is built
+   EXPECT_EQ(computeSum(), expected);
+   ROOT::RDF::Experimental::SetJitCacheDir("");
+   EXPECT_EQ(GetJitCacheFiles(cacheDir), filesBefore);
+
+   RemoveJitCacheDir(cacheDir);
+}
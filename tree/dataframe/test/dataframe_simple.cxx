@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 #include <ROOTUnitTestSupport.h>
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFHelpers.hxx>
 #include <ROOT/TSeq.hxx>
 #include <TChain.h>
 #include <TFile.h>
@@ -15,6 +16,7 @@
 #include <algorithm> // std::sort
 #include <array>
 #include <chrono>
+#include <cstdint>
 #include <thread>
 #include <set>
 #include <random>
@@ -954,11 +956,125 @@ TEST_P(RDFSimpleTests, ChainWithDifferentTreeNames)
    gSystem->Unlink(fname2);
 }
 
+// Fundamental-type branches with many small baskets, read in bulk
+TEST_P(RDFSimpleTests, BulkReadFundamentalTypes)
+{
+   const auto fname1 = "dataframe_simple_bulk1.root";
+   const auto fname2 = "dataframe_simple_bulk2.root";
+   const auto fnameFriend = "dataframe_simple_bulk_friend.root";
+   const int nEntries = 5000;
+   for (auto fname : {fname1, fname2}) {
+      TFile f(fname, "RECREATE");
+      TTree t("t", "t");
+      double d;
+      float f32;
+      Long64_t l;
+      unsigned short us;
+      t.Branch("d", &d);
+      t.Branch("f", &f32);
+      t.Branch("l", &l);
+      t.Branch("us", &us);
+      t.SetBasketSize("*", 256);
+      for (int i = 0; i < nEntries; ++i) {
+         d = i;
+         f32 = i / 2.f;
+         l = -Long64_t(i) * 1000000000;
+         us = i % 1000;
+         t.Fill();
+      }
+      t.Write();
+   }
+   {
+      TFile f(fnameFriend, "RECREATE");
+      TTree t("fr", "fr");
+      int x;
+      t.Branch("x", &x);
+      t.SetBasketSize("*", 256);
+      for (int i = 0; i < nEntries; ++i) {
+         x = nEntries - i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TChain c("t");
+   c.Add(fname1);
+   c.Add(fname2);
+   TChain fr("fr");
+   fr.Add(fnameFriend);
+   fr.Add(fnameFriend);
+   c.AddFriend(&fr);
+
+   ROOT::RDataFrame df(c);
+   auto dfCheck = df.Filter([](double d, float f, Long64_t l, unsigned short us, int x) {
+      const auto i = static_cast<int>(d);
+      return f == i / 2.f && l == -Long64_t(i) * 1000000000 && us == i % 1000 && x == nEntries - i;
+   }, {"d", "f", "l", "us", "x"});
+   auto count = dfCheck.Count();
+   auto sum = df.Sum<double>("d");
+   // skipping entries must not get the bulk reader out of sync
+   auto sumOdd = df.Filter([](unsigned short us) { return us % 2 != 0; }, {"us"}).Sum<float>("f");
+   // the values are handed out by reference and must be suitably aligned
+   auto nMisaligned = df.Filter([](const double &d, const float &f, const Long64_t &l, const unsigned short &us) {
+                           return reinterpret_cast<std::uintptr_t>(&d) % alignof(double) != 0 ||
+                                  reinterpret_cast<std::uintptr_t>(&f) % alignof(float) != 0 ||
+                                  reinterpret_cast<std::uintptr_t>(&l) % alignof(Long64_t) != 0 ||
+                                  reinterpret_cast<std::uintptr_t>(&us) % alignof(unsigned short) != 0;
+                        }, {"d", "f", "l", "us"})
+                         .Count();
+   EXPECT_EQ(2 * nEntries, *count);
+   EXPECT_EQ(0u, *nMisaligned);
+   EXPECT_DOUBLE_EQ(double(nEntries) * (nEntries - 1), *sum);
+   // odd us implies an odd entry number
+   double expectedSumOdd = 0;
+   for (int i = 1; i < nEntries; i += 2)
+      expectedSumOdd += i / 2.f;
+   EXPECT_FLOAT_EQ(2 * expectedSumOdd, *sumOdd);
+
+   gSystem->Unlink(fname1);
+   gSystem->Unlink(fname2);
+   gSystem->Unlink(fnameFriend);
+}
+
 TEST_P(RDFSimpleTests, WritingToFundamentalType)
 {
    EXPECT_THROW(ROOT::RDataFrame(1).Define("x", [] { return 1; }).Filter("x = 42"), std::runtime_error);
 }
 
+TEST_P(RDFSimpleTests, BatchedExecution)
+{
+   const auto fileName = GetParam() ? "dataframe_simple_batched_mt.root" : "dataframe_simple_batched.root";
+   FillTree(fileName, "t", 1000);
+   RDataFrame df("t", fileName);
+   ROOT::RDF::Experimental::EnableBatchedExecution(df, 64);
+
+   auto filtered = df.Define("x", [](double b1) { return 2. * b1; }, {"b1"})
+                      .Filter([](double x) { return x < 500.; }, {"x"}, "xCut")
+                      .Define("y", [](double x, int b2) { return x + b2; }, {"x", "b2"})
+                      .Filter("y > 100");
+   auto count = filtered.Count();
+   auto sumX = filtered.Sum<double>("x");
+   // columns that are not fundamental types are evaluated entry by entry
+   auto sumB4 = filtered.Define("b4sum", [](const RVec<int> &b4) { return Sum(b4); }, {"b4"}).Sum<int>("b4sum");
+   auto report = df.Report();
+
+   // entries 10 to 249 pass both filters, b4 holds {21} for even entries and {21, 42} for odd ones
+   EXPECT_EQ(240ull, *count);
+   EXPECT_DOUBLE_EQ(2. * (249 * 250 / 2 - 9 * 10 / 2), *sumX);
+   EXPECT_EQ(120 * 21 + 120 * 63, *sumB4);
+   EXPECT_EQ(1000ull, report->At("xCut").GetAll());
+   EXPECT_EQ(250ull, report->At("xCut").GetPass());
+
+   RDataFrame empty(1000);
+   ROOT::RDF::Experimental::EnableBatchedExecution(empty, 100);
+   auto sumMult3 = empty.Define("e", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                      .Filter([](double e) { return int(e) % 3 == 0; }, {"e"})
+                      .Sum<double>("e");
+   EXPECT_DOUBLE_EQ(3. * 333 * 334 / 2, *sumMult3);
+
+   gSystem->Unlink(fileName);
+}
+
 // run single-thread tests
 INSTANTIATE_TEST_SUITE_P(Seq, RDFSimpleTests, ::testing::Values(false));
 
@@ -0,0 +1,89 @@
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RVec.hxx>
+#include <TH1D.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using ROOT::RDataFrame;
+using ROOT::RDF::Experimental::VariationsFor;
+using ROOT::VecOps::RVec;
+
+TEST(RDFVary, SimpleSum)
+{
+   auto df = RDataFrame(10).Define("x", [] { return 1; });
+   auto sum = df.Vary("x", [] { return RVec<int>{-1, 2}; }, {}, 2).Sum<int>("x");
+   auto sums = VariationsFor(sum);
+
+   EXPECT_EQ(sums.GetKeys(), (std::vector<std::string>{"nominal", "x:0", "x:1"}));
+   EXPECT_EQ(sums["nominal"], 10);
+   EXPECT_EQ(sums["x:0"], -10);
+   EXPECT_EQ(sums["x:1"], 20);
+   EXPECT_EQ(*sum, 10);
+}
+
+TEST(RDFVary, SingleEventLoop)
+{
+   auto df = RDataFrame(10).Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto h = df.Vary("x", [](double x) { return RVec<double>{x - 1., x + 1.}; }, {"x"}, {"down", "up"}, "shift")
+               .Histo1D<double>({"h", "h", 12, -1., 11.}, "x");
+   auto hs = VariationsFor(h);
+
+   EXPECT_DOUBLE_EQ(hs["nominal"].GetMean(), 4.5);
+   EXPECT_DOUBLE_EQ(hs["shift:down"].GetMean(), 3.5);
+   EXPECT_DOUBLE_EQ(hs["shift:up"].GetMean(), 5.5);
+   EXPECT_EQ(df.GetNRuns(), 1u);
+}
+
+TEST(RDFVary, VariedFilterAndDefine)
+{
+   auto df = RDataFrame(10).Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"});
+   auto count = df.Vary("x", [](int x) { return RVec<int>{x - 5, x + 5}; }, {"x"}, {"down", "up"})
+                   .Define("y", [](int x) { return x * 2; }, {"x"})
+                   .Filter([](int y) { return y >= 10; }, {"y"})
+                   .Count();
+   auto counts = VariationsFor(count);
+
+   EXPECT_EQ(counts["nominal"], 5ull);
+   EXPECT_EQ(counts["x:down"], 0ull);
+   EXPECT_EQ(counts["x:up"], 10ull);
+}
+
+TEST(RDFVary, UnrelatedVariation)
+{
+   auto df = RDataFrame(10).Define("x", [] { return 1; }).Define("y", [] { return 2; });
+   auto sum = df.Vary("x", [] { return RVec<int>{0, 2}; }, {}, 2).Sum<int>("y");
+   auto sums = VariationsFor(sum);
+
+   EXPECT_EQ(sums.GetKeys(), std::vector<std::string>{"nominal"});
+   EXPECT_EQ(sums["nominal"], 20);
+}
+
+TEST(RDFVary, WrongNumberOfValues)
+{
+   auto df = RDataFrame(10).Define("x", [] { return 1; });
+   auto sum = df.Vary("x", [] { return RVec<int>{0, 1, 2}; }, {}, 2).Sum<int>("x");
+   auto sums = VariationsFor(sum);
+   EXPECT_THROW(sums["x:0"], std::runtime_error);
+}
+
+TEST(RDFVary, InvalidVariations)
+{
+   auto df = RDataFrame(10).Define("x", [] { return 1; });
+   auto f = [] { return RVec<int>{0, 2}; };
+   EXPECT_THROW(df.Vary("x", f, {}, 2, "nominal"), std::runtime_error);
+   EXPECT_THROW(df.Vary("x", f, {}, 2, "a:b"), std::runtime_error);
+   EXPECT_THROW(df.Vary("x", f, {}, {"same", "same"}), std::runtime_error);
+   EXPECT_THROW(df.Vary("y", f, {}, 2), std::runtime_error);
+   EXPECT_THROW(df.Vary("x", f, {}, 2).Vary("x", f, {}, 2), std::runtime_error);
+}
+
+TEST(RDFVary, UnsupportedAction)
+{
+   auto df = RDataFrame(10).Define("x", [] { return 1; });
+   auto xs = df.Vary("x", [] { return RVec<int>{0, 2}; }, {}, 2).Take<int>("x");
+   EXPECT_THROW(VariationsFor(xs), std::logic_error);
+}
@@ -2,12 +2,15 @@
 #include <ROOT/RArrowDS.hxx>
 #include <ROOT/TSeq.hxx>
 #include <TROOT.h>
+#include <TSystem.h>
 
 #if defined(__GNUC__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wshadow"
 #endif
 #include <arrow/builder.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
 #include <arrow/memory_pool.h>
 #include <arrow/record_batch.h>
 #include <arrow/table.h>
@@ -203,6 +206,47 @@ TEST(RArrowDS, FromARDFWithJitting)
    EXPECT_EQ(40, *min);
 }
 
+TEST(RArrowDS, SnapshotToArrow)
+{
+   const auto fileName = "datasource_arrow_snapshot.arrow";
+   ROOT::RDataFrame df(10);
+   auto dfWithCols = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                        .Define("v", [](ULong64_t e) { return ROOT::RVec<int>(e % 3, int(e)); }, {"rdfentry_"})
+                        .Define("s", [](ULong64_t e) { return std::to_string(e); }, {"rdfentry_"});
+   auto table = ROOT::RDF::Experimental::SnapshotToArrow<double, ROOT::RVec<int>, std::string>(
+      dfWithCols.Filter([](double x) { return x > 2; }, {"x"}), fileName, {"x", "v", "s"});
+   // the column types are inferred and the action is jitted
+   auto jittedTable = ROOT::RDF::Experimental::SnapshotToArrow(dfWithCols, "", {"x"});
+
+   ASSERT_NE(*table, nullptr);
+   EXPECT_EQ((*table)->num_rows(), 7);
+   EXPECT_EQ((*table)->num_columns(), 3);
+   EXPECT_TRUE((*table)->schema()->field(1)->type()->Equals(arrow::list(arrow::int32())));
+   EXPECT_EQ((*jittedTable)->num_rows(), 10);
+
+   // read back the table, and the file
+   auto rdf = MakeArrowDataFrame(*table, {});
+   EXPECT_DOUBLE_EQ(*rdf.Sum<double>("x"), 42.);
+   EXPECT_EQ(*rdf.Define("n", [](const ROOT::RVec<int> &v) { return v.size(); }, {"v"}).Sum<std::size_t>("n"), 6u);
+   EXPECT_EQ(*rdf.Filter([](const std::string &str) { return str == "9"; }, {"s"}).Count(), 1u);
+
+   std::shared_ptr<arrow::io::ReadableFile> file;
+   ASSERT_OK(arrow::io::ReadableFile::Open(fileName, &file));
+   std::shared_ptr<arrow::ipc::RecordBatchFileReader> reader;
+   ASSERT_OK(arrow::ipc::RecordBatchFileReader::Open(file.get(), &reader));
+   EXPECT_TRUE(reader->schema()->Equals(*(*table)->schema()));
+   int64_t nRows = 0;
+   for (int i = 0; i < reader->num_record_batches(); ++i) {
+      std::shared_ptr<arrow::RecordBatch> batch;
+      ASSERT_OK(reader->ReadRecordBatch(i, &batch));
+      nRows += batch->num_rows();
+   }
+   EXPECT_EQ(nRows, 7);
+   ASSERT_OK(file->Close());
+
+   gSystem->Unlink(fileName);
+}
+
 // NOW MT!-------------
 #ifdef R__USE_IMT
 
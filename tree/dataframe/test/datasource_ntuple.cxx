@@ -80,6 +80,32 @@ TEST_F(RNTupleDSTest, CardinalityColumn)
    EXPECT_EQ(2, *max_njets_jitted);
 }
 
+TEST(RNTupleDS, CardinalityColumnSplitIndex)
+{
+   std::string fileName = "RNTupleDS_test_cardinality_split.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldJets = std::make_unique<ROOT::Experimental::RField<std::vector<float>>>("jets");
+      fieldJets->SetColumnRepresentative({ROOT::Experimental::EColumnType::kSplitIndex});
+      model->AddField(std::move(fieldJets));
+      auto wrJets = model->Get<std::vector<float>>("jets");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName);
+      for (int i = 0; i < 10; ++i) {
+         *wrJets = std::vector<float>(i % 4, 1.f);
+         ntuple->Fill();
+      }
+   }
+
+   auto df = ROOT::Experimental::MakeNTupleDataFrame("ntuple", fileName);
+   auto njets = df.Take<std::size_t>("#jets");
+   ASSERT_EQ(10u, njets->size());
+   for (std::size_t i = 0; i < 10; ++i)
+      EXPECT_EQ(i % 4, (*njets)[i]);
+   EXPECT_EQ(3u, *df.Max<std::size_t>("#jets"));
+
+   std::remove(fileName.c_str());
+}
+
 void ReadTest(const std::string &name, const std::string &fname) {
    auto df = ROOT::Experimental::MakeNTupleDataFrame(name, fname);
 
@@ -125,3 +151,109 @@ TEST_F(RNTupleDSTest, ReadMT)
 
    ReadTest(fNtplName, fFileName);
 }
+
+TEST(RNTupleDS, ClusterFilter)
+{
+   std::string fileName = "RNTupleDS_test_clusterfilter.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto wrRun = model->MakeField<std::int32_t>("run");
+      auto wrTag = model->MakeField<std::string>("tag");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetNEntriesPerCluster(10);
+      options.SetComputeColumnStatistics(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName, options);
+      // Ten clusters with runs 0, 0, 1, 1, ..., 4, 4
+      for (int i = 0; i < 100; ++i) {
+         *wrRun = i / 20;
+         ntuple->Fill();
+      }
+   }
+
+   auto ds = std::make_unique<RNTupleDS>(RPageSource::Create("ntuple", fileName));
+   EXPECT_THROW(ds->AddClusterFilter("tag", 0, 1), ROOT::Experimental::RException);
+   ds->AddClusterFilter("run", 2, 3);
+   ROOT::RDataFrame df(std::move(ds));
+   // Only the four clusters of runs 2 and 3 are read
+   EXPECT_EQ(40U, *df.Count());
+   EXPECT_EQ(40U, *df.Filter([](std::int32_t run) { return run >= 2 && run <= 3; }, {"run"}).Count());
+
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDS, ClusterFilterMT)
+{
+   IMTRAII _;
+
+   std::string fileName = "RNTupleDS_test_clusterfilter_mt.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto wrRun = model->MakeField<std::int32_t>("run");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetNEntriesPerCluster(10);
+      options.SetComputeColumnStatistics(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName, options);
+      for (int i = 0; i < 100; ++i) {
+         *wrRun = i / 20;
+         ntuple->Fill();
+      }
+   }
+
+   // All the clusters pass, they still need to be spread over the slots
+   auto ds = std::make_unique<RNTupleDS>(RPageSource::Create("ntuple", fileName));
+   ds->AddClusterFilter("run", 0, 4);
+   ds->SetNSlots(4);
+   ds->Initialise();
+   auto ranges = ds->GetEntryRanges();
+   EXPECT_EQ(10U, ranges.size());
+   for (std::size_t i = 0; i < ranges.size(); ++i) {
+      EXPECT_EQ(10U * i, ranges[i].first);
+      EXPECT_EQ(10U * (i + 1), ranges[i].second);
+   }
+   EXPECT_TRUE(ds->GetEntryRanges().empty());
+
+   ds = std::make_unique<RNTupleDS>(RPageSource::Create("ntuple", fileName));
+   ds->AddClusterFilter("run", 1, 2);
+   ROOT::RDataFrame df(std::move(ds));
+   EXPECT_EQ(40U, *df.Count());
+   EXPECT_EQ(40U, *df.Filter([](std::int32_t run) { return run >= 1 && run <= 2; }, {"run"}).Count());
+
+   std::remove(fileName.c_str());
+}
+
+void SnapshotTest(const std::string &fileName)
+{
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   auto out = ROOT::RDataFrame(100)
+                 .Define("i", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                 .Define("x", [](int i) { return i * 0.5; }, {"i"})
+                 .Define("v", [](int i) { return ROOT::RVec<float>(i % 3, 1.f); }, {"i"})
+                 .Snapshot<int, double, ROOT::RVec<float>>("ntuple", fileName, {"i", "x", "v"}, opts);
+
+   EXPECT_EQ(100ull, *out->Count());
+   EXPECT_EQ(4950, *out->Sum<int>("i"));
+   EXPECT_DOUBLE_EQ(2475., *out->Sum<double>("x"));
+
+   // RVec columns are written with the RVec memory layout
+   auto reader = ROOT::Experimental::RNTupleReader::Open("ntuple", fileName);
+   auto viewV = reader->GetView<ROOT::RVec<float>>("v");
+   std::size_t nItems = 0;
+   for (auto i : reader->GetEntryRange())
+      nItems += viewV(i).size();
+   EXPECT_EQ(99u, nItems);
+
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDS, Snapshot)
+{
+   SnapshotTest("RNTupleDS_test_snapshot.root");
+}
+
+TEST(RNTupleDS, SnapshotMT)
+{
+   IMTRAII _;
+
+   SnapshotTest("RNTupleDS_test_snapshot_mt.root");
+}
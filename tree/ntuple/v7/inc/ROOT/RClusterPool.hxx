@@ -17,16 +17,22 @@
 #define ROOT7_RClusterPool
 
 #include <ROOT/RCluster.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPageStorage.hxx> // for ColumnSet_t
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <future>
 #include <queue>
 #include <thread>
 #include <set>
+#include <unordered_set>
 #include <vector>
 
 namespace ROOT {
@@ -51,6 +57,12 @@ the unzip thread is supposed to submit multi-threaded, CPU heavy work to the app
 The unzipping step of the pipeline therefore behaves differently depending on whether or not implicit multi-threadin
 is turned on. If it is turned off, i.e. in a single-threaded environment, the cluster pool will only read the
 compressed pages and the page source has to uncompresses pages at a later point when data from the page is requested.
+
+The look-ahead window adapts to the speed of the consumer: if the pipeline loads and unzips a cluster faster than
+the consumer processes one, fewer clusters are preloaded.  If the read options set a cluster cache memory limit,
+the look-ahead and the look-back windows are further reduced such that the estimated size of the clusters in the
+pool stays within the limit.  The pool's metrics record the time the consumer is stalled waiting for clusters and
+the clusters that were preloaded but never requested.
 */
 // clang-format on
 class RClusterPool {
@@ -98,6 +110,33 @@ private:
    unsigned int fWindowPost;
    /// The cache of clusters around the currently active cluster
    std::vector<std::unique_ptr<RCluster>> fPool;
+   /// Upper limit for the estimated size of the clusters in the pool and in flight, zero if unlimited
+   std::size_t fMemoryLimit;
+   /// Clusters in the pool that were requested at least once by GetCluster(); other clusters that leave the pool
+   /// have been preloaded in vain
+   std::unordered_set<DescriptorId_t> fRequestedClusters;
+
+   /// The cluster of the last GetCluster() call and the time at which it was handed out to the consumer
+   DescriptorId_t fLastClusterId = kInvalidDescriptorId;
+   std::chrono::steady_clock::time_point fLastClusterTime;
+   /// Time in nanoseconds blocked in WaitFor() since fLastClusterTime
+   std::int64_t fStallTime = 0;
+   /// Moving averages in nanoseconds of the time spent per cluster by the consumer and by the two pipeline stages;
+   /// zero until the first measurement.  The pipeline times are updated by the I/O and the unzip thread, respectively.
+   std::int64_t fAvgConsumeTime = 0;
+   std::atomic<std::int64_t> fAvgLoadTime{0};
+   std::atomic<std::int64_t> fAvgUnzipTime{0};
+
+   /// Cluster pool performance counters that get registered in fMetrics
+   struct RCounters {
+      RNTupleAtomicCounter &fTimeWallStall;
+      RNTupleAtomicCounter &fNLookAhead;
+      RNTupleAtomicCounter &fNLookAheadLimited;
+      RNTupleAtomicCounter &fNClusterUnused;
+      RNTupleAtomicCounter &fSzPrefetchUnused;
+   };
+   RNTupleMetrics fMetrics;
+   std::unique_ptr<RCounters> fCounters;
 
    /// Protects the shared state between the main thread and the pipeline threads, namely the read and unzip
    /// work queues and the in-flight clusters vector
@@ -138,9 +177,18 @@ private:
    /// Executed at the end of GetCluster when all missing data pieces have been sent to the load queue.
    /// Ideally, the function returns without blocking if the cluster is already in the pool.
    RCluster *WaitFor(DescriptorId_t clusterId, const RPageSource::ColumnSet_t &columns);
+   /// The number of clusters to be preloaded, including the requested one.  Enough clusters are kept in flight for
+   /// the slower of the two pipeline stages to keep up with the consumer, at most fWindowPost.
+   unsigned int GetLookAhead() const;
+   /// Estimates the memory taken by the given columns of a cluster from the page sizes in the descriptor,
+   /// including both the compressed pages and the unzipped pages in the page pool
+   std::size_t EstimateClusterSize(DescriptorId_t clusterId, const RPageSource::ColumnSet_t &columns) const;
+   /// Updates the metrics for a cluster, or some columns of it, that is dropped from the pool or from the pipeline
+   void ReleaseCluster(DescriptorId_t clusterId, const RPageSource::ColumnSet_t &columns);
 
 public:
    static constexpr unsigned int kDefaultPoolSize = 4;
+   /// The memory limit is taken from the page source's read options
    RClusterPool(RPageSource &pageSource, unsigned int size);
    explicit RClusterPool(RPageSource &pageSource) : RClusterPool(pageSource, kDefaultPoolSize) {}
    RClusterPool(const RClusterPool &other) = delete;
@@ -149,10 +197,12 @@ public:
 
    unsigned int GetWindowPre() const { return fWindowPre; }
    unsigned int GetWindowPost() const { return fWindowPost; }
+   std::size_t GetMemoryLimit() const { return fMemoryLimit; }
+   RNTupleMetrics &GetMetrics() { return fMetrics; }
 
    /// Returns the requested cluster either from the pool or, in case of a cache miss, lets the I/O thread load
    /// the cluster in the pool, blocks until done, and then returns it.  Triggers along the way the background loading
-   /// of the following fWindowPost number of clusters.  The returned cluster has at least all the pages of `columns`
+   /// of the following clusters, at most fWindowPost clusters in total and within the memory limit.  The returned cluster has at least all the pages of `columns`
    /// and possibly pages of other columns, too.  If implicit multi-threading is turned on, the uncompressed pages
    /// of the returned cluster are already pushed into the page pool associated with the page source upon return.
    /// The cluster remains valid until the next call to GetCluster().
@@ -24,7 +24,11 @@
 
 #include <TError.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <memory>
+#include <type_traits>
 
 namespace ROOT {
 namespace Experimental {
@@ -62,15 +66,52 @@ private:
    ColumnId_t fColumnIdSource;
    /// Used to pack and unpack pages on writing/reading
    std::unique_ptr<RColumnElementBase> fElement;
+   using ExtendRangeFunc_t = void (*)(const void *buffer, std::size_t nElements, double &min, double &max);
+   /// Extends the given value range by a buffer of in-memory elements; only set for columns of arithmetic C++ type
+   ExtendRangeFunc_t fExtendRange = nullptr;
 
    RColumn(const RColumnModel &model, std::uint32_t index);
 
+   template <typename CppT>
+   static void ExtendRange(const void *buffer, std::size_t nElements, double &min, double &max)
+   {
+      auto values = static_cast<const CppT *>(buffer);
+      CppT lo = std::numeric_limits<CppT>::max();
+      CppT hi = std::numeric_limits<CppT>::lowest();
+      for (std::size_t i = 0; i < nElements; ++i) {
+         // NaN values fail both comparisons
+         if (values[i] < lo)
+            lo = values[i];
+         if (values[i] > hi)
+            hi = values[i];
+      }
+      // Empty page or only NaN values
+      if (lo > hi)
+         return;
+      double dlo = static_cast<double>(lo);
+      double dhi = static_cast<double>(hi);
+      // Integers that do not fit into the mantissa are rounded to the nearest double; widen the range accordingly
+      if (std::numeric_limits<CppT>::digits > std::numeric_limits<double>::digits) {
+         dlo = std::nextafter(dlo, -std::numeric_limits<double>::infinity());
+         dhi = std::nextafter(dhi, std::numeric_limits<double>::infinity());
+      }
+      min = std::min(min, dlo);
+      max = std::max(max, dhi);
+   }
+
+   template <typename CppT, typename std::enable_if<std::is_arithmetic<CppT>::value, int>::type = 0>
+   static ExtendRangeFunc_t GetExtendRangeFunc() { return &ExtendRange<CppT>; }
+   template <typename CppT, typename std::enable_if<!std::is_arithmetic<CppT>::value, int>::type = 0>
+   static ExtendRangeFunc_t GetExtendRangeFunc() { return nullptr; }
+
 public:
    template <typename CppT, EColumnType ColumnT>
    static RColumn *Create(const RColumnModel &model, std::uint32_t index) {
       R__ASSERT(model.GetType() == ColumnT);
       auto column = new RColumn(model, index);
       column->fElement = std::unique_ptr<RColumnElementBase>(new RColumnElement<CppT, ColumnT>(nullptr));
+      column->fElement->SetColumnModel(model);
+      column->fExtendRange = GetExtendRangeFunc<CppT>();
       return column;
    }
 
@@ -194,6 +235,16 @@ public:
          (clusterIndex.GetIndex() - fCurrentPage.GetClusterRangeFirst()) * RColumnElement<CppT>::kSize);
    }
 
+   /// Type-erased version of MapV() for callers that only know the in-memory element size of the column
+   void *MapRawV(const NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      if (!fCurrentPage.Contains(globalIndex)) {
+         MapPage(globalIndex);
+      }
+      nItems = fCurrentPage.GetGlobalRangeLast() - globalIndex + 1;
+      return static_cast<unsigned char *>(fCurrentPage.GetBuffer()) +
+             (globalIndex - fCurrentPage.GetGlobalRangeFirst()) * fCurrentPage.GetElementSize();
+   }
+
    NTupleSize_t GetGlobalIndex(const RClusterIndex &clusterIndex) {
       if (!fCurrentPage.Contains(clusterIndex)) {
          MapPage(clusterIndex);
@@ -245,6 +296,10 @@ public:
    void MapPage(const RClusterIndex &clusterIndex);
    NTupleSize_t GetNElements() const { return fNElements; }
    RColumnElementBase *GetElement() const { return fElement.get(); }
+   /// Returns the value range of a page of this column; the statistics are invalid if the column's C++ type
+   /// is not arithmetic.  For columns that store the values with reduced precision, the range covers the values
+   /// as they are read back.
+   RClusterDescriptor::RColumnStatistics GetPageStatistics(const RPage &page) const;
    const RColumnModel &GetModel() const { return fModel; }
    std::uint32_t GetIndex() const { return fIndex; }
    ColumnId_t GetColumnIdSource() const { return fColumnIdSource; }
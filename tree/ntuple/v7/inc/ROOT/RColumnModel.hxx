@@ -18,6 +18,7 @@
 
 #include <ROOT/RStringView.hxx>
 
+#include <cstdint>
 #include <string>
 
 namespace ROOT {
@@ -44,11 +45,25 @@ enum class EColumnType {
    kBit,
    kReal64,
    kReal32,
+   // Reduced precision floating point types.  A kReal16 column without value range stores the upper 16 bits of the
+   // IEEE 754 single precision representation, i.e. sign, exponent, and 7 mantissa bits.  Columns with a value range
+   // store fixed-point numbers with the column model's number of bits; kReal8 columns require a value range.
    kReal16,
    kReal8,
    kInt64,
    kInt32,
    kInt16,
+   // The split types store the bytes of all elements of a page grouped by byte position ("byte transposed"), such
+   // that the compressor sees long runs of similar bytes, e.g. exponents of floating point numbers.
+   // Integer split types zigzag-encode signed values first to map small negative numbers to small unsigned numbers.
+   kSplitReal64,
+   kSplitReal32,
+   kSplitInt64,
+   kSplitInt32,
+   kSplitInt16,
+   // Offset columns that are delta and zigzag encoded before byte splitting; since offsets are monotonically
+   // increasing, the deltas are the (small) collection sizes
+   kSplitIndex,
 };
 
 // clang-format off
@@ -62,16 +77,28 @@ class RColumnModel {
 private:
    EColumnType fType;
    bool fIsSorted;
+   /// For fixed-point columns, the number of bits of the integers that represent the value range [fMin, fMax]
+   std::uint32_t fNBits = 0;
+   double fMin = 0.;
+   double fMax = 0.;
 
 public:
    RColumnModel() : fType(EColumnType::kUnknown), fIsSorted(false) {}
    RColumnModel(EColumnType type, bool isSorted) : fType(type), fIsSorted(isSorted) {}
+   RColumnModel(EColumnType type, bool isSorted, std::uint32_t nBits, double min, double max)
+      : fType(type), fIsSorted(isSorted), fNBits(nBits), fMin(min), fMax(max) {}
 
    EColumnType GetType() const { return fType; }
    bool GetIsSorted() const { return fIsSorted; }
+   std::uint32_t GetNBits() const { return fNBits; }
+   double GetMin() const { return fMin; }
+   double GetMax() const { return fMax; }
+   /// Fixed-point columns have a non-empty value range
+   bool HasValueRange() const { return fMin < fMax; }
 
    bool operator ==(const RColumnModel &other) const {
-      return (fType == other.fType) && (fIsSorted == other.fIsSorted);
+      return (fType == other.fType) && (fIsSorted == other.fIsSorted) && (fNBits == other.fNBits) &&
+             (fMin == other.fMin) && (fMax == other.fMax);
    }
 };
 
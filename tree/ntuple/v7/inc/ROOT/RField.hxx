@@ -30,6 +30,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <iostream>
 #include <iterator>
 #include <memory>
@@ -81,16 +82,19 @@ private:
    ENTupleStructure fStructure;
    /// For fixed sized arrays, the array length
    std::size_t fNRepetitions;
-   /// A field on a trivial type that maps as-is to a single column
-   bool fIsSimple;
    /// When the columns are connected to a page source or page sink, the field represents a field id in the
    /// corresponding RNTuple descriptor. This on-disk ID is set in RPageSink::Create() for writing and by
    /// RFieldDescriptor::CreateField() when recreating a field / model from the stored descriptor.
    DescriptorId_t fOnDiskId = kInvalidDescriptorId;
    /// Free text set by the user
    std::string fDescription;
+   /// The on-disk column types to be used for writing, one per column. If empty, the field's default column types
+   /// are used.
+   std::vector<EColumnType> fColumnRepresentative;
 
 protected:
+   /// A field on a trivial type that maps as-is to a single column
+   bool fIsSimple;
    /// Collections and classes own sub fields
    std::vector<std::unique_ptr<RFieldBase>> fSubFields;
    /// Sub fields point to their mother field
@@ -113,8 +117,9 @@ protected:
    virtual std::unique_ptr<RFieldBase> CloneImpl(std::string_view newName) const = 0;
 
    /// Operations on values of complex types, e.g. ones that involve multiple columns or for which no direct
-   /// column type exists.
-   virtual void AppendImpl(const RFieldValue &value);
+   /// column type exists.  AppendImpl() returns the number of bytes written into the columns, including the ones
+   /// written by sub fields.
+   virtual std::size_t AppendImpl(const RFieldValue &value);
    virtual void ReadGlobalImpl(NTupleSize_t globalIndex, RFieldValue *value);
    virtual void ReadInClusterImpl(const RClusterIndex &clusterIndex, RFieldValue *value) {
       ReadGlobalImpl(fPrincipalColumn->GetGlobalIndex(clusterIndex), value);
@@ -124,6 +129,13 @@ protected:
    /// is not of one of the requested types.
    ROOT::Experimental::EColumnType EnsureColumnType(const std::vector<EColumnType> &requestedTypes,
                                                     unsigned int columnIndex, const RNTupleDescriptor &desc);
+   /// Returns the column type to be used for writing the column with the given index: the type set by
+   /// SetColumnRepresentative() or, by default, the first of the supported types.  Throws an exception if the
+   /// requested column type is not among the supported types.
+   ROOT::Experimental::EColumnType EnsureColumnRepresentative(const std::vector<EColumnType> &supportedTypes,
+                                                              unsigned int columnIndex) const;
+   /// Creates the offset column of a collection field, which is either of type kIndex or kSplitIndex
+   static RColumn *CreateIndexColumn(EColumnType type, std::uint32_t columnIndex);
 
 public:
    /// Iterates over the sub tree of fields in depth-first search order
@@ -197,12 +209,13 @@ public:
    virtual size_t GetAlignment() const { return GetValueSize(); }
 
    /// Write the given value into columns. The value object has to be of the same type as the field.
-   void Append(const RFieldValue& value) {
-      if (!fIsSimple) {
-         AppendImpl(value);
-         return;
-      }
+   /// Returns the number of uncompressed bytes written into the columns, which lets the writer decide on the
+   /// cluster boundaries.
+   std::size_t Append(const RFieldValue& value) {
+      if (!fIsSimple)
+         return AppendImpl(value);
       fPrincipalColumn->Append(value.fMappedElement);
+      return value.fMappedElement.GetSize();
    }
 
    /// Populate a single value with data from the tree, which needs to be of the fitting type.
@@ -223,6 +236,15 @@ public:
       fPrincipalColumn->Read(clusterIndex, &value->fMappedElement);
    }
 
+   /// Populate count consecutive values, starting at globalIndex, in the memory area given by to.  The memory area
+   /// must hold count already constructed objects of the field type, GetValueSize() bytes apart.  For simple fields,
+   /// the values are copied page by page; other fields fall back to reading value by value.
+   void ReadBulk(NTupleSize_t globalIndex, NTupleSize_t count, void *to);
+   /// Zero-copy bulk access for simple fields.  Returns a pointer to the value at globalIndex in the page buffer and
+   /// sets nItems to the number of consecutive values that can be accessed from there, i.e. up to the end of the
+   /// page.  The memory is valid until the field maps another page.  Returns nullptr for non-simple fields.
+   void *MapBulk(NTupleSize_t globalIndex, NTupleSize_t &nItems);
+
    /// Ensure that all received items are written from page buffers to the storage.
    void Flush() const;
    /// Perform housekeeping tasks for global to cluster-local index translation
@@ -246,6 +268,11 @@ public:
    DescriptorId_t GetOnDiskId() const { return fOnDiskId; }
    void SetOnDiskId(DescriptorId_t id) { fOnDiskId = id; }
 
+   /// Sets the on-disk column types used for writing, one per column of the field, e.g. in order to use a split
+   /// encoding instead of the default one. Needs to be set before the field is connected to a page sink.
+   void SetColumnRepresentative(const std::vector<EColumnType> &representative);
+   const std::vector<EColumnType> &GetColumnRepresentative() const { return fColumnRepresentative; }
+
    /// Fields and their columns live in the void until connected to a physical page storage.  Only once connected, data
    /// can be read or written.  In order to find the field in the page storage, the field's on-disk ID has to be set.
    void ConnectPageSink(RPageSink &pageSink);
@@ -294,7 +321,7 @@ private:
 
 protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
-   void AppendImpl(const Detail::RFieldValue& value) final;
+   std::size_t AppendImpl(const Detail::RFieldValue& value) final;
    void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
    void ReadInClusterImpl(const RClusterIndex &clusterIndex, Detail::RFieldValue *value) final;
 
@@ -327,7 +354,7 @@ private:
 
 protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
-   void AppendImpl(const Detail::RFieldValue& value) final;
+   std::size_t AppendImpl(const Detail::RFieldValue& value) final;
    void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
    void ReadInClusterImpl(const RClusterIndex &clusterIndex, Detail::RFieldValue *value) final;
 
@@ -357,7 +384,7 @@ private:
 
 protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
-   void AppendImpl(const Detail::RFieldValue& value) final;
+   std::size_t AppendImpl(const Detail::RFieldValue& value) final;
    void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
 
 public:
@@ -394,7 +421,7 @@ private:
 
 protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
-   void AppendImpl(const Detail::RFieldValue& value) final;
+   std::size_t AppendImpl(const Detail::RFieldValue& value) final;
    void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
    void ReadInClusterImpl(const RClusterIndex &clusterIndex, Detail::RFieldValue *value) final;
 
@@ -434,7 +461,7 @@ private:
 
 protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
-   void AppendImpl(const Detail::RFieldValue& value) final;
+   std::size_t AppendImpl(const Detail::RFieldValue& value) final;
    void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
 
 public:
@@ -623,10 +650,18 @@ public:
 
 template <>
 class RField<float> : public Detail::RFieldBase {
+private:
+   /// The number of mantissa bits kept when writing; values are rounded to nearest, ties to even
+   std::uint32_t fNMantissaBits = 23;
+   /// For fixed-point storage, the number of bits and the value range set by SetQuantization()
+   std::uint32_t fQuantNBits = 0;
+   double fQuantMin = 0.;
+   double fQuantMax = 0.;
+
 protected:
-   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
-   }
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+   std::size_t AppendImpl(const Detail::RFieldValue &value) final;
+   void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
 
 public:
    static std::string TypeName() { return "float"; }
@@ -639,6 +674,19 @@ public:
    void GenerateColumnsImpl() final;
    void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
 
+   /// Writes the values rounded to the given number of mantissa bits (1 to 23).  With up to 7 bits, the values are
+   /// stored in 16 bit columns; otherwise the rounded values compress better than the full precision ones.
+   /// Throws an exception for an invalid number of bits.  Resets a quantization set before.
+   void SetTruncation(std::uint32_t nMantissaBits);
+   std::uint32_t GetNMantissaBits() const { return fNMantissaBits; }
+   /// Writes the values as fixed-point numbers with nBits bits (1 to 16) that cover the range [min, max].  Values
+   /// outside the range are clamped, NaNs are stored as min.  Throws an exception for invalid arguments.  Resets a
+   /// truncation set before.
+   void SetQuantization(double min, double max, std::uint32_t nBits);
+   std::uint32_t GetQuantizationNBits() const { return fQuantNBits; }
+   double GetQuantizationMin() const { return fQuantMin; }
+   double GetQuantizationMax() const { return fQuantMax; }
+
    float *Map(NTupleSize_t globalIndex) {
       return fPrincipalColumn->Map<float>(globalIndex);
    }
@@ -672,10 +720,18 @@ public:
 
 template <>
 class RField<double> : public Detail::RFieldBase {
+private:
+   /// The number of mantissa bits kept when writing; values are rounded to nearest, ties to even
+   std::uint32_t fNMantissaBits = 52;
+   /// For fixed-point storage, the number of bits and the value range set by SetQuantization()
+   std::uint32_t fQuantNBits = 0;
+   double fQuantMin = 0.;
+   double fQuantMax = 0.;
+
 protected:
-   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
-   }
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+   std::size_t AppendImpl(const Detail::RFieldValue &value) final;
+   void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
 
 public:
    static std::string TypeName() { return "double"; }
@@ -688,6 +744,21 @@ public:
    void GenerateColumnsImpl() final;
    void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
 
+   /// Writes the values rounded to the given number of mantissa bits (1 to 52).  The values keep the full exponent
+   /// range; they are stored in 64 bit columns, where the rounded values compress better than the full precision ones.
+   /// Throws an exception for an invalid number of bits.  Resets a quantization set before.
+   /// Real32 and Real16 columns without quantization can still be chosen with SetColumnRepresentative(); they only
+   /// hold the range of float, and writing a value outside of it throws an exception.
+   void SetTruncation(std::uint32_t nMantissaBits);
+   std::uint32_t GetNMantissaBits() const { return fNMantissaBits; }
+   /// Writes the values as fixed-point numbers with nBits bits (1 to 16) that cover the range [min, max].  Values
+   /// outside the range are clamped, NaNs are stored as min.  Throws an exception for invalid arguments.  Resets a
+   /// truncation set before.
+   void SetQuantization(double min, double max, std::uint32_t nBits);
+   std::uint32_t GetQuantizationNBits() const { return fQuantNBits; }
+   double GetQuantizationMin() const { return fQuantMin; }
+   double GetQuantizationMax() const { return fQuantMax; }
+
    double *Map(NTupleSize_t globalIndex) {
       return fPrincipalColumn->Map<double>(globalIndex);
    }
@@ -1159,7 +1230,7 @@ private:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
       return std::make_unique<RField>(newName);
    }
-   void AppendImpl(const ROOT::Experimental::Detail::RFieldValue& value) final;
+   std::size_t AppendImpl(const ROOT::Experimental::Detail::RFieldValue& value) final;
    void ReadGlobalImpl(ROOT::Experimental::NTupleSize_t globalIndex,
                        ROOT::Experimental::Detail::RFieldValue *value) final;
 
@@ -1306,7 +1377,7 @@ protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
       return std::make_unique<RField>(newName);
    }
-   void AppendImpl(const Detail::RFieldValue& value) final;
+   std::size_t AppendImpl(const Detail::RFieldValue& value) final;
    void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
    void GenerateColumnsImpl() final;
    void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
@@ -1363,16 +1434,18 @@ protected:
       auto newItemField = fSubFields[0]->Clone(fSubFields[0]->GetName());
       return std::make_unique<RField<ROOT::VecOps::RVec<ItemT>>>(newName, std::move(newItemField));
    }
-   void AppendImpl(const Detail::RFieldValue& value) final {
+   std::size_t AppendImpl(const Detail::RFieldValue& value) final {
       auto typedValue = value.Get<ContainerT>();
       auto count = typedValue->size();
+      std::size_t nbytes = 0;
       for (unsigned i = 0; i < count; ++i) {
          auto itemValue = fSubFields[0]->CaptureValue(&typedValue->data()[i]);
-         fSubFields[0]->Append(itemValue);
+         nbytes += fSubFields[0]->Append(itemValue);
       }
       Detail::RColumnElement<ClusterSize_t, EColumnType::kIndex> elemIndex(&fNWritten);
       fNWritten += count;
       fColumns[0]->Append(elemIndex);
+      return nbytes + elemIndex.GetSize();
    }
    void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final {
       auto typedValue = value->Get<ContainerT>();
@@ -1403,13 +1476,13 @@ public:
    ~RField() = default;
 
    void GenerateColumnsImpl() final {
-      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+      auto type = EnsureColumnRepresentative({EColumnType::kIndex, EColumnType::kSplitIndex}, 0);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateIndexColumn(type, 0)));
    }
    // TODO(jblomer): update together with RVec 2.0
-   void GenerateColumnsImpl(const RNTupleDescriptor & /*desc*/) final {
-      GenerateColumnsImpl();
+   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final {
+      auto type = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex}, 0, desc);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateIndexColumn(type, 0)));
    }
    void DestroyValue(const Detail::RFieldValue& value, bool dtorOnly = false) final {
       auto vec = reinterpret_cast<ContainerT*>(value.GetRawPtr());
@@ -1455,7 +1528,7 @@ protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
       return std::make_unique<RField<ROOT::VecOps::RVec<bool>>>(newName);
    }
-   void AppendImpl(const Detail::RFieldValue& value) final {
+   std::size_t AppendImpl(const Detail::RFieldValue& value) final {
       auto typedValue = value.Get<ContainerT>();
       auto count = typedValue->size();
       for (unsigned i = 0; i < count; ++i) {
@@ -1466,6 +1539,7 @@ protected:
       Detail::RColumnElement<ClusterSize_t, EColumnType::kIndex> elemIndex(&fNWritten);
       fNWritten += count;
       fColumns[0]->Append(elemIndex);
+      return count + elemIndex.GetSize();
    }
    void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final {
       auto typedValue = value->Get<ContainerT>();
@@ -1492,13 +1566,13 @@ public:
    ~RField() = default;
 
    void GenerateColumnsImpl() final {
-      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+      auto type = EnsureColumnRepresentative({EColumnType::kIndex, EColumnType::kSplitIndex}, 0);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateIndexColumn(type, 0)));
    }
    // TODO(jblomer): update together with RVec 2.0
-   void GenerateColumnsImpl(const RNTupleDescriptor & /*desc*/) final {
-      GenerateColumnsImpl();
+   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final {
+      auto type = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex}, 0, desc);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateIndexColumn(type, 0)));
    }
    void DestroyValue(const Detail::RFieldValue& value, bool dtorOnly = false) final {
       auto vec = reinterpret_cast<ContainerT*>(value.GetRawPtr());
@@ -86,7 +86,11 @@ struct RNTuple {
    }
 
    // RNTuple implements the hadd MergeFile interface
-   /// Merge this NTuple with the input list entries
+   /// Merge the RNTuples of the input files into a new RNTuple of the output file given by the merge info, using
+   /// RNTupleMerger.  The first entry of the input list provides the name of the RNTuple, the other entries are the
+   /// input files (TFile) that contain it in their top-level directory.  The merged RNTuple is written with the
+   /// compression settings of the output file and this object is set to its anchor.  Returns 0 on success, -1 if
+   /// the inputs cannot be merged or the output file already contains an object of that name.
    Long64_t Merge(TCollection *input, TFileMergeInfo *mergeInfo);
 };
 
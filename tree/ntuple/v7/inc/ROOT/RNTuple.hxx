@@ -26,6 +26,7 @@
 #include <ROOT/RSpan.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <sstream>
@@ -257,6 +258,10 @@ private:
    Detail::RNTupleMetrics fMetrics;
    NTupleSize_t fLastCommitted;
    NTupleSize_t fNEntries;
+   /// The number of uncompressed bytes appended to the columns since the last cluster commit
+   std::size_t fUnzippedClusterSize = 0;
+   /// The uncompressed cluster size that is expected to result in the target compressed cluster size
+   std::size_t fUnzippedClusterSizeEst;
 
 public:
    /// Throws an exception if the model is null.
@@ -281,11 +286,14 @@ public:
    /// a light check whether the entry comes from the ntuple's own model
    void Fill(REntry &entry) {
       for (auto& value : entry) {
-         value.GetField()->Append(value);
+         fUnzippedClusterSize += value.GetField()->Append(value);
       }
       fNEntries++;
-      if ((fNEntries % fSink->GetWriteOptions().GetNEntriesPerCluster()) == 0)
+      if ((fUnzippedClusterSize >= fUnzippedClusterSizeEst) ||
+          ((fNEntries - fLastCommitted) >= fSink->GetWriteOptions().GetNEntriesPerCluster()))
+      {
          CommitCluster();
+      }
    }
    /// Ensure that the data from the so far seen Fill calls has been written to storage
    void CommitCluster();
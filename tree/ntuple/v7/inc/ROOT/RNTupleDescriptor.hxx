@@ -25,6 +25,7 @@
 #include <chrono>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <vector>
@@ -189,9 +190,6 @@ public:
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
 
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
-
       bool operator==(const RColumnRange &other) const {
          return fColumnId == other.fColumnId && fFirstElementIndex == other.fFirstElementIndex &&
                 fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
@@ -202,6 +200,35 @@ public:
       }
    };
 
+   /// The range of values of a column of arithmetic type in a particular cluster.  Allows for skipping clusters
+   /// that cannot contain values passing a cut on the column.  Values are converted to double such that the
+   /// [fMin, fMax] interval covers all the values of the column; NaN values are not taken into account.
+   /// An empty column has fMin > fMax.
+   struct RColumnStatistics {
+      DescriptorId_t fColumnId = kInvalidDescriptorId;
+      /// Statistics are only stored for a column and cluster if they cover all the elements of the column
+      bool fIsValid = false;
+      double fMin = std::numeric_limits<double>::infinity();
+      double fMax = -std::numeric_limits<double>::infinity();
+
+      bool operator==(const RColumnStatistics &other) const {
+         return fColumnId == other.fColumnId && fIsValid == other.fIsValid && fMin == other.fMin &&
+                fMax == other.fMax;
+      }
+
+      /// Extend the statistics by the ones of another set of elements of the same column
+      void Merge(const RColumnStatistics &other) {
+         fIsValid = fIsValid && other.fIsValid;
+         fMin = std::min(fMin, other.fMin);
+         fMax = std::max(fMax, other.fMax);
+      }
+
+      /// Returns false only if none of the values can lie within the closed interval [min, max]
+      bool MayContain(double min, double max) const {
+         return !fIsValid || ((fMin <= max) && (fMax >= min));
+      }
+   };
+
    /// Records the parition of data into pages for a particular column in a particular cluster
    struct RPageRange {
       /// We do not need to store the element size / uncompressed page size because we know to which column
@@ -262,6 +289,8 @@ private:
 
    std::unordered_map<DescriptorId_t, RColumnRange> fColumnRanges;
    std::unordered_map<DescriptorId_t, RPageRange> fPageRanges;
+   /// Only present for the columns for which the writer computed valid statistics
+   std::unordered_map<DescriptorId_t, RColumnStatistics> fColumnStatistics;
 
 public:
    /// In order to handle changes to the serialization routine in future ntuple versions
@@ -283,6 +312,12 @@ public:
    RLocator GetLocator() const { return fLocator; }
    const RColumnRange &GetColumnRange(DescriptorId_t columnId) const { return fColumnRanges.at(columnId); }
    const RPageRange &GetPageRange(DescriptorId_t columnId) const { return fPageRanges.at(columnId); }
+   bool HasColumnStatistics(DescriptorId_t columnId) const {
+      return fColumnStatistics.find(columnId) != fColumnStatistics.end();
+   }
+   const RColumnStatistics &GetColumnStatistics(DescriptorId_t columnId) const {
+      return fColumnStatistics.at(columnId);
+   }
    bool ContainsColumn(DescriptorId_t columnId) const;
    std::unordered_set<DescriptorId_t> GetColumnIds() const;
 };
@@ -720,6 +755,7 @@ public:
    void SetClusterLocator(DescriptorId_t clusterId, RClusterDescriptor::RLocator locator);
    void AddClusterColumnRange(DescriptorId_t clusterId, const RClusterDescriptor::RColumnRange &columnRange);
    void AddClusterPageRange(DescriptorId_t clusterId, RClusterDescriptor::RPageRange &&pageRange);
+   void AddClusterColumnStatistics(DescriptorId_t clusterId, const RClusterDescriptor::RColumnStatistics &stats);
 
    void AddClustersFromFooter(void* footerBuffer);
 
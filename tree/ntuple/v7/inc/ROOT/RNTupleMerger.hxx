@@ -19,10 +19,16 @@
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 
 namespace ROOT {
 namespace Experimental {
 
+namespace Detail {
+class RPageSink;
+class RPageSource;
+} // namespace Detail
+
 // clang-format off
 /**
 \class ROOT::Experimental::RFieldMerger
@@ -38,6 +44,35 @@ public:
    static RResult<RFieldMerger> Merge(const RFieldDescriptor &lhs, const RFieldDescriptor &rhs);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleMerger
+\ingroup NTuple
+\brief Concatenates the entries of ntuples with identical schemas into a single ntuple
+
+The merger appends the clusters of the input page sources one after another to the destination page sink.  The
+schema of the destination, including the column types, is taken from the first source; all the other sources need
+to have the same fields and columns.  The pages are transferred in their sealed form: if a column of an input
+cluster uses the compression settings of the destination, its pages are copied verbatim.  Otherwise, they are
+decompressed and compressed again but never unpacked.  Every input cluster is read with a single vector read.
+With parallel reading turned on, the next input cluster, possibly from the next source, is read in the background
+while the current cluster is written.  hadd and TFileMerger merge RNTuples through RNTuple::Merge(), which uses
+this class.
+*/
+// clang-format on
+class RNTupleMerger {
+private:
+   bool fParallelRead = false;
+
+public:
+   bool GetParallelRead() const { return fParallelRead; }
+   void SetParallelRead(bool val) { fParallelRead = val; }
+
+   /// Attaches the sources one by one and merges their clusters into the destination, which must not have been
+   /// created yet.  Commits the destination data set.  Throws an exception if the sources have different schemas.
+   void Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination);
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
@@ -19,6 +19,8 @@
 #include <Compression.h>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <cstddef>
+
 namespace ROOT {
 namespace Experimental {
 
@@ -42,14 +44,26 @@ enum class ENTupleContainerFormat {
 \brief Common user-tunable settings for storing ntuples
 
 All page sink classes need to support the common options.
+
+Clusters are committed by the writer once either of the cluster size limits is reached.  The writer estimates the
+compressed cluster size from the compression ratio of the previously written clusters.  Pages are flushed once they
+hold the given number of elements or once they reach the maximum unzipped page size, whatever comes first.
 */
 // clang-format on
 class RNTupleWriteOptions {
    int fCompression{RCompressionSetting::EDefaults::kUseAnalysis};
    ENTupleContainerFormat fContainerFormat{ENTupleContainerFormat::kTFile};
    NTupleSize_t fNEntriesPerCluster = 64000;
+   /// Approximate target size of a compressed cluster on storage
+   std::size_t fApproxZippedClusterSize = 50 * 1000 * 1000;
+   /// Memory limit for the uncompressed data of a cluster, regardless of the compression ratio
+   std::size_t fMaxUnzippedClusterSize = 512 * 1024 * 1024;
    NTupleSize_t fNElementsPerPage = 10000;
+   /// Upper limit for the in-memory size of a page; large element types get fewer elements per page
+   std::size_t fMaxUnzippedPageSize = 1024 * 1024;
    bool fUseBufferedWrite = true;
+   /// Store the value range of every column of arithmetic type per cluster, which allows readers to skip clusters
+   bool fComputeColumnStatistics = false;
 
 public:
    int GetCompression() const { return fCompression; }
@@ -64,11 +78,23 @@ public:
    NTupleSize_t GetNElementsPerPage() const { return fNElementsPerPage; }
    void SetNElementsPerPage(NTupleSize_t val) { fNElementsPerPage = val; }
 
+   std::size_t GetMaxUnzippedPageSize() const { return fMaxUnzippedPageSize; }
+   void SetMaxUnzippedPageSize(std::size_t val) { fMaxUnzippedPageSize = val; }
+
    NTupleSize_t GetNEntriesPerCluster() const { return fNEntriesPerCluster; }
    void SetNEntriesPerCluster(NTupleSize_t val) { fNEntriesPerCluster = val; }
 
+   std::size_t GetApproxZippedClusterSize() const { return fApproxZippedClusterSize; }
+   void SetApproxZippedClusterSize(std::size_t val) { fApproxZippedClusterSize = val; }
+
+   std::size_t GetMaxUnzippedClusterSize() const { return fMaxUnzippedClusterSize; }
+   void SetMaxUnzippedClusterSize(std::size_t val) { fMaxUnzippedClusterSize = val; }
+
    bool GetUseBufferedWrite() const { return fUseBufferedWrite; }
    void SetUseBufferedWrite(bool val) { fUseBufferedWrite = val; }
+
+   bool GetComputeColumnStatistics() const { return fComputeColumnStatistics; }
+   void SetComputeColumnStatistics(bool val) { fComputeColumnStatistics = val; }
 };
 
 
@@ -91,10 +117,29 @@ public:
 
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
+   /// When loading a cluster, nearby pages are read in a single request if the extra bytes read in the gaps between
+   /// them add up to at most the given fraction of the requested bytes. A value of zero only merges adjacent pages.
+   float fMaxReadOverhead = 0.25;
+   /// Upper limit for a single gap between two pages that is read in order to merge their requests
+   std::size_t fMaxReadGap = std::size_t(-1);
+   /// Upper limit in bytes for the clusters that the cluster pool reads ahead, keeps in flight, or retains in the
+   /// look-back window.  The size of a cluster is estimated from the descriptor as the sum of the compressed and
+   /// the uncompressed sizes of its requested pages.  The currently requested cluster is always loaded.  A value
+   /// of zero only limits the look-ahead by the number of clusters in the pool.
+   std::size_t fClusterCacheMemoryLimit = 0;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
+
+   float GetMaxReadOverhead() const { return fMaxReadOverhead; }
+   void SetMaxReadOverhead(float val) { fMaxReadOverhead = val; }
+
+   std::size_t GetMaxReadGap() const { return fMaxReadGap; }
+   void SetMaxReadGap(std::size_t val) { fMaxReadGap = val; }
+
+   std::size_t GetClusterCacheMemoryLimit() const { return fClusterCacheMemoryLimit; }
+   void SetClusterCacheMemoryLimit(std::size_t val) { fClusterCacheMemoryLimit = val; }
 };
 
 } // namespace Experimental
@@ -0,0 +1,139 @@
+/// \file ROOT/RNTupleParallelWriter.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2021-06-14
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleParallelWriter
+#define ROOT7_RNTupleParallelWriter
+
+#include <ROOT/REntry.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+class RNTupleParallelWriter;
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleFillContext
+\ingroup NTuple
+\brief A context for filling entries of an RNTupleParallelWriter from a single thread
+
+The fill context owns a clone of the writer's model and fills entries into its own clusters.  Pages are sealed
+(packed and compressed) on the thread that fills the context.  Once a cluster is full, or on CommitCluster(), the
+sealed pages are appended as a new cluster to the parallel writer.  A fill context must only be used by a single
+thread at a time and it must be destructed before its parallel writer.
+*/
+// clang-format on
+class RNTupleFillContext {
+   friend class RNTupleParallelWriter;
+
+private:
+   /// Writes the sealed clusters through the parallel writer.  Needs to be destructed after the model.
+   std::unique_ptr<Detail::RPageSink> fSink;
+   std::unique_ptr<RNTupleModel> fModel;
+   NTupleSize_t fLastCommitted = 0;
+   NTupleSize_t fNEntries = 0;
+   /// The number of uncompressed bytes appended to the columns since the last cluster commit
+   std::size_t fUnzippedClusterSize = 0;
+   /// The uncompressed cluster size that is expected to result in the target compressed cluster size
+   std::size_t fUnzippedClusterSizeEst;
+
+   RNTupleFillContext(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+
+public:
+   RNTupleFillContext(const RNTupleFillContext &) = delete;
+   RNTupleFillContext &operator=(const RNTupleFillContext &) = delete;
+   ~RNTupleFillContext();
+
+   /// The model of the fill context, a clone of the parallel writer's model with its own default entry
+   RNTupleModel *GetModel() { return fModel.get(); }
+   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+
+   void Fill() { Fill(*fModel->GetDefaultEntry()); }
+   /// The entry needs to be created from the fill context's model
+   void Fill(REntry &entry) {
+      for (auto &value : entry) {
+         fUnzippedClusterSize += value.GetField()->Append(value);
+      }
+      fNEntries++;
+      if ((fUnzippedClusterSize >= fUnzippedClusterSizeEst) ||
+          ((fNEntries - fLastCommitted) >= fSink->GetWriteOptions().GetNEntriesPerCluster())) {
+         CommitCluster();
+      }
+   }
+   /// Seal the pages of the entries filled so far and append them as a new cluster to the parallel writer
+   void CommitCluster();
+
+   /// The number of entries filled into this context
+   NTupleSize_t GetNEntries() const { return fNEntries; }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief An RNTuple writer that can be filled concurrently from multiple threads
+
+Every thread obtains its own RNTupleFillContext from CreateFillContext().  The fill contexts build and compress
+clusters independently of each other; only appending a finished cluster to the underlying page sink is serialized.
+Consequently, the order of entries in the written ntuple is only preserved within a cluster.  The data set is
+committed when the parallel writer is destructed, which must happen after all its fill contexts are destructed.
+*/
+// clang-format on
+class RNTupleParallelWriter {
+private:
+   class RPageSinkFillContext;
+
+   /// Serializes the access to fSink and fNEntries
+   std::mutex fMutex;
+   /// The sink that receives the sealed clusters of all the fill contexts.  Needs to be destructed after the model.
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// The prototype for the models of the fill contexts; it is never filled itself
+   std::unique_ptr<RNTupleModel> fModel;
+   /// The number of entries committed to fSink so far
+   NTupleSize_t fNEntries = 0;
+   std::vector<std::weak_ptr<RNTupleFillContext>> fFillContexts;
+
+public:
+   /// Throws an exception if the model is null.
+   static std::unique_ptr<RNTupleParallelWriter> Recreate(std::unique_ptr<RNTupleModel> model,
+                                                          std::string_view ntupleName, std::string_view storage,
+                                                          const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   /// Throws an exception if the model or the sink is null.  The sink should not buffer pages, as the fill
+   /// contexts already hand over entire clusters.
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+   RNTupleParallelWriter(const RNTupleParallelWriter &) = delete;
+   RNTupleParallelWriter &operator=(const RNTupleParallelWriter &) = delete;
+   ~RNTupleParallelWriter();
+
+   /// Creates a new fill context for the calling thread.  Thread-safe.
+   std::shared_ptr<RNTupleFillContext> CreateFillContext();
+
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+   /// The number of entries committed by all fill contexts so far.  Thread-safe.
+   NTupleSize_t GetNEntries();
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -215,6 +215,9 @@ public:
    MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
       return fField.MapV(clusterIndex, nItems);
    }
+
+   /// Copies the values of count consecutive entries starting at globalIndex into the array to
+   void ReadBulk(NTupleSize_t globalIndex, NTupleSize_t count, T *to) { fField.ReadBulk(globalIndex, count, to); }
 };
 
 
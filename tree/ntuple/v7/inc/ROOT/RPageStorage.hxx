@@ -28,6 +28,7 @@
 #include <functional>
 #include <memory>
 #include <unordered_set>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -83,6 +84,8 @@ public:
       const void *fBuffer = nullptr;
       std::uint32_t fSize = 0;
       std::uint32_t fNElements = 0;
+      /// The value range of the page's elements, passed on to the sink if the writer computes column statistics
+      RClusterDescriptor::RColumnStatistics fStatistics;
 
       RSealedPage() = default;
       RSealedPage(const RSealedPage &other) = delete;
@@ -166,6 +169,9 @@ protected:
    std::vector<RClusterDescriptor::RColumnRange> fOpenColumnRanges;
    /// Keeps track of the written pages in the currently open cluster. Indexed by column id.
    std::vector<RClusterDescriptor::RPageRange> fOpenPageRanges;
+   /// Keeps track of the value ranges in the currently open cluster if column statistics are enabled.
+   /// Indexed by column id.
+   std::vector<RClusterDescriptor::RColumnStatistics> fOpenColumnStatistics;
    RNTupleDescriptorBuilder fDescriptorBuilder;
 
    virtual void CreateImpl(const RNTupleModel &model) = 0;
@@ -186,6 +192,11 @@ protected:
    static RSealedPage SealPage(const RPage &page, const RColumnElementBase &element,
       int compressionSetting, void *buf);
 
+   /// Helper for ReservePage(): the number of elements of a page whose size is left to the page sink.  This is
+   /// the number of elements per page given in the write options, capped such that the page does not exceed
+   /// the maximum unzipped page size.  The page holds at least one element.
+   std::size_t GetNElementsPerPage(ColumnHandle_t columnHandle) const;
+
 public:
    RPageSink(std::string_view ntupleName, const RNTupleWriteOptions &options);
 
@@ -201,6 +212,14 @@ public:
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
    /// Returns the sink's write options.
    const RNTupleWriteOptions &GetWriteOptions() const { return fOptions; }
+   /// Returns the descriptor of the data written so far; its fields and columns are known after Create().
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
+   /// Returns the uncompressed cluster size that should yield the approximate compressed cluster size given in the
+   /// options, provided the data compresses like the previous cluster with nbytesUnzipped and nbytesZipped.  If the
+   /// previous cluster size is unknown, a compression factor of one is assumed.  The result is capped by the
+   /// maximum uncompressed cluster size.
+   static std::size_t EstimateUnzippedClusterSize(const RNTupleWriteOptions &options, std::size_t nbytesUnzipped,
+                                                  std::uint64_t nbytesZipped);
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
    void DropColumn(ColumnHandle_t /*columnHandle*/) final {}
@@ -215,7 +234,8 @@ public:
    /// TODO(jblomer): allow for vector commit of sealed pages
    void CommitSealedPage(DescriptorId_t columnId, const RPageStorage::RSealedPage &sealedPage);
    /// Finalize the current cluster and create a new one for the following data.
-   void CommitCluster(NTupleSize_t nEntries);
+   /// Returns the number of bytes of the cluster on storage or zero if the sink does not know the cluster size.
+   std::uint64_t CommitCluster(NTupleSize_t nEntries);
    /// Finalize the current cluster and the entrire data set.
    void CommitDataset() { CommitDatasetImpl(); }
 
@@ -285,6 +305,10 @@ public:
    NTupleSize_t GetNEntries();
    NTupleSize_t GetNElements(ColumnHandle_t columnHandle);
    ColumnId_t GetColumnId(ColumnHandle_t columnHandle);
+   /// Returns the ids of the clusters, ordered by entry number, that may contain values of the given column within
+   /// the closed interval [min, max].  Uses the column statistics stored in the footer, i.e. the pages of the
+   /// skipped clusters are never read.  Clusters without statistics for the column are always part of the result.
+   std::vector<DescriptorId_t> FindClustersInRange(DescriptorId_t columnId, double min, double max) const;
 
    /// Allocates and fills a page that contains the index-th element
    virtual RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) = 0;
@@ -306,6 +330,11 @@ public:
    /// LoadCluster() is typically called from the I/O thread of a cluster pool, i.e. the method runs
    /// concurrently to other methods of the page source.
    virtual std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) = 0;
+   /// Starts reading the pages of the given cluster and columns without waiting for the data.  A subsequent
+   /// LoadCluster() with the same arguments then only waits for the outstanding reads.  Page sources without
+   /// asynchronous I/O do nothing, which is the default.  Like LoadCluster(), typically called from the I/O thread
+   /// of a cluster pool; every prefetched cluster must eventually be loaded by the same thread.
+   virtual void PrefetchCluster(DescriptorId_t /* clusterId */, const ColumnSet_t & /* columns */) {}
 
    /// Parallel decompression and unpacking of the pages in the given cluster. The unzipped pages are supposed
    /// to be preloaded in a page pool attached to the source. The method is triggered by the cluster pool's
@@ -27,6 +27,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 class TFile;
 
@@ -136,6 +137,7 @@ private:
    struct RCounters {
       RNTupleAtomicCounter &fNReadV;
       RNTupleAtomicCounter &fNRead;
+      RNTupleAtomicCounter &fNReadSaved;
       RNTupleAtomicCounter &fSzReadPayload ;
       RNTupleAtomicCounter &fSzReadOverhead;
       RNTupleAtomicCounter &fSzUnzip;
@@ -166,12 +168,18 @@ private:
    std::unique_ptr<ROOT::Internal::RRawFile> fFile;
    /// Takes the fFile to read ntuple blobs from it
    Internal::RMiniFileReader fReader;
+   /// The read requests and the page buffer of a cluster whose pages are being read
+   struct RClusterRead;
+   /// Clusters started by PrefetchCluster() that have not yet been picked up by LoadCluster()
+   std::vector<std::unique_ptr<RClusterRead>> fPrefetchedClusters;
    /// The cluster pool asynchronously preloads the next few clusters
    std::unique_ptr<RClusterPool> fClusterPool;
 
    RPageSourceFile(std::string_view ntupleName, const RNTupleReadOptions &options);
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterDescriptor &clusterDescriptor,
                                  ClusterSize_t::ValueType idxInCluster);
+   /// Computes the coalesced read requests for the pages of the given cluster and columns
+   std::unique_ptr<RClusterRead> PrepareClusterRead(DescriptorId_t clusterId, const ColumnSet_t &columns);
 
 protected:
    RNTupleDescriptor AttachImpl() final;
@@ -179,6 +187,9 @@ protected:
 
 public:
    RPageSourceFile(std::string_view ntupleName, std::string_view path, const RNTupleReadOptions &options);
+   /// Reads the ntuple from the given raw file, e.g. a file wrapped in an RRawFileLatency for I/O benchmarks
+   RPageSourceFile(std::string_view ntupleName, std::unique_ptr<ROOT::Internal::RRawFile> file,
+                   const RNTupleReadOptions &options);
    /// The cloned page source creates a new raw file and reader and opens its own file descriptor to the data.
    /// The meta-data (header and footer) is reread and parsed by the clone.
    std::unique_ptr<RPageSource> Clone() const final;
@@ -197,6 +208,7 @@ public:
                        RSealedPage &sealedPage) final;
 
    std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) final;
+   void PrefetchCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) final;
 
    RNTupleMetrics &GetMetrics() final { return fMetrics; }
 };
@@ -14,6 +14,7 @@
  *************************************************************************/
 
 #include <ROOT/RClusterPool.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RPageStorage.hxx>
 
@@ -29,6 +30,24 @@
 #include <mutex>
 #include <set>
 #include <utility>
+#include <vector>
+
+namespace {
+
+/// Nanoseconds elapsed since `start`, at least one so that a measurement is distinguishable from no measurement
+std::int64_t NanosecondsSince(std::chrono::steady_clock::time_point start)
+{
+   auto elapsed = std::chrono::steady_clock::now() - start;
+   return std::max(std::int64_t(1), std::int64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+}
+
+/// Exponentially weighted moving average that gives a weight of 1/4 to the new sample
+std::int64_t MovingAverage(std::int64_t avg, std::int64_t sample)
+{
+   return (avg == 0) ? sample : (3 * avg + sample) / 4;
+}
+
+} // anonymous namespace
 
 bool ROOT::Experimental::Detail::RClusterPool::RInFlightCluster::operator <(const RInFlightCluster &other) const
 {
@@ -50,10 +69,24 @@ bool ROOT::Experimental::Detail::RClusterPool::RInFlightCluster::operator <(cons
 ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int size)
    : fPageSource(pageSource)
    , fPool(size)
+   , fMemoryLimit(pageSource.GetReadOptions().GetClusterCacheMemoryLimit())
+   , fMetrics("RClusterPool")
    , fThreadIo(&RClusterPool::ExecReadClusters, this)
    , fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
 {
    R__ASSERT(size > 0);
+   fCounters = std::unique_ptr<RCounters>(new RCounters{
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("timeWallStall", "ns",
+                                                   "wall clock time the consumer waited for clusters"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nLookAhead", "",
+                                                   "number of clusters in the current look-ahead window"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nLookAheadLimited", "",
+                                                   "number of times the look-ahead was reduced by the memory limit"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nClusterUnused", "",
+                                                   "number of partial clusters preloaded but never requested"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szPrefetchUnused", "B",
+                                                   "estimated volume of clusters preloaded but never requested")
+   });
    fWindowPre = 0;
    fWindowPost = size;
    // Large pools maintain a small look-back window together with the large look-ahead window
@@ -99,7 +132,9 @@ void ROOT::Experimental::Detail::RClusterPool::ExecUnzipClusters()
          if (!item.fCluster)
             return;
 
+         auto tStart = std::chrono::steady_clock::now();
          fPageSource.UnzipCluster(item.fCluster.get());
+         fAvgUnzipTime.store(MovingAverage(fAvgUnzipTime.load(), NanosecondsSince(tStart)));
 
          // Afterwards the GetCluster() method in the main thread can pick-up the cluster
          item.fPromise.set_value(std::move(item.fCluster));
@@ -120,12 +155,23 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
          }
       }
 
+      // Start reading all the clusters of the batch, so that the reads of the later clusters overlap with
+      // unzipping the earlier ones
+      for (const auto &item : readItems) {
+         if (item.fClusterId == kInvalidDescriptorId)
+            break;
+         fPageSource.PrefetchCluster(item.fClusterId, item.fColumns);
+      }
+
+      auto tStart = std::chrono::steady_clock::now();
       for (auto &item : readItems) {
          if (item.fClusterId == kInvalidDescriptorId)
             return;
 
-         // TODO(jblomer): the page source needs to be capable of loading multiple clusters in one go
          auto cluster = fPageSource.LoadCluster(item.fClusterId, item.fColumns);
+         // With prefetching, the time between two finished clusters is the effective load time per cluster
+         fAvgLoadTime.store(MovingAverage(fAvgLoadTime.load(), NanosecondsSince(tStart)));
+         tStart = std::chrono::steady_clock::now();
 
          // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
          // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
@@ -174,6 +220,44 @@ size_t ROOT::Experimental::Detail::RClusterPool::FindFreeSlot() const
    return N;
 }
 
+unsigned int ROOT::Experimental::Detail::RClusterPool::GetLookAhead() const
+{
+   auto pipelineTime = std::max(fAvgLoadTime.load(), fAvgUnzipTime.load());
+   if ((pipelineTime == 0) || (fAvgConsumeTime == 0))
+      return fWindowPost;
+   // The clusters consumed while the pipeline processes one cluster, plus the currently active cluster
+   auto nClusters = 1 + (pipelineTime + fAvgConsumeTime - 1) / fAvgConsumeTime;
+   auto nMin = std::min(2u, fWindowPost);
+   return static_cast<unsigned int>(std::max(std::int64_t(nMin), std::min(std::int64_t(fWindowPost), nClusters)));
+}
+
+std::size_t ROOT::Experimental::Detail::RClusterPool::EstimateClusterSize(
+   DescriptorId_t clusterId, const RPageSource::ColumnSet_t &columns) const
+{
+   const auto &desc = fPageSource.GetDescriptor();
+   const auto &clusterDesc = desc.GetClusterDescriptor(clusterId);
+   std::size_t nbytes = 0;
+   for (auto columnId : columns) {
+      if (!clusterDesc.ContainsColumn(columnId))
+         continue;
+      auto bitsOnStorage = RColumnElementBase::GetBitsOnStorage(desc.GetColumnDescriptor(columnId).GetModel().GetType());
+      for (const auto &pageInfo : clusterDesc.GetPageRange(columnId).fPageInfos) {
+         nbytes += pageInfo.fLocator.fBytesOnStorage;
+         nbytes += (pageInfo.fNElements * bitsOnStorage + 7) / 8;
+      }
+   }
+   return nbytes;
+}
+
+void ROOT::Experimental::Detail::RClusterPool::ReleaseCluster(
+   DescriptorId_t clusterId, const RPageSource::ColumnSet_t &columns)
+{
+   if (fRequestedClusters.erase(clusterId) > 0)
+      return;
+   fCounters->fNClusterUnused.Inc();
+   fCounters->fSzPrefetchUnused.Add(EstimateClusterSize(clusterId, columns));
+}
+
 
 namespace {
 
@@ -222,30 +306,60 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
 {
    const auto &desc = fPageSource.GetDescriptor();
 
-   // Determine previous cluster ids that we keep if they happen to be in the pool
-   std::set<DescriptorId_t> keep;
-   auto prev = clusterId;
-   for (unsigned int i = 0; i < fWindowPre; ++i) {
-      prev = desc.FindPrevClusterId(prev);
-      if (prev == kInvalidDescriptorId)
-         break;
-      keep.insert(prev);
+   const bool isNewCluster = (clusterId != fLastClusterId);
+   if (isNewCluster && (fLastClusterId != kInvalidDescriptorId)) {
+      auto consumeTime = std::max(std::int64_t(1), NanosecondsSince(fLastClusterTime) - fStallTime);
+      fAvgConsumeTime = MovingAverage(fAvgConsumeTime, consumeTime);
    }
 
+   // The estimated size of a cluster once it is in the pool, including the columns it already has
+   auto fnClusterSize = [&](DescriptorId_t id) -> std::size_t {
+      auto cptr = FindInPool(id);
+      if (!cptr)
+         return EstimateClusterSize(id, columns);
+      auto allColumns = columns;
+      allColumns.insert(cptr->GetAvailColumns().begin(), cptr->GetAvailColumns().end());
+      return EstimateClusterSize(id, allColumns);
+   };
+   std::size_t nbytes = (fMemoryLimit > 0) ? fnClusterSize(clusterId) : 0;
+
    // Determine following cluster ids and the column ids that we want to make available
    RProvides provide;
    provide.Insert(clusterId, columns);
+   auto lookAhead = GetLookAhead();
+   fCounters->fNLookAhead.SetValue(lookAhead);
    auto next = clusterId;
-   // TODO(jblomer): instead of a fixed-sized window, eventually we should determine the window size based on
-   // a user-defined memory limit.  The size of the preloaded data can be determined at the beginning of
-   // GetCluster from the descriptor and the current contents of fPool.
-   for (unsigned int i = 1; i < fWindowPost; ++i) {
+   for (unsigned int i = 1; i < lookAhead; ++i) {
       next = desc.FindNextClusterId(next);
       if (next == kInvalidDescriptorId)
          break;
+      if (fMemoryLimit > 0) {
+         auto nbytesNext = fnClusterSize(next);
+         if (nbytes + nbytesNext > fMemoryLimit) {
+            fCounters->fNLookAheadLimited.Inc();
+            break;
+         }
+         nbytes += nbytesNext;
+      }
       provide.Insert(next, columns);
    }
 
+   // Determine previous cluster ids that we keep if they happen to be in the pool and fit in the memory limit
+   std::set<DescriptorId_t> keep;
+   auto prev = clusterId;
+   for (unsigned int i = 0; i < fWindowPre; ++i) {
+      prev = desc.FindPrevClusterId(prev);
+      if (prev == kInvalidDescriptorId)
+         break;
+      if ((fMemoryLimit > 0) && FindInPool(prev)) {
+         auto nbytesPrev = fnClusterSize(prev);
+         if (nbytes + nbytesPrev > fMemoryLimit)
+            break;
+         nbytes += nbytesPrev;
+      }
+      keep.insert(prev);
+   }
+
    // Clear the cache from clusters not the in the look-ahead or the look-back window
    for (auto &cptr : fPool) {
       if (!cptr)
@@ -254,8 +368,10 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
          continue;
       if (keep.count(cptr->GetId()) > 0)
          continue;
+      ReleaseCluster(cptr->GetId(), cptr->GetAvailColumns());
       cptr.reset();
    }
+   fRequestedClusters.insert(clusterId);
 
    // Move clusters that meanwhile arrived into cache pool
    {
@@ -280,6 +396,10 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
          auto cptr = itr->fFuture.get();
          // If cptr is nullptr, the cluster expired previously and was released by the I/O thread
          if (!cptr || itr->fIsExpired) {
+            if (fRequestedClusters.count(itr->fClusterId) == 0) {
+               fCounters->fNClusterUnused.Inc();
+               fCounters->fSzPrefetchUnused.Add(EstimateClusterSize(itr->fClusterId, itr->fColumns));
+            }
             cptr.reset();
             itr = fInFlightClusters.erase(itr);
             continue;
@@ -326,7 +446,13 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
          fCvHasReadWork.notify_one();
    } // work queue lock guard
 
-   return WaitFor(clusterId, columns);
+   auto result = WaitFor(clusterId, columns);
+   if (isNewCluster) {
+      fLastClusterId = clusterId;
+      fLastClusterTime = std::chrono::steady_clock::now();
+      fStallTime = 0;
+   }
+   return result;
 }
 
 
@@ -366,7 +492,11 @@ ROOT::Experimental::Detail::RClusterPool::WaitFor(
          // is released.  We need to release the lock before potentially blocking on the cluster future.
       }
 
+      auto tStart = std::chrono::steady_clock::now();
       auto cptr = itr->fFuture.get();
+      auto stallTime = NanosecondsSince(tStart);
+      fStallTime += stallTime;
+      fCounters->fTimeWallStall.Add(stallTime);
       if (result) {
          result->Adopt(std::move(*cptr));
       } else {
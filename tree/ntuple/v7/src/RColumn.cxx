@@ -20,6 +20,7 @@
 #include <TError.h>
 
 #include <iostream>
+#include <memory>
 
 ROOT::Experimental::Detail::RColumn::RColumn(const RColumnModel& model, std::uint32_t index)
    : fModel(model), fIndex(index), fPageSink(nullptr), fPageSource(nullptr), fHeadPage(), fNElements(0),
@@ -59,6 +60,28 @@ void ROOT::Experimental::Detail::RColumn::Connect(DescriptorId_t fieldId, RPageS
    }
 }
 
+ROOT::Experimental::RClusterDescriptor::RColumnStatistics
+ROOT::Experimental::Detail::RColumn::GetPageStatistics(const RPage &page) const
+{
+   RClusterDescriptor::RColumnStatistics stats;
+   if (!fExtendRange)
+      return stats;
+
+   const auto nElements = page.GetNElements();
+   if (fElement->IsLossy() && (nElements > 0)) {
+      // The cluster filters compare against the stored values, which may lie outside the range of the original ones
+      auto packed = std::make_unique<unsigned char[]>(fElement->GetPackedSize(nElements));
+      auto unpacked = std::make_unique<unsigned char[]>(nElements * fElement->GetSize());
+      fElement->Pack(packed.get(), page.GetBuffer(), nElements);
+      fElement->Unpack(unpacked.get(), packed.get(), nElements);
+      fExtendRange(unpacked.get(), nElements, stats.fMin, stats.fMax);
+   } else {
+      fExtendRange(page.GetBuffer(), nElements, stats.fMin, stats.fMax);
+   }
+   stats.fIsValid = true;
+   return stats;
+}
+
 void ROOT::Experimental::Detail::RColumn::Flush()
 {
    if (fHeadPage.GetSize() == 0) return;
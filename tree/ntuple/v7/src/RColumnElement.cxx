@@ -14,15 +14,193 @@
  *************************************************************************/
 
 #include <ROOT/RColumnElement.hxx>
+#include <ROOT/RError.hxx>
 
 #include <TError.h>
 
 #include <algorithm>
 #include <bitset>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
+namespace {
+
+/// Moves byte number b of element i to position b * count + i in the destination, i.e. the destination first holds
+/// the first bytes of all the elements, then all the second bytes, and so on.
+template <std::size_t N>
+void ByteSplit(const void *element, std::size_t i, std::size_t count, unsigned char *dst)
+{
+   const unsigned char *bytes = reinterpret_cast<const unsigned char *>(element);
+   for (std::size_t b = 0; b < N; ++b)
+      dst[b * count + i] = bytes[b];
+}
+
+/// Inverse of ByteSplit(): collects the N bytes of element i from a split buffer
+template <std::size_t N>
+void ByteUnsplit(const unsigned char *src, std::size_t i, std::size_t count, void *element)
+{
+   unsigned char *bytes = reinterpret_cast<unsigned char *>(element);
+   for (std::size_t b = 0; b < N; ++b)
+      bytes[b] = src[b * count + i];
+}
+
+/// Maps signed integers of small magnitude to unsigned integers with many leading zero bytes:
+/// 0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, ...
+template <typename T>
+typename std::make_unsigned<T>::type ZigzagEncode(T value)
+{
+   using UnsignedT = typename std::make_unsigned<T>::type;
+   return (static_cast<UnsignedT>(value) << 1) ^ static_cast<UnsignedT>(value >> (sizeof(T) * 8 - 1));
+}
+
+template <typename T>
+T ZigzagDecode(typename std::make_unsigned<T>::type value)
+{
+   using UnsignedT = typename std::make_unsigned<T>::type;
+   return static_cast<T>((value >> 1) ^ (UnsignedT(0) - (value & 1)));
+}
+
+template <typename T>
+void PackSplitReal(void *dst, const void *src, std::size_t count)
+{
+   auto splitArray = reinterpret_cast<unsigned char *>(dst);
+   auto typedArray = reinterpret_cast<const T *>(src);
+   for (std::size_t i = 0; i < count; ++i)
+      ByteSplit<sizeof(T)>(&typedArray[i], i, count, splitArray);
+}
+
+template <typename T>
+void UnpackSplitReal(void *dst, const void *src, std::size_t count)
+{
+   auto splitArray = reinterpret_cast<const unsigned char *>(src);
+   auto typedArray = reinterpret_cast<T *>(dst);
+   for (std::size_t i = 0; i < count; ++i)
+      ByteUnsplit<sizeof(T)>(splitArray, i, count, &typedArray[i]);
+}
+
+/// Integers are zigzag encoded as signed numbers irrespective of the in-memory type, such that the on-disk format
+/// only depends on the column type and not on the signedness of the C++ type
+template <typename T>
+void PackSplitInt(void *dst, const void *src, std::size_t count)
+{
+   using SignedT = typename std::make_signed<T>::type;
+   auto splitArray = reinterpret_cast<unsigned char *>(dst);
+   auto typedArray = reinterpret_cast<const T *>(src);
+   for (std::size_t i = 0; i < count; ++i) {
+      auto encoded = ZigzagEncode(static_cast<SignedT>(typedArray[i]));
+      ByteSplit<sizeof(T)>(&encoded, i, count, splitArray);
+   }
+}
+
+template <typename T>
+void UnpackSplitInt(void *dst, const void *src, std::size_t count)
+{
+   using SignedT = typename std::make_signed<T>::type;
+   using UnsignedT = typename std::make_unsigned<T>::type;
+   auto splitArray = reinterpret_cast<const unsigned char *>(src);
+   auto typedArray = reinterpret_cast<T *>(dst);
+   for (std::size_t i = 0; i < count; ++i) {
+      UnsignedT encoded;
+      ByteUnsplit<sizeof(T)>(splitArray, i, count, &encoded);
+      typedArray[i] = static_cast<T>(ZigzagDecode<SignedT>(encoded));
+   }
+}
+
+/// Rounds a single precision float to its upper 16 bits (sign, exponent, 7 mantissa bits), rounding half to even
+std::uint16_t FloatToReal16(float value)
+{
+   std::uint32_t bits;
+   std::memcpy(&bits, &value, sizeof(bits));
+   // Keep NaNs quiet; rounding could otherwise turn them into infinities
+   if ((bits & 0x7fffffff) > 0x7f800000)
+      return static_cast<std::uint16_t>((bits >> 16) | 0x0040);
+   auto rounded = bits + 0x7fff + ((bits >> 16) & 1);
+   // Values close to the largest finite float are truncated rather than rounded up to infinity
+   if (((rounded & 0x7f800000) == 0x7f800000) && ((bits & 0x7f800000) != 0x7f800000))
+      rounded = bits;
+   return static_cast<std::uint16_t>(rounded >> 16);
+}
+
+/// Converts a double to a float for columns that store doubles in single precision.  Throws if the value is outside
+/// the float range, such that it would become infinite or zero.
+float DoubleToFloat(double value)
+{
+   const float result = static_cast<float>(value);
+   if ((std::isinf(result) && !std::isinf(value)) || ((result == 0.f) && (value != 0.))) {
+      throw ROOT::Experimental::RException(
+         R__FAIL("value " + std::to_string(value) + " is outside the range of a single precision column"));
+   }
+   return result;
+}
+
+float Real16ToFloat(std::uint16_t value)
+{
+   std::uint32_t bits = static_cast<std::uint32_t>(value) << 16;
+   float result;
+   std::memcpy(&result, &bits, sizeof(result));
+   return result;
+}
+
+/// Maps the values in [min, max] to integers in [0, 2^nBits - 1]; values outside the range are clamped and NaNs are
+/// stored as min
+template <typename StorageT, typename CppT>
+void PackFixedPoint(void *dst, const void *src, std::size_t count, std::uint32_t nBits, double min, double max)
+{
+   R__ASSERT((nBits > 0) && (nBits <= 8 * sizeof(StorageT)) && (min < max));
+   const double nSteps = static_cast<double>((std::uint64_t(1) << nBits) - 1);
+   const double scale = nSteps / (max - min);
+   auto storageArray = reinterpret_cast<StorageT *>(dst);
+   auto typedArray = reinterpret_cast<const CppT *>(src);
+   for (std::size_t i = 0; i < count; ++i) {
+      double x = (static_cast<double>(typedArray[i]) - min) * scale;
+      if (!(x > 0.))
+         x = 0.;
+      if (x > nSteps)
+         x = nSteps;
+      storageArray[i] = static_cast<StorageT>(std::lround(x));
+   }
+}
+
+template <typename StorageT, typename CppT>
+void UnpackFixedPoint(void *dst, const void *src, std::size_t count, std::uint32_t nBits, double min, double max)
+{
+   R__ASSERT((nBits > 0) && (nBits <= 8 * sizeof(StorageT)) && (min < max));
+   const double step = (max - min) / static_cast<double>((std::uint64_t(1) << nBits) - 1);
+   auto storageArray = reinterpret_cast<const StorageT *>(src);
+   auto typedArray = reinterpret_cast<CppT *>(dst);
+   for (std::size_t i = 0; i < count; ++i)
+      typedArray[i] = static_cast<CppT>(min + storageArray[i] * step);
+}
+
+void PackReal16(void *dst, const float *src, std::size_t count)
+{
+   auto real16Array = reinterpret_cast<std::uint16_t *>(dst);
+   for (std::size_t i = 0; i < count; ++i)
+      real16Array[i] = FloatToReal16(src[i]);
+}
+
+void PackReal16(void *dst, const double *src, std::size_t count)
+{
+   auto real16Array = reinterpret_cast<std::uint16_t *>(dst);
+   for (std::size_t i = 0; i < count; ++i)
+      real16Array[i] = FloatToReal16(DoubleToFloat(src[i]));
+}
+
+template <typename CppT>
+void UnpackReal16(void *dst, const void *src, std::size_t count)
+{
+   auto real16Array = reinterpret_cast<const std::uint16_t *>(src);
+   auto typedArray = reinterpret_cast<CppT *>(dst);
+   for (std::size_t i = 0; i < count; ++i)
+      typedArray[i] = Real16ToFloat(real16Array[i]);
+}
+
+} // anonymous namespace
+
 std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
 ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
    switch (type) {
@@ -30,6 +208,10 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
       return std::make_unique<RColumnElement<float, EColumnType::kReal32>>(nullptr);
    case EColumnType::kReal64:
       return std::make_unique<RColumnElement<double, EColumnType::kReal64>>(nullptr);
+   case EColumnType::kReal16:
+      return std::make_unique<RColumnElement<float, EColumnType::kReal16>>(nullptr);
+   case EColumnType::kReal8:
+      return std::make_unique<RColumnElement<float, EColumnType::kReal8>>(nullptr);
    case EColumnType::kByte:
       return std::make_unique<RColumnElement<std::uint8_t, EColumnType::kByte>>(nullptr);
    case EColumnType::kInt16:
@@ -44,6 +226,18 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
       return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kIndex>>(nullptr);
    case EColumnType::kSwitch:
       return std::make_unique<RColumnElement<RColumnSwitch, EColumnType::kSwitch>>(nullptr);
+   case EColumnType::kSplitReal32:
+      return std::make_unique<RColumnElement<float, EColumnType::kSplitReal32>>(nullptr);
+   case EColumnType::kSplitReal64:
+      return std::make_unique<RColumnElement<double, EColumnType::kSplitReal64>>(nullptr);
+   case EColumnType::kSplitInt16:
+      return std::make_unique<RColumnElement<std::int16_t, EColumnType::kSplitInt16>>(nullptr);
+   case EColumnType::kSplitInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitInt32>>(nullptr);
+   case EColumnType::kSplitInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kSplitInt64>>(nullptr);
+   case EColumnType::kSplitIndex:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kSplitIndex>>(nullptr);
    default:
       R__ASSERT(false);
    }
@@ -51,12 +245,41 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
    return nullptr;
 }
 
+std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
+ROOT::Experimental::Detail::RColumnElementBase::Generate(const RColumnModel &model, const std::string &fieldTypeName)
+{
+   std::unique_ptr<RColumnElementBase> element;
+   if (fieldTypeName == "double") {
+      switch (model.GetType()) {
+      case EColumnType::kReal32:
+         element = std::make_unique<RColumnElement<double, EColumnType::kReal32>>(nullptr);
+         break;
+      case EColumnType::kReal16:
+         element = std::make_unique<RColumnElement<double, EColumnType::kReal16>>(nullptr);
+         break;
+      case EColumnType::kReal8:
+         element = std::make_unique<RColumnElement<double, EColumnType::kReal8>>(nullptr);
+         break;
+      default:
+         break;
+      }
+   }
+   if (!element)
+      element = Generate(model.GetType());
+   element->SetColumnModel(model);
+   return element;
+}
+
 std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(EColumnType type) {
    switch (type) {
    case EColumnType::kReal32:
       return 32;
    case EColumnType::kReal64:
       return 64;
+   case EColumnType::kReal16:
+      return 16;
+   case EColumnType::kReal8:
+      return 8;
    case EColumnType::kByte:
       return 8;
    case EColumnType::kInt16:
@@ -71,6 +294,18 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
       return 32;
    case EColumnType::kSwitch:
       return 64;
+   case EColumnType::kSplitReal32:
+      return 32;
+   case EColumnType::kSplitReal64:
+      return 64;
+   case EColumnType::kSplitInt16:
+      return 16;
+   case EColumnType::kSplitInt32:
+      return 32;
+   case EColumnType::kSplitInt64:
+      return 64;
+   case EColumnType::kSplitIndex:
+      return 32;
    default:
       R__ASSERT(false);
    }
@@ -84,6 +319,10 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
       return "Real32";
    case EColumnType::kReal64:
       return "Real64";
+   case EColumnType::kReal16:
+      return "Real16";
+   case EColumnType::kReal8:
+      return "Real8";
    case EColumnType::kByte:
       return "Byte";
    case EColumnType::kInt16:
@@ -98,6 +337,18 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
       return "Index";
    case EColumnType::kSwitch:
       return "Switch";
+   case EColumnType::kSplitReal32:
+      return "SplitReal32";
+   case EColumnType::kSplitReal64:
+      return "SplitReal64";
+   case EColumnType::kSplitInt16:
+      return "SplitInt16";
+   case EColumnType::kSplitInt32:
+      return "SplitInt32";
+   case EColumnType::kSplitInt64:
+      return "SplitInt64";
+   case EColumnType::kSplitIndex:
+      return "SplitIndex";
    default:
       return "UNKNOWN";
    }
@@ -157,3 +408,210 @@ void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental
       int64Array[i] = int32Array[i];
    }
 }
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal16>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   if (fMin < fMax)
+      PackFixedPoint<std::uint16_t, float>(dst, src, count, fNBits, fMin, fMax);
+   else
+      PackReal16(dst, reinterpret_cast<const float *>(src), count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal16>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   if (fMin < fMax)
+      UnpackFixedPoint<std::uint16_t, float>(dst, src, count, fNBits, fMin, fMax);
+   else
+      UnpackReal16<float>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal8>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackFixedPoint<std::uint8_t, float>(dst, src, count, fNBits, fMin, fMax);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal8>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackFixedPoint<std::uint8_t, float>(dst, src, count, fNBits, fMin, fMax);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   double *doubleArray = reinterpret_cast<double *>(src);
+   float *floatArray = reinterpret_cast<float *>(dst);
+   for (std::size_t i = 0; i < count; ++i) {
+      floatArray[i] = DoubleToFloat(doubleArray[i]);
+   }
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   float *floatArray = reinterpret_cast<float *>(src);
+   double *doubleArray = reinterpret_cast<double *>(dst);
+   for (std::size_t i = 0; i < count; ++i) {
+      doubleArray[i] = floatArray[i];
+   }
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal16>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   if (fMin < fMax)
+      PackFixedPoint<std::uint16_t, double>(dst, src, count, fNBits, fMin, fMax);
+   else
+      PackReal16(dst, reinterpret_cast<const double *>(src), count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal16>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   if (fMin < fMax)
+      UnpackFixedPoint<std::uint16_t, double>(dst, src, count, fNBits, fMin, fMax);
+   else
+      UnpackReal16<double>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal8>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackFixedPoint<std::uint8_t, double>(dst, src, count, fNBits, fMin, fMax);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal8>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackFixedPoint<std::uint8_t, double>(dst, src, count, fNBits, fMin, fMax);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackSplitReal<float>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackSplitReal<float>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackSplitReal<double>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackSplitReal<double>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int16_t, ROOT::Experimental::EColumnType::kSplitInt16>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackSplitInt<std::int16_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int16_t, ROOT::Experimental::EColumnType::kSplitInt16>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackSplitInt<std::int16_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint16_t, ROOT::Experimental::EColumnType::kSplitInt16>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackSplitInt<std::uint16_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint16_t, ROOT::Experimental::EColumnType::kSplitInt16>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackSplitInt<std::uint16_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackSplitInt<std::int32_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackSplitInt<std::int32_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackSplitInt<std::uint32_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackSplitInt<std::uint32_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackSplitInt<std::int64_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackSplitInt<std::int64_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackSplitInt<std::uint64_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackSplitInt<std::uint64_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+                                               ROOT::Experimental::EColumnType::kSplitIndex>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   auto splitArray = reinterpret_cast<unsigned char *>(dst);
+   auto indexArray = reinterpret_cast<const ClusterSize_t *>(src);
+   ClusterSize_t::ValueType prev = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      // The difference is computed modulo 2^32, so that decoding restores arbitrary (not only sorted) sequences
+      auto delta = static_cast<std::int32_t>(indexArray[i].fValue - prev);
+      auto encoded = ZigzagEncode(delta);
+      ByteSplit<sizeof(encoded)>(&encoded, i, count, splitArray);
+      prev = indexArray[i].fValue;
+   }
+}
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+                                               ROOT::Experimental::EColumnType::kSplitIndex>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   auto splitArray = reinterpret_cast<const unsigned char *>(src);
+   auto indexArray = reinterpret_cast<ClusterSize_t *>(dst);
+   ClusterSize_t::ValueType prev = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      std::uint32_t encoded;
+      ByteUnsplit<sizeof(encoded)>(splitArray, i, count, &encoded);
+      prev += static_cast<ClusterSize_t::ValueType>(ZigzagDecode<std::int32_t>(encoded));
+      indexArray[i].fValue = prev;
+   }
+}
@@ -32,10 +32,12 @@
 
 #include <algorithm>
 #include <cctype> // for isspace
+#include <cmath>
 #include <cstdlib> // for malloc, free
 #include <cstring> // for memset
 #include <exception>
 #include <iostream>
+#include <limits>
 #include <type_traits>
 
 namespace {
@@ -121,6 +123,70 @@ std::string GetNormalizedType(const std::string &typeName) {
    return normalizedType;
 }
 
+/// Creates the principal column of a simple field whose values can be stored either in the native or in the
+/// split column type
+template <typename CppT, ROOT::Experimental::EColumnType NativeT, ROOT::Experimental::EColumnType SplitT>
+ROOT::Experimental::Detail::RColumn *CreateSplittableColumn(ROOT::Experimental::EColumnType type)
+{
+   ROOT::Experimental::RColumnModel model(type, false /* isSorted*/);
+   if (type == SplitT)
+      return ROOT::Experimental::Detail::RColumn::Create<CppT, SplitT>(model, 0);
+   return ROOT::Experimental::Detail::RColumn::Create<CppT, NativeT>(model, 0);
+}
+
+/// Creates the principal column of a float or double field stored in one of the reduced precision column types
+template <typename CppT>
+ROOT::Experimental::Detail::RColumn *CreateReducedPrecisionColumn(const ROOT::Experimental::RColumnModel &model)
+{
+   using EColumnType = ROOT::Experimental::EColumnType;
+   switch (model.GetType()) {
+   case EColumnType::kReal16:
+      return ROOT::Experimental::Detail::RColumn::Create<CppT, EColumnType::kReal16>(model, 0);
+   case EColumnType::kReal8:
+      return ROOT::Experimental::Detail::RColumn::Create<CppT, EColumnType::kReal8>(model, 0);
+   default:
+      R__ASSERT(false);
+   }
+   return nullptr;
+}
+
+/// Rounds an IEEE 754 floating point number to nMantissaBits bits of the mantissa, ties to even.  UIntT is the
+/// unsigned integer type of the same size as RealT.
+template <typename RealT, typename UIntT>
+RealT RoundMantissa(RealT value, std::uint32_t nMantissaBits)
+{
+   constexpr std::uint32_t kNFullBits = std::numeric_limits<RealT>::digits - 1;
+   static_assert(sizeof(RealT) == sizeof(UIntT), "integer type does not match floating point type");
+   if ((nMantissaBits >= kNFullBits) || !std::isfinite(value))
+      return value;
+   UIntT bits;
+   std::memcpy(&bits, &value, sizeof(bits));
+   const std::uint32_t nDropBits = kNFullBits - nMantissaBits;
+   const UIntT half = UIntT(1) << (nDropBits - 1);
+   const UIntT mask = ~((UIntT(1) << nDropBits) - 1);
+   RealT result;
+   UIntT rounded = (bits + half - 1 + ((bits >> nDropBits) & 1)) & mask;
+   std::memcpy(&result, &rounded, sizeof(result));
+   // Values close to the largest finite number are truncated rather than rounded up to infinity
+   if (std::isinf(result)) {
+      rounded = bits & mask;
+      std::memcpy(&result, &rounded, sizeof(result));
+   }
+   return result;
+}
+
+/// Checks the arguments of RField<float|double>::SetQuantization()
+void EnsureValidQuantization(double min, double max, std::uint32_t nBits, const std::string &fieldName)
+{
+   if ((nBits < 1) || (nBits > 16)) {
+      throw ROOT::Experimental::RException(R__FAIL("invalid number of fixed-point bits for field `" + fieldName +
+                                                   "`: " + std::to_string(nBits) + ", expected 1 to 16"));
+   }
+   if (!std::isfinite(min) || !std::isfinite(max) || !(min < max)) {
+      throw ROOT::Experimental::RException(R__FAIL("invalid fixed-point value range for field `" + fieldName + "`"));
+   }
+}
+
 } // anonymous namespace
 
 
@@ -238,11 +304,13 @@ ROOT::Experimental::Detail::RFieldBase::Clone(std::string_view newName) const
    auto clone = CloneImpl(newName);
    clone->fOnDiskId = fOnDiskId;
    clone->fDescription = fDescription;
+   clone->fColumnRepresentative = fColumnRepresentative;
    return clone;
 }
 
-void ROOT::Experimental::Detail::RFieldBase::AppendImpl(const ROOT::Experimental::Detail::RFieldValue& /*value*/) {
+std::size_t ROOT::Experimental::Detail::RFieldBase::AppendImpl(const ROOT::Experimental::Detail::RFieldValue& /*value*/) {
    R__ASSERT(false);
+   return 0;
 }
 
 void ROOT::Experimental::Detail::RFieldBase::ReadGlobalImpl(
@@ -252,6 +320,30 @@ void ROOT::Experimental::Detail::RFieldBase::ReadGlobalImpl(
    R__ASSERT(false);
 }
 
+void ROOT::Experimental::Detail::RFieldBase::ReadBulk(NTupleSize_t globalIndex, NTupleSize_t count, void *to)
+{
+   if (count == 0)
+      return;
+   if (fIsSimple) {
+      RColumnElementBase elemArray(to, GetValueSize());
+      fPrincipalColumn->ReadV(globalIndex, count, &elemArray);
+      return;
+   }
+   for (NTupleSize_t i = 0; i < count; ++i) {
+      auto value = CaptureValue(static_cast<unsigned char *>(to) + i * GetValueSize());
+      Read(globalIndex + i, &value);
+   }
+}
+
+void *ROOT::Experimental::Detail::RFieldBase::MapBulk(NTupleSize_t globalIndex, NTupleSize_t &nItems)
+{
+   if (!fIsSimple) {
+      nItems = 0;
+      return nullptr;
+   }
+   return fPrincipalColumn->MapRawV(globalIndex, nItems);
+}
+
 ROOT::Experimental::Detail::RFieldValue ROOT::Experimental::Detail::RFieldBase::GenerateValue()
 {
    void *where = malloc(GetValueSize());
@@ -330,6 +422,44 @@ ROOT::Experimental::EColumnType ROOT::Experimental::Detail::RFieldBase::EnsureCo
 }
 
 
+ROOT::Experimental::EColumnType ROOT::Experimental::Detail::RFieldBase::EnsureColumnRepresentative(
+   const std::vector<EColumnType> &supportedTypes, unsigned int columnIndex) const
+{
+   R__ASSERT(!supportedTypes.empty());
+   if (fColumnRepresentative.empty())
+      return supportedTypes[0];
+   if (columnIndex >= fColumnRepresentative.size()) {
+      throw RException(R__FAIL("Column representative of field `" + fName + "` misses column #" +
+                               std::to_string(columnIndex)));
+   }
+
+   auto type = fColumnRepresentative[columnIndex];
+   if (std::find(supportedTypes.begin(), supportedTypes.end(), type) == supportedTypes.end()) {
+      throw RException(R__FAIL("Column type `" + RColumnElementBase::GetTypeName(type) + "` of column #" +
+                               std::to_string(columnIndex) + " is not supported by field `" + fName + "`"));
+   }
+   return type;
+}
+
+
+ROOT::Experimental::Detail::RColumn *
+ROOT::Experimental::Detail::RFieldBase::CreateIndexColumn(EColumnType type, std::uint32_t columnIndex)
+{
+   RColumnModel model(type, true /* isSorted*/);
+   if (type == EColumnType::kSplitIndex)
+      return RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex>(model, columnIndex);
+   return RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, columnIndex);
+}
+
+
+void ROOT::Experimental::Detail::RFieldBase::SetColumnRepresentative(const std::vector<EColumnType> &representative)
+{
+   if (!fColumns.empty())
+      throw RException(R__FAIL("cannot set the column representative of the connected field `" + fName + "`"));
+   fColumnRepresentative = representative;
+}
+
+
 void ROOT::Experimental::Detail::RFieldBase::ConnectPageSink(RPageSink &pageSink)
 {
    R__ASSERT(fColumns.empty());
@@ -430,15 +560,14 @@ void ROOT::Experimental::RFieldZero::AcceptVisitor(Detail::RFieldVisitor &visito
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+   auto type = EnsureColumnRepresentative({EColumnType::kIndex, EColumnType::kSplitIndex}, 0);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateIndexColumn(type, 0)));
 }
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex}, 0, desc);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateIndexColumn(type, 0)));
 }
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -450,7 +579,7 @@ void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::AcceptVisito
 
 void ROOT::Experimental::RField<char>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kByte, false /* isSorted*/);
+   RColumnModel model(EnsureColumnRepresentative({EColumnType::kByte}, 0), false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
       char, EColumnType::kByte>(model, 0)));
 }
@@ -470,7 +599,7 @@ void ROOT::Experimental::RField<char>::AcceptVisitor(Detail::RFieldVisitor &visi
 
 void ROOT::Experimental::RField<std::int8_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kByte, false /* isSorted*/);
+   RColumnModel model(EnsureColumnRepresentative({EColumnType::kByte}, 0), false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
       std::int8_t, EColumnType::kByte>(model, 0)));
 }
@@ -490,7 +619,7 @@ void ROOT::Experimental::RField<std::int8_t>::AcceptVisitor(Detail::RFieldVisito
 
 void ROOT::Experimental::RField<std::uint8_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kByte, false /* isSorted*/);
+   RColumnModel model(EnsureColumnRepresentative({EColumnType::kByte}, 0), false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
       std::uint8_t, EColumnType::kByte>(model, 0)));
 }
@@ -511,7 +640,7 @@ void ROOT::Experimental::RField<std::uint8_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<bool>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kBit, false /* isSorted*/);
+   RColumnModel model(EnsureColumnRepresentative({EColumnType::kBit}, 0), false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
       Detail::RColumn::Create<bool, EColumnType::kBit>(model, 0)));
 }
@@ -530,17 +659,81 @@ void ROOT::Experimental::RField<bool>::AcceptVisitor(Detail::RFieldVisitor &visi
 //------------------------------------------------------------------------------
 
 
+std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+ROOT::Experimental::RField<float>::CloneImpl(std::string_view newName) const
+{
+   auto result = std::make_unique<RField>(newName);
+   result->fNMantissaBits = fNMantissaBits;
+   result->fQuantNBits = fQuantNBits;
+   result->fQuantMin = fQuantMin;
+   result->fQuantMax = fQuantMax;
+   return result;
+}
+
+void ROOT::Experimental::RField<float>::SetTruncation(std::uint32_t nMantissaBits)
+{
+   if ((nMantissaBits < 1) || (nMantissaBits > 23)) {
+      throw RException(R__FAIL("invalid number of mantissa bits for field `" + GetName() + "`: " +
+                               std::to_string(nMantissaBits) + ", expected 1 to 23"));
+   }
+   fNMantissaBits = nMantissaBits;
+   fQuantNBits = 0;
+   fQuantMin = fQuantMax = 0.;
+   SetColumnRepresentative({(nMantissaBits <= 7) ? EColumnType::kReal16 : EColumnType::kReal32});
+}
+
+void ROOT::Experimental::RField<float>::SetQuantization(double min, double max, std::uint32_t nBits)
+{
+   EnsureValidQuantization(min, max, nBits, GetName());
+   fNMantissaBits = 23;
+   fQuantNBits = nBits;
+   fQuantMin = min;
+   fQuantMax = max;
+   SetColumnRepresentative({(nBits <= 8) ? EColumnType::kReal8 : EColumnType::kReal16});
+}
+
+std::size_t ROOT::Experimental::RField<float>::AppendImpl(const Detail::RFieldValue &value)
+{
+   auto rounded = RoundMantissa<float, std::uint32_t>(*value.Get<float>(), fNMantissaBits);
+   Detail::RColumnElement<float> element(&rounded);
+   fPrincipalColumn->Append(element);
+   return sizeof(float);
+}
+
+void ROOT::Experimental::RField<float>::ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value)
+{
+   *value->Get<float>() = *fPrincipalColumn->Map<float>(globalIndex);
+}
+
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kReal32, false /* isSorted*/);
+   auto type = EnsureColumnRepresentative(
+      {EColumnType::kReal32, EColumnType::kSplitReal32, EColumnType::kReal16, EColumnType::kReal8}, 0);
+   // Only the writer rounds the values; reading is a plain copy
+   fIsSimple = (fNMantissaBits == 23);
+   if ((type == EColumnType::kReal16) || (type == EColumnType::kReal8)) {
+      RColumnModel model(type, false /* isSorted */, fQuantNBits, fQuantMin, fQuantMax);
+      if ((type == EColumnType::kReal8) && !model.HasValueRange())
+         throw RException(R__FAIL("field `" + GetName() + "` requires SetQuantization() for 8 bit storage"));
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateReducedPrecisionColumn<float>(model)));
+      return;
+   }
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<float, EColumnType::kReal32>(model, 0)));
+      CreateSplittableColumn<float, EColumnType::kReal32, EColumnType::kSplitReal32>(type)));
 }
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kReal32}, 0, desc);
-   GenerateColumnsImpl();
+   auto type =
+      EnsureColumnType({EColumnType::kReal32, EColumnType::kSplitReal32, EColumnType::kReal16, EColumnType::kReal8},
+                       0, desc);
+   if ((type == EColumnType::kReal16) || (type == EColumnType::kReal8)) {
+      const auto &model = desc.GetColumnDescriptor(desc.FindColumnId(GetOnDiskId(), 0)).GetModel();
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateReducedPrecisionColumn<float>(model)));
+      return;
+   }
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      CreateSplittableColumn<float, EColumnType::kReal32, EColumnType::kSplitReal32>(type)));
 }
 
 void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -551,17 +744,94 @@ void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &vis
 
 //------------------------------------------------------------------------------
 
+std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+ROOT::Experimental::RField<double>::CloneImpl(std::string_view newName) const
+{
+   auto result = std::make_unique<RField>(newName);
+   result->fNMantissaBits = fNMantissaBits;
+   result->fQuantNBits = fQuantNBits;
+   result->fQuantMin = fQuantMin;
+   result->fQuantMax = fQuantMax;
+   return result;
+}
+
+void ROOT::Experimental::RField<double>::SetTruncation(std::uint32_t nMantissaBits)
+{
+   if ((nMantissaBits < 1) || (nMantissaBits > 52)) {
+      throw RException(R__FAIL("invalid number of mantissa bits for field `" + GetName() + "`: " +
+                               std::to_string(nMantissaBits) + ", expected 1 to 52"));
+   }
+   fNMantissaBits = nMantissaBits;
+   fQuantNBits = 0;
+   fQuantMin = fQuantMax = 0.;
+   // Narrower column types would also reduce the exponent range
+   SetColumnRepresentative({EColumnType::kReal64});
+}
+
+void ROOT::Experimental::RField<double>::SetQuantization(double min, double max, std::uint32_t nBits)
+{
+   EnsureValidQuantization(min, max, nBits, GetName());
+   fNMantissaBits = 52;
+   fQuantNBits = nBits;
+   fQuantMin = min;
+   fQuantMax = max;
+   SetColumnRepresentative({(nBits <= 8) ? EColumnType::kReal8 : EColumnType::kReal16});
+}
+
+std::size_t ROOT::Experimental::RField<double>::AppendImpl(const Detail::RFieldValue &value)
+{
+   auto rounded = RoundMantissa<double, std::uint64_t>(*value.Get<double>(), fNMantissaBits);
+   Detail::RColumnElement<double> element(&rounded);
+   fPrincipalColumn->Append(element);
+   return sizeof(double);
+}
+
+void ROOT::Experimental::RField<double>::ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value)
+{
+   *value->Get<double>() = *fPrincipalColumn->Map<double>(globalIndex);
+}
+
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kReal64, false /* isSorted*/);
+   auto type = EnsureColumnRepresentative({EColumnType::kReal64, EColumnType::kSplitReal64, EColumnType::kReal32,
+                                           EColumnType::kReal16, EColumnType::kReal8},
+                                          0);
+   // Only the writer rounds the values; reading is a plain copy
+   fIsSimple = (fNMantissaBits == 52);
+   if ((type == EColumnType::kReal16) || (type == EColumnType::kReal8)) {
+      RColumnModel model(type, false /* isSorted */, fQuantNBits, fQuantMin, fQuantMax);
+      if ((type == EColumnType::kReal8) && !model.HasValueRange())
+         throw RException(R__FAIL("field `" + GetName() + "` requires SetQuantization() for 8 bit storage"));
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateReducedPrecisionColumn<double>(model)));
+      return;
+   }
+   if (type == EColumnType::kReal32) {
+      RColumnModel model(type, false /* isSorted */);
+      fColumns.emplace_back(
+         std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<double, EColumnType::kReal32>(model, 0)));
+      return;
+   }
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<double, EColumnType::kReal64>(model, 0)));
+      CreateSplittableColumn<double, EColumnType::kReal64, EColumnType::kSplitReal64>(type)));
 }
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kReal64}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kReal64, EColumnType::kSplitReal64, EColumnType::kReal32,
+                                 EColumnType::kReal16, EColumnType::kReal8},
+                                0, desc);
+   const auto &model = desc.GetColumnDescriptor(desc.FindColumnId(GetOnDiskId(), 0)).GetModel();
+   if ((type == EColumnType::kReal16) || (type == EColumnType::kReal8)) {
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateReducedPrecisionColumn<double>(model)));
+      return;
+   }
+   if (type == EColumnType::kReal32) {
+      fColumns.emplace_back(
+         std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<double, EColumnType::kReal32>(model, 0)));
+      return;
+   }
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      CreateSplittableColumn<double, EColumnType::kReal64, EColumnType::kSplitReal64>(type)));
 }
 
 void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -573,15 +843,16 @@ void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &vi
 
 void ROOT::Experimental::RField<std::int16_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt16, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::int16_t, EColumnType::kInt16>(model, 0)));
+   auto type = EnsureColumnRepresentative({EColumnType::kInt16, EColumnType::kSplitInt16}, 0);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      CreateSplittableColumn<std::int16_t, EColumnType::kInt16, EColumnType::kSplitInt16>(type)));
 }
 
 void ROOT::Experimental::RField<std::int16_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt16}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kInt16, EColumnType::kSplitInt16}, 0, desc);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      CreateSplittableColumn<std::int16_t, EColumnType::kInt16, EColumnType::kSplitInt16>(type)));
 }
 
 void ROOT::Experimental::RField<std::int16_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -593,15 +864,16 @@ void ROOT::Experimental::RField<std::int16_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::uint16_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt16, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::uint16_t, EColumnType::kInt16>(model, 0)));
+   auto type = EnsureColumnRepresentative({EColumnType::kInt16, EColumnType::kSplitInt16}, 0);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      CreateSplittableColumn<std::uint16_t, EColumnType::kInt16, EColumnType::kSplitInt16>(type)));
 }
 
 void ROOT::Experimental::RField<std::uint16_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt16}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kInt16, EColumnType::kSplitInt16}, 0, desc);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      CreateSplittableColumn<std::uint16_t, EColumnType::kInt16, EColumnType::kSplitInt16>(type)));
 }
 
 void ROOT::Experimental::RField<std::uint16_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -613,15 +885,16 @@ void ROOT::Experimental::RField<std::uint16_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::int32_t, EColumnType::kInt32>(model, 0)));
+   auto type = EnsureColumnRepresentative({EColumnType::kInt32, EColumnType::kSplitInt32}, 0);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      CreateSplittableColumn<std::int32_t, EColumnType::kInt32, EColumnType::kSplitInt32>(type)));
 }
 
 void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt32}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kInt32, EColumnType::kSplitInt32}, 0, desc);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      CreateSplittableColumn<std::int32_t, EColumnType::kInt32, EColumnType::kSplitInt32>(type)));
 }
 
 void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -633,15 +906,16 @@ void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
+   auto type = EnsureColumnRepresentative({EColumnType::kInt32, EColumnType::kSplitInt32}, 0);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::uint32_t, EColumnType::kInt32>(model, 0)));
+      CreateSplittableColumn<std::uint32_t, EColumnType::kInt32, EColumnType::kSplitInt32>(type)));
 }
 
 void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt32}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kInt32, EColumnType::kSplitInt32}, 0, desc);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      CreateSplittableColumn<std::uint32_t, EColumnType::kInt32, EColumnType::kSplitInt32>(type)));
 }
 
 void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -653,15 +927,16 @@ void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt64, false /* isSorted*/);
+   auto type = EnsureColumnRepresentative({EColumnType::kInt64, EColumnType::kSplitInt64}, 0);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::uint64_t, EColumnType::kInt64>(model, 0)));
+      CreateSplittableColumn<std::uint64_t, EColumnType::kInt64, EColumnType::kSplitInt64>(type)));
 }
 
 void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt64}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kInt64, EColumnType::kSplitInt64}, 0, desc);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      CreateSplittableColumn<std::uint64_t, EColumnType::kInt64, EColumnType::kSplitInt64>(type)));
 }
 
 void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -673,21 +948,21 @@ void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::int64_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt64, false /* isSorted*/);
+   auto type = EnsureColumnRepresentative({EColumnType::kInt64, EColumnType::kSplitInt64}, 0);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::int64_t, EColumnType::kInt64>(model, 0)));
+      CreateSplittableColumn<std::int64_t, EColumnType::kInt64, EColumnType::kSplitInt64>(type)));
 }
 
 void ROOT::Experimental::RField<std::int64_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   auto type = EnsureColumnType({EColumnType::kInt64, EColumnType::kInt32}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kInt64, EColumnType::kSplitInt64, EColumnType::kInt32}, 0, desc);
    RColumnModel model(type, false /* isSorted*/);
-   if (type == EColumnType::kInt64) {
+   if (type == EColumnType::kInt32) {
       fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-         Detail::RColumn::Create<std::int64_t, EColumnType::kInt64>(model, 0)));
+         Detail::RColumn::Create<std::int64_t, EColumnType::kInt32>(model, 0)));
    } else {
       fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-         Detail::RColumn::Create<std::int64_t, EColumnType::kInt32>(model, 0)));
+         CreateSplittableColumn<std::int64_t, EColumnType::kInt64, EColumnType::kSplitInt64>(type)));
    }
 }
 
@@ -700,23 +975,26 @@ void ROOT::Experimental::RField<std::int64_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   auto indexType = EnsureColumnRepresentative({EColumnType::kIndex, EColumnType::kSplitIndex}, 0);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateIndexColumn(indexType, 0)));
 
-   RColumnModel modelChars(EColumnType::kByte, false /* isSorted*/);
+   RColumnModel modelChars(EnsureColumnRepresentative({EColumnType::kByte}, 1), false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
       Detail::RColumn::Create<char, EColumnType::kByte>(modelChars, 1)));
 }
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   auto indexType = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex}, 0, desc);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateIndexColumn(indexType, 0)));
+
    EnsureColumnType({EColumnType::kByte}, 1, desc);
-   GenerateColumnsImpl();
+   RColumnModel modelChars(EColumnType::kByte, false /* isSorted*/);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      Detail::RColumn::Create<char, EColumnType::kByte>(modelChars, 1)));
 }
 
-void ROOT::Experimental::RField<std::string>::AppendImpl(const ROOT::Experimental::Detail::RFieldValue& value)
+std::size_t ROOT::Experimental::RField<std::string>::AppendImpl(const ROOT::Experimental::Detail::RFieldValue& value)
 {
    auto typedValue = value.Get<std::string>();
    auto length = typedValue->length();
@@ -724,6 +1002,7 @@ void ROOT::Experimental::RField<std::string>::AppendImpl(const ROOT::Experimenta
    fColumns[1]->AppendV(elemChars, length);
    fIndex += length;
    fColumns[0]->Append(fElemIndex);
+   return length + fElemIndex.GetSize();
 }
 
 void ROOT::Experimental::RField<std::string>::ReadGlobalImpl(
@@ -781,14 +1060,16 @@ ROOT::Experimental::RClassField::CloneImpl(std::string_view newName) const
    return std::make_unique<RClassField>(newName, GetType());
 }
 
-void ROOT::Experimental::RClassField::AppendImpl(const Detail::RFieldValue& value) {
+std::size_t ROOT::Experimental::RClassField::AppendImpl(const Detail::RFieldValue& value) {
    TIter next(fClass->GetListOfDataMembers());
    unsigned i = 0;
+   std::size_t nbytes = 0;
    while (auto dataMember = static_cast<TDataMember *>(next())) {
       auto memberValue = fSubFields[i]->CaptureValue(value.Get<unsigned char>() + dataMember->GetOffset());
-      fSubFields[i]->Append(memberValue);
+      nbytes += fSubFields[i]->Append(memberValue);
       i++;
    }
+   return nbytes;
 }
 
 void ROOT::Experimental::RClassField::ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value)
@@ -897,13 +1178,15 @@ ROOT::Experimental::RRecordField::CloneImpl(std::string_view newName) const
    return std::make_unique<RRecordField>(newName, cloneItems);
 }
 
-void ROOT::Experimental::RRecordField::AppendImpl(const Detail::RFieldValue &value) {
+std::size_t ROOT::Experimental::RRecordField::AppendImpl(const Detail::RFieldValue &value) {
+   std::size_t nbytes = 0;
    std::size_t offset = 0;
    for (auto &item : fSubFields) {
       auto memberValue = item->CaptureValue(value.Get<unsigned char>() + offset);
-      item->Append(memberValue);
+      nbytes += item->Append(memberValue);
       offset +=  GetItemPadding(offset, item->GetAlignment()) + item->GetValueSize();
    }
+   return nbytes;
 }
 
 void ROOT::Experimental::RRecordField::ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value)
@@ -992,17 +1275,19 @@ ROOT::Experimental::RVectorField::CloneImpl(std::string_view newName) const
    return std::make_unique<RVectorField>(newName, std::move(newItemField));
 }
 
-void ROOT::Experimental::RVectorField::AppendImpl(const Detail::RFieldValue& value) {
+std::size_t ROOT::Experimental::RVectorField::AppendImpl(const Detail::RFieldValue& value) {
    auto typedValue = value.Get<std::vector<char>>();
    R__ASSERT((typedValue->size() % fItemSize) == 0);
    auto count = typedValue->size() / fItemSize;
+   std::size_t nbytes = 0;
    for (unsigned i = 0; i < count; ++i) {
       auto itemValue = fSubFields[0]->CaptureValue(typedValue->data() + (i * fItemSize));
-      fSubFields[0]->Append(itemValue);
+      nbytes += fSubFields[0]->Append(itemValue);
    }
    Detail::RColumnElement<ClusterSize_t> elemIndex(&fNWritten);
    fNWritten += count;
    fColumns[0]->Append(elemIndex);
+   return nbytes + elemIndex.GetSize();
 }
 
 void ROOT::Experimental::RVectorField::ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value)
@@ -1022,15 +1307,14 @@ void ROOT::Experimental::RVectorField::ReadGlobalImpl(NTupleSize_t globalIndex,
 
 void ROOT::Experimental::RVectorField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   auto type = EnsureColumnRepresentative({EColumnType::kIndex, EColumnType::kSplitIndex}, 0);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateIndexColumn(type, 0)));
 }
 
 void ROOT::Experimental::RVectorField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex}, 0, desc);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateIndexColumn(type, 0)));
 }
 
 ROOT::Experimental::Detail::RFieldValue ROOT::Experimental::RVectorField::GenerateValue(void* where)
@@ -1091,7 +1375,7 @@ ROOT::Experimental::RField<std::vector<bool>>::RField(std::string_view name)
    Attach(std::make_unique<RField<bool>>("bool"));
 }
 
-void ROOT::Experimental::RField<std::vector<bool>>::AppendImpl(const Detail::RFieldValue& value) {
+std::size_t ROOT::Experimental::RField<std::vector<bool>>::AppendImpl(const Detail::RFieldValue& value) {
    auto typedValue = value.Get<std::vector<bool>>();
    auto count = typedValue->size();
    for (unsigned i = 0; i < count; ++i) {
@@ -1102,6 +1386,7 @@ void ROOT::Experimental::RField<std::vector<bool>>::AppendImpl(const Detail::RFi
    Detail::RColumnElement<ClusterSize_t> elemIndex(&fNWritten);
    fNWritten += count;
    fColumns[0]->Append(elemIndex);
+   return count + elemIndex.GetSize();
 }
 
 void ROOT::Experimental::RField<std::vector<bool>>::ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue* value)
@@ -1123,15 +1408,14 @@ void ROOT::Experimental::RField<std::vector<bool>>::ReadGlobalImpl(NTupleSize_t
 
 void ROOT::Experimental::RField<std::vector<bool>>::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   auto type = EnsureColumnRepresentative({EColumnType::kIndex, EColumnType::kSplitIndex}, 0);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateIndexColumn(type, 0)));
 }
 
 void ROOT::Experimental::RField<std::vector<bool>>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex}, 0, desc);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateIndexColumn(type, 0)));
 }
 
 std::vector<ROOT::Experimental::Detail::RFieldValue>
@@ -1187,12 +1471,14 @@ ROOT::Experimental::RArrayField::CloneImpl(std::string_view newName) const
    return std::make_unique<RArrayField>(newName, std::move(newItemField), fArrayLength);
 }
 
-void ROOT::Experimental::RArrayField::AppendImpl(const Detail::RFieldValue& value) {
+std::size_t ROOT::Experimental::RArrayField::AppendImpl(const Detail::RFieldValue& value) {
    auto arrayPtr = value.Get<unsigned char>();
+   std::size_t nbytes = 0;
    for (unsigned i = 0; i < fArrayLength; ++i) {
       auto itemValue = fSubFields[0]->CaptureValue(arrayPtr + (i * fItemSize));
-      fSubFields[0]->Append(itemValue);
+      nbytes += fSubFields[0]->Append(itemValue);
    }
+   return nbytes;
 }
 
 void ROOT::Experimental::RArrayField::ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value)
@@ -1318,18 +1604,20 @@ void ROOT::Experimental::RVariantField::SetTag(void *variantPtr, std::uint32_t t
    *index = static_cast<char>(tag - 1);
 }
 
-void ROOT::Experimental::RVariantField::AppendImpl(const Detail::RFieldValue& value)
+std::size_t ROOT::Experimental::RVariantField::AppendImpl(const Detail::RFieldValue& value)
 {
    auto tag = GetTag(value.GetRawPtr());
    auto index = 0;
+   std::size_t nbytes = 0;
    if (tag > 0) {
       auto itemValue = fSubFields[tag - 1]->CaptureValue(value.GetRawPtr());
-      fSubFields[tag - 1]->Append(itemValue);
+      nbytes += fSubFields[tag - 1]->Append(itemValue);
       index = fNWritten[tag - 1]++;
    }
    RColumnSwitch varSwitch(ClusterSize_t(index), tag);
    Detail::RColumnElement<RColumnSwitch> elemSwitch(&varSwitch);
    fColumns[0]->Append(elemSwitch);
+   return nbytes + elemSwitch.GetSize();
 }
 
 void ROOT::Experimental::RVariantField::ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value)
@@ -1346,7 +1634,7 @@ void ROOT::Experimental::RVariantField::ReadGlobalImpl(NTupleSize_t globalIndex,
 
 void ROOT::Experimental::RVariantField::GenerateColumnsImpl()
 {
-   RColumnModel modelSwitch(EColumnType::kSwitch, false);
+   RColumnModel modelSwitch(EnsureColumnRepresentative({EColumnType::kSwitch}, 0), false);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
       Detail::RColumn::Create<RColumnSwitch, EColumnType::kSwitch>(modelSwitch, 0)));
 }
@@ -1414,15 +1702,14 @@ ROOT::Experimental::RCollectionField::RCollectionField(
 
 void ROOT::Experimental::RCollectionField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   auto type = EnsureColumnRepresentative({EColumnType::kIndex, EColumnType::kSplitIndex}, 0);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateIndexColumn(type, 0)));
 }
 
 void ROOT::Experimental::RCollectionField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex}, 0, desc);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(CreateIndexColumn(type, 0)));
 }
 
 
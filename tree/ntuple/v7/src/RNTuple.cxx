@@ -286,6 +286,8 @@ ROOT::Experimental::RNTupleWriter::RNTupleWriter(
    if (!fSink) {
       throw RException(R__FAIL("null sink"));
    }
+   // Before the first cluster is written, we assume a compression factor of one
+   fUnzippedClusterSizeEst = Detail::RPageSink::EstimateUnzippedClusterSize(fSink->GetWriteOptions(), 0, 0);
 #ifdef R__USE_IMT
    if (IsImplicitMTEnabled()) {
       fZipTasks = std::make_unique<RNTupleImtTaskScheduler>();
@@ -333,7 +335,10 @@ void ROOT::Experimental::RNTupleWriter::CommitCluster()
       field.Flush();
       field.CommitCluster();
    }
-   fSink->CommitCluster(fNEntries);
+   auto nbytesZipped = fSink->CommitCluster(fNEntries);
+   fUnzippedClusterSizeEst =
+      Detail::RPageSink::EstimateUnzippedClusterSize(fSink->GetWriteOptions(), fUnzippedClusterSize, nbytesZipped);
+   fUnzippedClusterSize = 0;
    fLastCommitted = fNEntries;
 }
 
@@ -198,6 +198,23 @@ std::uint32_t DeserializeUuid(const void *buffer, ROOT::Experimental::RNTupleUui
    return frameSize;
 }
 
+std::uint32_t SerializeDouble(double val, void *buffer)
+{
+   // Assumes IEEE 754 doubles; the bit pattern is stored like an unsigned 64bit integer
+   std::uint64_t bits;
+   static_assert(sizeof(bits) == sizeof(val), "unsupported double precision floating point type");
+   std::memcpy(&bits, &val, sizeof(bits));
+   return SerializeUInt64(bits, buffer);
+}
+
+std::uint32_t DeserializeDouble(const void *buffer, double *val)
+{
+   std::uint64_t bits;
+   auto nbytes = DeserializeUInt64(buffer, &bits);
+   std::memcpy(val, &bits, sizeof(bits));
+   return nbytes;
+}
+
 std::uint32_t SerializeColumnModel(const ROOT::Experimental::RColumnModel &val, void *buffer)
 {
    auto base = reinterpret_cast<unsigned char *>((buffer != nullptr) ? buffer : 0);
@@ -209,6 +226,10 @@ std::uint32_t SerializeColumnModel(const ROOT::Experimental::RColumnModel &val,
 
    pos += SerializeInt32(static_cast<int>(val.GetType()), *where);
    pos += SerializeInt32(static_cast<int>(val.GetIsSorted()), *where);
+   // Added after the first version of the frame; older readers skip it
+   pos += SerializeUInt32(val.GetNBits(), *where);
+   pos += SerializeDouble(val.GetMin(), *where);
+   pos += SerializeDouble(val.GetMax(), *where);
 
    auto size = pos - base;
    SerializeUInt32(size, ptrSize);
@@ -217,7 +238,8 @@ std::uint32_t SerializeColumnModel(const ROOT::Experimental::RColumnModel &val,
 
 std::uint32_t DeserializeColumnModel(const void *buffer, ROOT::Experimental::RColumnModel *columnModel)
 {
-   auto bytes = reinterpret_cast<const unsigned char *>(buffer);
+   auto base = reinterpret_cast<const unsigned char *>(buffer);
+   auto bytes = base;
    std::uint32_t frameSize;
    bytes += DeserializeFrame(0, bytes, &frameSize);
 
@@ -225,7 +247,16 @@ std::uint32_t DeserializeColumnModel(const void *buffer, ROOT::Experimental::RCo
    std::int32_t isSorted;
    bytes += DeserializeInt32(bytes, &type);
    bytes += DeserializeInt32(bytes, &isSorted);
-   *columnModel = ROOT::Experimental::RColumnModel(static_cast<ROOT::Experimental::EColumnType>(type), isSorted);
+   std::uint32_t nBits = 0;
+   double min = 0.;
+   double max = 0.;
+   if (bytes < base + frameSize) {
+      bytes += DeserializeUInt32(bytes, &nBits);
+      bytes += DeserializeDouble(bytes, &min);
+      bytes += DeserializeDouble(bytes, &max);
+   }
+   *columnModel =
+      ROOT::Experimental::RColumnModel(static_cast<ROOT::Experimental::EColumnType>(type), isSorted, nBits, min, max);
 
    return frameSize;
 }
@@ -290,6 +321,33 @@ std::uint32_t DeserializePageInfo(const void *buffer,
    return bytes - base;
 }
 
+std::uint32_t SerializeColumnStatistics(const ROOT::Experimental::RClusterDescriptor::RColumnStatistics &val,
+                                        void *buffer)
+{
+   // Only valid statistics are stored; the column id is part of the statistics because, unlike column ranges,
+   // statistics are not available for all the columns
+   if (buffer != nullptr) {
+      auto pos = reinterpret_cast<unsigned char *>(buffer);
+      pos += SerializeUInt64(val.fColumnId, pos);
+      pos += SerializeDouble(val.fMin, pos);
+      pos += SerializeDouble(val.fMax, pos);
+   }
+   return 24;
+}
+
+std::uint32_t DeserializeColumnStatistics(const void *buffer,
+   ROOT::Experimental::RClusterDescriptor::RColumnStatistics *stats)
+{
+   auto bytes = reinterpret_cast<const unsigned char *>(buffer);
+   std::uint64_t columnId;
+   bytes += DeserializeUInt64(bytes, &columnId);
+   stats->fColumnId = columnId;
+   bytes += DeserializeDouble(bytes, &stats->fMin);
+   bytes += DeserializeDouble(bytes, &stats->fMax);
+   stats->fIsValid = true;
+   return 24;
+}
+
 std::uint32_t SerializeCrc32(const unsigned char *data, std::uint32_t length, void *buffer)
 {
    auto checksum = R__crc32(0, nullptr, 0);
@@ -373,6 +431,17 @@ std::uint32_t SerializeClusterSummary(const ROOT::Experimental::RClusterDescript
    pos += SerializeUInt64(val.GetFirstEntryIndex(), *where);
    pos += SerializeUInt64(val.GetNEntries(), *where);
    pos += SerializeLocator(val.GetLocator(), *where);
+   // Appended to the cluster summary so that readers unaware of the statistics skip them with the rest of the frame
+   const auto columnIds = val.GetColumnIds();
+   std::vector<ROOT::Experimental::DescriptorId_t> statsIds;
+   for (auto columnId : columnIds) {
+      if (val.HasColumnStatistics(columnId))
+         statsIds.emplace_back(columnId);
+   }
+   std::sort(statsIds.begin(), statsIds.end());
+   pos += SerializeUInt32(statsIds.size(), *where);
+   for (auto columnId : statsIds)
+      pos += SerializeColumnStatistics(val.GetColumnStatistics(columnId), *where);
 
    auto size = pos - base;
    SerializeUInt32(size, ptrSize);
@@ -486,7 +555,8 @@ bool ROOT::Experimental::RClusterDescriptor::operator==(const RClusterDescriptor
           fNEntries == other.fNEntries &&
           fLocator == other.fLocator &&
           fColumnRanges == other.fColumnRanges &&
-          fPageRanges == other.fPageRanges;
+          fPageRanges == other.fPageRanges &&
+          fColumnStatistics == other.fColumnStatistics;
 }
 
 
@@ -882,6 +952,16 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
       RClusterDescriptor::RLocator locator;
       pos += DeserializeLocator(pos, &locator);
       SetClusterLocator(clusterId, locator);
+      // Footers written before the introduction of column statistics end the cluster summary after the locator
+      if (pos < clusterBase + frameSize) {
+         std::uint32_t nStats;
+         pos += DeserializeUInt32(pos, &nStats);
+         for (std::uint32_t j = 0; j < nStats; ++j) {
+            RClusterDescriptor::RColumnStatistics stats;
+            pos += DeserializeColumnStatistics(pos, &stats);
+            AddClusterColumnStatistics(clusterId, stats);
+         }
+      }
 
       pos = clusterBase + frameSize;
 
@@ -1032,6 +1112,12 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClusterPageRange(
    fDescriptor.fClusterDescriptors[clusterId].fPageRanges.emplace(pageRange.fColumnId, std::move(pageRange));
 }
 
+void ROOT::Experimental::RNTupleDescriptorBuilder::AddClusterColumnStatistics(
+   DescriptorId_t clusterId, const RClusterDescriptor::RColumnStatistics &stats)
+{
+   fDescriptor.fClusterDescriptors[clusterId].fColumnStatistics[stats.fColumnId] = stats;
+}
+
 void ROOT::Experimental::RNTupleDescriptorBuilder::Reset()
 {
    fDescriptor.fName = "";
@@ -13,17 +13,167 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RError.hxx>
+#include <ROOT/RField.hxx>
 #include <ROOT/RMiniFile.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RPageStorageFile.hxx>
+
+#include <TCollection.h>
+#include <TError.h>
+#include <TFile.h>
+#include <TFileMergeInfo.h>
+
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using DescriptorId_t = ROOT::Experimental::DescriptorId_t;
+using RCluster = ROOT::Experimental::Detail::RCluster;
+using RNTupleDescriptor = ROOT::Experimental::RNTupleDescriptor;
+using RPageSource = ROOT::Experimental::Detail::RPageSource;
+using ROOT::Experimental::kInvalidDescriptorId;
+
+/// A cluster of one of the input sources, loaded with all the columns of the cluster
+struct RInputCluster {
+   std::size_t fSourceIdx = 0;
+   DescriptorId_t fClusterId = kInvalidDescriptorId;
+   std::unique_ptr<RCluster> fCluster;
+};
+
+DescriptorId_t FindFirstClusterId(const RNTupleDescriptor &desc)
+{
+   for (const auto &clusterDesc : desc.GetClusterIterable()) {
+      if (clusterDesc.GetFirstEntryIndex() == 0)
+         return clusterDesc.GetId();
+   }
+   return kInvalidDescriptorId;
+}
+
+/// Loads the cluster that follows the given cluster of the given source; an invalid cluster id refers to the position
+/// before the first cluster of the source.  The following sources are attached when they are reached.  At the end of
+/// the input, the returned source index equals the number of sources.
+RInputCluster LoadNextCluster(std::span<RPageSource *> sources, std::size_t sourceIdx, DescriptorId_t clusterId)
+{
+   RInputCluster result;
+   result.fSourceIdx = sourceIdx;
+   const auto &desc = sources[sourceIdx]->GetDescriptor();
+   result.fClusterId = (clusterId == kInvalidDescriptorId) ? FindFirstClusterId(desc) : desc.FindNextClusterId(clusterId);
+   while (result.fClusterId == kInvalidDescriptorId) {
+      if (++result.fSourceIdx == sources.size())
+         return result;
+      sources[result.fSourceIdx]->Attach();
+      result.fClusterId = FindFirstClusterId(sources[result.fSourceIdx]->GetDescriptor());
+   }
+
+   auto source = sources[result.fSourceIdx];
+   const auto &clusterDesc = source->GetDescriptor().GetClusterDescriptor(result.fClusterId);
+   result.fCluster = source->LoadCluster(result.fClusterId, clusterDesc.GetColumnIds());
+   return result;
+}
+
+/// Maps the columns of a field of the destination and of all its sub fields to the columns of the corresponding
+/// source field.  Throws if the fields or their columns differ between destination and source.
+void MapColumns(const RNTupleDescriptor &dstDesc, DescriptorId_t dstFieldId, const RNTupleDescriptor &srcDesc,
+                DescriptorId_t srcFieldId, std::vector<DescriptorId_t> &columnMap)
+{
+   const auto &dstField = dstDesc.GetFieldDescriptor(dstFieldId);
+   const auto &srcField = srcDesc.GetFieldDescriptor(srcFieldId);
+   auto fnThrow = [&](const std::string &reason) {
+      throw ROOT::Experimental::RException(R__FAIL("cannot merge field '" + dstDesc.GetQualifiedFieldName(dstFieldId) +
+                                                   "' of ntuple " + srcDesc.GetName() + ": " + reason));
+   };
+
+   if ((dstField.GetTypeName() != srcField.GetTypeName()) || (dstField.GetStructure() != srcField.GetStructure()) ||
+       (dstField.GetNRepetitions() != srcField.GetNRepetitions())) {
+      fnThrow("type mismatch");
+   }
+   if (dstField.GetLinkIds().size() != srcField.GetLinkIds().size())
+      fnThrow("different number of sub fields");
+
+   std::uint32_t nColumns = 0;
+   for (const auto &dstColumn : dstDesc.GetColumnIterable(dstFieldId)) {
+      auto srcColumnId = srcDesc.FindColumnId(srcFieldId, dstColumn.GetIndex());
+      if ((srcColumnId == kInvalidDescriptorId) ||
+          !(srcDesc.GetColumnDescriptor(srcColumnId).GetModel() == dstColumn.GetModel())) {
+         fnThrow("column type mismatch");
+      }
+      columnMap[dstColumn.GetId()] = srcColumnId;
+      nColumns++;
+   }
+   if (srcDesc.FindColumnId(srcFieldId, nColumns) != kInvalidDescriptorId)
+      fnThrow("different number of columns");
+
+   for (const auto &dstSubField : dstDesc.GetFieldIterable(dstFieldId)) {
+      auto srcSubFieldId = srcDesc.FindFieldId(dstSubField.GetFieldName(), srcFieldId);
+      if (srcSubFieldId == kInvalidDescriptorId)
+         fnThrow("missing sub field " + dstSubField.GetFieldName());
+      MapColumns(dstDesc, dstSubField.GetId(), srcDesc, srcSubFieldId, columnMap);
+   }
+}
+
+} // anonymous namespace
 
 Long64_t ROOT::Experimental::RNTuple::Merge(TCollection* inputs, TFileMergeInfo* mergeInfo) {
-   if (inputs == nullptr || mergeInfo == nullptr) {
+   if (inputs == nullptr || mergeInfo == nullptr || mergeInfo->fOutputDirectory == nullptr) {
+      return -1;
+   }
+   TFile *outFile = mergeInfo->fOutputDirectory->GetFile();
+   if (outFile == nullptr)
+      return -1;
+
+   TIter next(inputs);
+   TObject *nameObj = next();
+   if (nameObj == nullptr)
       return -1;
+   const std::string ntupleName = nameObj->GetName();
+   if (outFile->FindKey(ntupleName.c_str())) {
+      Error("RNTuple::Merge", "the output file %s already contains an object named %s", outFile->GetName(),
+            ntupleName.c_str());
+      return -1;
+   }
+
+   std::vector<std::unique_ptr<Detail::RPageSource>> sources;
+   std::vector<Detail::RPageSource *> sourcePtrs;
+   while (TObject *obj = next()) {
+      auto inFile = dynamic_cast<TFile *>(obj);
+      if (inFile == nullptr) {
+         Error("RNTuple::Merge", "expected an input file, got %s", obj->GetName());
+         return -1;
+      }
+      sources.emplace_back(
+         std::make_unique<Detail::RPageSourceFile>(ntupleName, inFile->GetName(), RNTupleReadOptions()));
+      sourcePtrs.emplace_back(sources.back().get());
    }
-   return -1;
+
+   RNTupleWriteOptions writeOptions;
+   writeOptions.SetCompression(outFile->GetCompressionSettings());
+   try {
+      Detail::RPageSinkFile destination(ntupleName, *outFile, writeOptions);
+      RNTupleMerger().Merge(sourcePtrs, destination);
+   } catch (const RException &err) {
+      Error("RNTuple::Merge", "%s", err.what());
+      return -1;
+   }
+
+   // The merged anchor is already written; the caller writes this object again under the same name
+   std::unique_ptr<RNTuple> anchor(outFile->Get<RNTuple>(ntupleName.c_str()));
+   if (!anchor)
+      return -1;
+   *this = *anchor;
+   return 0;
 }
 
 
@@ -37,3 +187,106 @@ ROOT::Experimental::RFieldMerger::Merge(const ROOT::Experimental::RFieldDescript
    return R__FAIL("couldn't merge field " + lhs.GetFieldName() + " with field "
       + rhs.GetFieldName() + " (unimplemented!)");
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+void ROOT::Experimental::RNTupleMerger::Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination)
+{
+   if (sources.empty())
+      throw RException(R__FAIL("no input ntuples to merge"));
+
+   // The destination schema follows the first source, including the on-disk column types
+   sources[0]->Attach();
+   const auto &firstDesc = sources[0]->GetDescriptor();
+   auto model = firstDesc.GenerateModel();
+   for (auto &field : *model->GetFieldZero()) {
+      if (field.GetOnDiskId() == kInvalidDescriptorId)
+         continue;
+      std::vector<EColumnType> representative;
+      for (std::uint32_t i = 0; ; ++i) {
+         auto columnId = firstDesc.FindColumnId(field.GetOnDiskId(), i);
+         if (columnId == kInvalidDescriptorId)
+            break;
+         representative.emplace_back(firstDesc.GetColumnDescriptor(columnId).GetModel().GetType());
+      }
+      if (representative.empty())
+         continue;
+      // Fixed-point columns need their value range, which is set together with a default representative
+      const auto &model0 = firstDesc.GetColumnDescriptor(firstDesc.FindColumnId(field.GetOnDiskId(), 0)).GetModel();
+      if (model0.HasValueRange()) {
+         if (auto floatField = dynamic_cast<RField<float> *>(&field))
+            floatField->SetQuantization(model0.GetMin(), model0.GetMax(), model0.GetNBits());
+         else if (auto doubleField = dynamic_cast<RField<double> *>(&field))
+            doubleField->SetQuantization(model0.GetMin(), model0.GetMax(), model0.GetNBits());
+      }
+      field.SetColumnRepresentative(representative);
+   }
+   destination.Create(*model);
+
+   const auto &dstDesc = destination.GetDescriptor();
+   const auto compression = destination.GetWriteOptions().GetCompression();
+   // Indexed by destination column id; valid for the source with index mappedSourceIdx
+   std::vector<DescriptorId_t> columnMap(dstDesc.GetNColumns(), kInvalidDescriptorId);
+   auto mappedSourceIdx = sources.size();
+   Detail::RNTupleDecompressor decompressor;
+   std::vector<unsigned char> unzipBuffer;
+   std::vector<unsigned char> zipBuffer;
+   NTupleSize_t nEntries = 0;
+
+   auto input = LoadNextCluster(sources, 0, kInvalidDescriptorId);
+   while (input.fSourceIdx < sources.size()) {
+      std::future<RInputCluster> nextInput;
+      if (fParallelRead)
+         nextInput = std::async(std::launch::async, LoadNextCluster, sources, input.fSourceIdx, input.fClusterId);
+
+      const auto &srcDesc = sources[input.fSourceIdx]->GetDescriptor();
+      if (input.fSourceIdx != mappedSourceIdx) {
+         MapColumns(dstDesc, dstDesc.GetFieldZeroId(), srcDesc, srcDesc.GetFieldZeroId(), columnMap);
+         mappedSourceIdx = input.fSourceIdx;
+      }
+
+      const auto &clusterDesc = srcDesc.GetClusterDescriptor(input.fClusterId);
+      for (std::size_t dstColumnId = 0; dstColumnId < columnMap.size(); ++dstColumnId) {
+         auto srcColumnId = columnMap[dstColumnId];
+         if (!clusterDesc.ContainsColumn(srcColumnId))
+            continue;
+
+         const bool needsRecompression = (clusterDesc.GetColumnRange(srcColumnId).fCompressionSettings != compression);
+         const auto bitsOnStorage =
+            Detail::RColumnElementBase::GetBitsOnStorage(srcDesc.GetColumnDescriptor(srcColumnId).GetModel().GetType());
+         Detail::RPageStorage::RSealedPage sealedPage;
+         if (clusterDesc.HasColumnStatistics(srcColumnId))
+            sealedPage.fStatistics = clusterDesc.GetColumnStatistics(srcColumnId);
+
+         const auto &pageInfos = clusterDesc.GetPageRange(srcColumnId).fPageInfos;
+         for (std::size_t pageNo = 0; pageNo < pageInfos.size(); ++pageNo) {
+            auto onDiskPage = input.fCluster->GetOnDiskPage(Detail::ROnDiskPage::Key(srcColumnId, pageNo));
+            R__ASSERT(onDiskPage);
+            sealedPage.fBuffer = onDiskPage->GetAddress();
+            sealedPage.fSize = onDiskPage->GetSize();
+            sealedPage.fNElements = pageInfos[pageNo].fNElements;
+
+            if (needsRecompression && (sealedPage.fNElements > 0)) {
+               // Sealed pages are compressed packed pages, so they can be recompressed without unpacking them
+               const std::size_t nbytesPacked = (sealedPage.fNElements * bitsOnStorage + 7) / 8;
+               unzipBuffer.resize(std::max(unzipBuffer.size(), nbytesPacked));
+               zipBuffer.resize(std::max(zipBuffer.size(), nbytesPacked));
+               decompressor.Unzip(sealedPage.fBuffer, sealedPage.fSize, nbytesPacked, unzipBuffer.data());
+               sealedPage.fSize =
+                  Detail::RNTupleCompressor::Zip(unzipBuffer.data(), nbytesPacked, compression, zipBuffer.data());
+               sealedPage.fBuffer = zipBuffer.data();
+            }
+
+            destination.CommitSealedPage(dstColumnId, sealedPage);
+         }
+      }
+      nEntries += clusterDesc.GetNEntries();
+      destination.CommitCluster(nEntries);
+
+      input = fParallelRead ? nextInput.get() : LoadNextCluster(sources, input.fSourceIdx, input.fClusterId);
+   }
+
+   destination.CommitDataset();
+}
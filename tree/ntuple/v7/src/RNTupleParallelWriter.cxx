@@ -0,0 +1,200 @@
+/// \file RNTupleParallelWriter.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2021-06-14
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RNTupleParallelWriter.hxx>
+
+#include <ROOT/RError.hxx>
+#include <ROOT/RField.hxx>
+#include <ROOT/RLogger.hxx>
+#include <ROOT/RPage.hxx>
+#include <ROOT/RPageAllocator.hxx>
+
+#include <cstring>
+#include <utility>
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter::RPageSinkFillContext
+\ingroup NTuple
+\brief The page sink of a fill context
+
+Seals committed pages right away, i.e. on the thread that fills the context, and keeps the sealed pages of the open
+cluster in memory.  On committing the cluster, the sealed pages are handed over to the sink of the parallel writer.
+The column ids of the fill context's sink match the ones of the parallel writer's sink because both are created from
+models with the same field hierarchy.
+*/
+// clang-format on
+class ROOT::Experimental::RNTupleParallelWriter::RPageSinkFillContext : public Detail::RPageSink {
+private:
+   struct RSealedPageBuf {
+      std::unique_ptr<unsigned char[]> fBuf;
+      RSealedPage fSealedPage;
+   };
+
+   RNTupleParallelWriter &fWriter;
+   /// The sealed pages of the open cluster. Indexed by column id.
+   std::vector<std::vector<RSealedPageBuf>> fSealedPages;
+
+protected:
+   void CreateImpl(const RNTupleModel & /* model */) final { fSealedPages.resize(fLastColumnId); }
+
+   RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const Detail::RPage &page) final
+   {
+      RSealedPageBuf sealedPageBuf;
+      sealedPageBuf.fBuf = std::make_unique<unsigned char[]>(page.GetSize());
+      sealedPageBuf.fSealedPage =
+         SealPage(page, *columnHandle.fColumn->GetElement(), fOptions.GetCompression(), sealedPageBuf.fBuf.get());
+      // Uncompressed mappable pages are not copied by SealPage() but the page buffer is reused by the column
+      if (sealedPageBuf.fSealedPage.fBuffer != sealedPageBuf.fBuf.get()) {
+         memcpy(sealedPageBuf.fBuf.get(), sealedPageBuf.fSealedPage.fBuffer, sealedPageBuf.fSealedPage.fSize);
+         sealedPageBuf.fSealedPage.fBuffer = sealedPageBuf.fBuf.get();
+      }
+      if (fOptions.GetComputeColumnStatistics())
+         sealedPageBuf.fSealedPage.fStatistics = columnHandle.fColumn->GetPageStatistics(page);
+      fSealedPages.at(columnHandle.fId).emplace_back(std::move(sealedPageBuf));
+      // The locators of the fill context's sink never get written out
+      return RClusterDescriptor::RLocator{};
+   }
+
+   RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) final
+   {
+      RSealedPageBuf sealedPageBuf;
+      sealedPageBuf.fBuf = std::make_unique<unsigned char[]>(sealedPage.fSize);
+      memcpy(sealedPageBuf.fBuf.get(), sealedPage.fBuffer, sealedPage.fSize);
+      sealedPageBuf.fSealedPage =
+         RSealedPage{sealedPageBuf.fBuf.get(), sealedPage.fSize, sealedPage.fNElements, sealedPage.fStatistics};
+      fSealedPages.at(columnId).emplace_back(std::move(sealedPageBuf));
+      return RClusterDescriptor::RLocator{};
+   }
+
+   RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) final
+   {
+      // Only the cluster size is used by the caller; it lets the fill context estimate the compression ratio
+      RClusterDescriptor::RLocator result;
+      {
+         std::lock_guard<std::mutex> guard(fWriter.fMutex);
+         for (std::size_t columnId = 0; columnId < fSealedPages.size(); ++columnId) {
+            for (const auto &sealedPageBuf : fSealedPages[columnId]) {
+               fWriter.fSink->CommitSealedPage(columnId, sealedPageBuf.fSealedPage);
+            }
+         }
+         fWriter.fNEntries += nEntries - fPrevClusterNEntries;
+         result.fBytesOnStorage = fWriter.fSink->CommitCluster(fWriter.fNEntries);
+      }
+      for (auto &pages : fSealedPages)
+         pages.clear();
+      return result;
+   }
+
+   void CommitDatasetImpl() final {}
+
+public:
+   RPageSinkFillContext(RNTupleParallelWriter &writer)
+      : RPageSink(writer.fSink->GetNTupleName(), writer.fSink->GetWriteOptions()), fWriter(writer)
+   {
+   }
+
+   Detail::RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements = 0) final
+   {
+      if (nElements == 0)
+         nElements = GetNElementsPerPage(columnHandle);
+      auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+      return Detail::RPageAllocatorHeap::NewPage(columnHandle.fId, elementSize, nElements);
+   }
+
+   void ReleasePage(Detail::RPage &page) final { Detail::RPageAllocatorHeap::DeletePage(page); }
+};
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(std::unique_ptr<RNTupleModel> model,
+                                                           std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model))
+{
+   fSink->Create(*fModel);
+   fUnzippedClusterSizeEst = Detail::RPageSink::EstimateUnzippedClusterSize(fSink->GetWriteOptions(), 0, 0);
+}
+
+ROOT::Experimental::RNTupleFillContext::~RNTupleFillContext()
+{
+   CommitCluster();
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitCluster()
+{
+   if (fNEntries == fLastCommitted)
+      return;
+   for (auto &field : *fModel->GetFieldZero()) {
+      field.Flush();
+      field.CommitCluster();
+   }
+   auto nbytesZipped = fSink->CommitCluster(fNEntries);
+   fUnzippedClusterSizeEst =
+      Detail::RPageSink::EstimateUnzippedClusterSize(fSink->GetWriteOptions(), fUnzippedClusterSize, nbytesZipped);
+   fUnzippedClusterSize = 0;
+   fLastCommitted = fNEntries;
+}
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model,
+                                                                 std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model))
+{
+   if (!fModel) {
+      throw RException(R__FAIL("null model"));
+   }
+   if (!fSink) {
+      throw RException(R__FAIL("null sink"));
+   }
+   fSink->Create(*fModel);
+}
+
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   for (const auto &context : fFillContexts) {
+      if (!context.expired()) {
+         R__LOG_ERROR(NTupleLog()) << "RNTupleFillContext has not been destructed before its RNTupleParallelWriter, "
+                                   << "the ntuple is not committed";
+         return;
+      }
+   }
+   fSink->CommitDataset();
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Recreate(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                    std::string_view storage, const RNTupleWriteOptions &options)
+{
+   // Pages are already buffered and sealed by the fill contexts
+   auto sinkOptions = options;
+   sinkOptions.SetUseBufferedWrite(false);
+   return std::make_unique<RNTupleParallelWriter>(std::move(model),
+                                                  Detail::RPageSink::Create(ntupleName, storage, sinkOptions));
+}
+
+std::shared_ptr<ROOT::Experimental::RNTupleFillContext> ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   std::lock_guard<std::mutex> guard(fMutex);
+   auto sink = std::make_unique<RPageSinkFillContext>(*this);
+   auto context = std::shared_ptr<RNTupleFillContext>(new RNTupleFillContext(fModel->Clone(), std::move(sink)));
+   fFillContexts.emplace_back(context);
+   return context;
+}
+
+ROOT::Experimental::NTupleSize_t ROOT::Experimental::RNTupleParallelWriter::GetNEntries()
+{
+   std::lock_guard<std::mutex> guard(fMutex);
+   return fNEntries;
+}
@@ -61,10 +61,14 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHa
    zipItem->AllocateSealedPageBuf();
    R__ASSERT(zipItem->fBuf);
    fTaskScheduler->AddTask([this, zipItem, colId = columnHandle.fId] {
+      const auto &column = *fBufferedColumns.at(colId).GetHandle().fColumn;
       zipItem->fSealedPage = SealPage(zipItem->fPage,
-         *fBufferedColumns.at(colId).GetHandle().fColumn->GetElement(),
+         *column.GetElement(),
          fOptions.GetCompression(), zipItem->fBuf.get()
       );
+      // The inner sink cannot compute the value range from the sealed page
+      if (fOptions.GetComputeColumnStatistics())
+         zipItem->fSealedPage.fStatistics = column.GetPageStatistics(zipItem->fPage);
    });
 
    // we're feeding bad locators to fOpenPageRanges but it should not matter
@@ -100,10 +104,11 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::
          ReleasePage(bufPage.fPage);
       }
    }
-   fInnerSink->CommitCluster(nEntries);
    // we're feeding bad locators to fOpenPageRanges but it should not matter
-   // because they never get written out
-   return RClusterDescriptor::RLocator{};
+   // because they never get written out; only the cluster size is passed on to the caller
+   RClusterDescriptor::RLocator result;
+   result.fBytesOnStorage = fInnerSink->CommitCluster(nEntries);
+   return result;
 }
 
 void ROOT::Experimental::Detail::RPageSinkBuf::CommitDatasetImpl()
@@ -31,6 +31,7 @@
 #include <Compression.h>
 #include <TError.h>
 
+#include <algorithm>
 #include <utility>
 
 
@@ -105,6 +106,22 @@ ROOT::Experimental::ColumnId_t ROOT::Experimental::Detail::RPageSource::GetColum
    return columnHandle.fId;
 }
 
+std::vector<ROOT::Experimental::DescriptorId_t>
+ROOT::Experimental::Detail::RPageSource::FindClustersInRange(DescriptorId_t columnId, double min, double max) const
+{
+   std::vector<DescriptorId_t> result;
+   for (const auto &cluster : fDescriptor.GetClusterIterable()) {
+      if (cluster.HasColumnStatistics(columnId) && !cluster.GetColumnStatistics(columnId).MayContain(min, max))
+         continue;
+      result.emplace_back(cluster.GetId());
+   }
+   std::sort(result.begin(), result.end(), [this](DescriptorId_t a, DescriptorId_t b) {
+      return fDescriptor.GetClusterDescriptor(a).GetFirstEntryIndex() <
+             fDescriptor.GetClusterDescriptor(b).GetFirstEntryIndex();
+   });
+   return result;
+}
+
 void ROOT::Experimental::Detail::RPageSource::UnzipCluster(RCluster *cluster)
 {
    if (fTaskScheduler)
@@ -217,6 +234,10 @@ void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
       RClusterDescriptor::RPageRange pageRange;
       pageRange.fColumnId = i;
       fOpenPageRanges.emplace_back(std::move(pageRange));
+      RClusterDescriptor::RColumnStatistics stats;
+      stats.fColumnId = i;
+      stats.fIsValid = true;
+      fOpenColumnStatistics.emplace_back(stats);
    }
 
    CreateImpl(model);
@@ -226,6 +247,8 @@ void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
 void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHandle, const RPage &page)
 {
    fOpenColumnRanges.at(columnHandle.fId).fNElements += page.GetNElements();
+   if (fOptions.GetComputeColumnStatistics())
+      fOpenColumnStatistics.at(columnHandle.fId).Merge(columnHandle.fColumn->GetPageStatistics(page));
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
@@ -239,6 +262,8 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(
    const ROOT::Experimental::Detail::RPageStorage::RSealedPage &sealedPage)
 {
    fOpenColumnRanges.at(columnId).fNElements += sealedPage.fNElements;
+   if (fOptions.GetComputeColumnStatistics())
+      fOpenColumnStatistics.at(columnId).Merge(sealedPage.fStatistics);
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = sealedPage.fNElements;
@@ -247,7 +272,7 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(
 }
 
 
-void ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NTupleSize_t nEntries)
+std::uint64_t ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NTupleSize_t nEntries)
 {
    auto locator = CommitClusterImpl(nEntries);
 
@@ -260,6 +285,14 @@ void ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NT
       range.fFirstElementIndex += range.fNElements;
       range.fNElements = 0;
    }
+   for (auto &stats : fOpenColumnStatistics) {
+      if (fOptions.GetComputeColumnStatistics() && stats.fIsValid)
+         fDescriptorBuilder.AddClusterColumnStatistics(fLastClusterId, stats);
+      RClusterDescriptor::RColumnStatistics emptyStats;
+      emptyStats.fColumnId = stats.fColumnId;
+      emptyStats.fIsValid = true;
+      stats = emptyStats;
+   }
    for (auto &range : fOpenPageRanges) {
       RClusterDescriptor::RPageRange fullRange;
       std::swap(fullRange, range);
@@ -268,6 +301,27 @@ void ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NT
    }
    ++fLastClusterId;
    fPrevClusterNEntries = nEntries;
+   return locator.fBytesOnStorage;
+}
+
+std::size_t ROOT::Experimental::Detail::RPageSink::EstimateUnzippedClusterSize(const RNTupleWriteOptions &options,
+                                                                             std::size_t nbytesUnzipped,
+                                                                             std::uint64_t nbytesZipped)
+{
+   double compressionFactor = 1.0;
+   if ((nbytesUnzipped > 0) && (nbytesZipped > 0))
+      compressionFactor = static_cast<double>(nbytesUnzipped) / static_cast<double>(nbytesZipped);
+   const double estimate = compressionFactor * options.GetApproxZippedClusterSize();
+   if (estimate >= options.GetMaxUnzippedClusterSize())
+      return options.GetMaxUnzippedClusterSize();
+   return static_cast<std::size_t>(estimate);
+}
+
+std::size_t ROOT::Experimental::Detail::RPageSink::GetNElementsPerPage(ColumnHandle_t columnHandle) const
+{
+   const auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   const auto maxNElements = std::max(std::size_t(1), fOptions.GetMaxUnzippedPageSize() / elementSize);
+   return std::min<std::size_t>(fOptions.GetNElementsPerPage(), maxNElements);
 }
 
 ROOT::Experimental::Detail::RPageStorage::RSealedPage
@@ -238,7 +238,7 @@ ROOT::Experimental::Detail::RPage
 ROOT::Experimental::Detail::RPageSinkDaos::ReservePage(ColumnHandle_t columnHandle, std::size_t nElements)
 {
    if (nElements == 0)
-      nElements = fOptions.GetNElementsPerPage();
+      nElements = GetNElementsPerPage(columnHandle);
    auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
    return fPageAllocator->NewPage(columnHandle.fId, elementSize, nElements);
 }
@@ -296,6 +296,7 @@ ROOT::Experimental::Detail::RPageSourceDaos::RPageSourceDaos(std::string_view nt
       *fMetrics.MakeCounter<RNTupleTickCounter<RNTupleAtomicCounter>*> ("timeCpuUnzip", "ns",
                                                                        "CPU time spent decompressing")
    });
+   fMetrics.ObserveMetrics(fClusterPool->GetMetrics());
 
    auto args = ParseDaosURI(uri);
    auto pool = std::make_shared<RDaosPool>(args.fPoolUuid, args.fSvcReplicas);
@@ -532,7 +533,8 @@ void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *clu
    for (const auto columnId : columnsInCluster) {
       const auto &columnDesc = fDescriptor.GetColumnDescriptor(columnId);
 
-      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      const auto &fieldDesc = fDescriptor.GetFieldDescriptor(columnDesc.GetFieldId());
+      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel(), fieldDesc.GetTypeName()));
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
       std::uint64_t pageNo = 0;
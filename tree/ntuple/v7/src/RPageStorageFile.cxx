@@ -188,7 +188,7 @@ ROOT::Experimental::Detail::RPage
 ROOT::Experimental::Detail::RPageSinkFile::ReservePage(ColumnHandle_t columnHandle, std::size_t nElements)
 {
    if (nElements == 0)
-      nElements = fOptions.GetNElementsPerPage();
+      nElements = GetNElementsPerPage(columnHandle);
    auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
    return fPageAllocator->NewPage(columnHandle.fId, elementSize, nElements);
 }
@@ -221,6 +221,17 @@ void ROOT::Experimental::Detail::RPageAllocatorFile::DeletePage(const RPage& pag
 ////////////////////////////////////////////////////////////////////////////////
 
 
+struct ROOT::Experimental::Detail::RPageSourceFile::RClusterRead {
+   DescriptorId_t fClusterId = kInvalidDescriptorId;
+   ColumnSet_t fColumns;
+   std::unique_ptr<ROnDiskPageMapHeap> fPageMap;
+   std::vector<ROOT::Internal::RRawFile::RIOVec> fReadRequests;
+   std::size_t fNPages = 0;
+   /// Set if the read requests have been submitted by PrefetchCluster()
+   bool fIsSubmitted = false;
+   ROOT::Internal::RRawFile::ReadVHandle_t fReadVHandle = 0;
+};
+
 ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view ntupleName,
    const RNTupleReadOptions &options)
    : RPageSource(ntupleName, options)
@@ -233,6 +244,8 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
    fCounters = std::unique_ptr<RCounters>(new RCounters{
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nReadV", "", "number of vector read requests"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nRead", "", "number of byte ranges read"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nReadSaved", "",
+                                                   "number of byte ranges saved by coalescing page reads"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szReadPayload", "B", "volume read from file (required)"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szReadOverhead", "B", "volume read from file (overhead)"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szUnzip", "B", "volume after unzipping"),
@@ -316,6 +329,7 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
          }
       )
    });
+   fMetrics.ObserveMetrics(fClusterPool->GetMetrics());
 }
 
 
@@ -329,7 +343,21 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
 }
 
 
-ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile() = default;
+ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view ntupleName,
+   std::unique_ptr<ROOT::Internal::RRawFile> file, const RNTupleReadOptions &options)
+   : RPageSourceFile(ntupleName, options)
+{
+   fFile = std::move(file);
+   R__ASSERT(fFile);
+   fReader = Internal::RMiniFileReader(fFile.get());
+}
+
+
+ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile()
+{
+   // Stops the I/O thread, which loads all the clusters it prefetched, before the read buffers are released
+   fClusterPool.reset();
+}
 
 
 ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFile::AttachImpl()
@@ -470,11 +498,9 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Det
    return std::unique_ptr<RPageSourceFile>(clone);
 }
 
-std::unique_ptr<ROOT::Experimental::Detail::RCluster>
-ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+std::unique_ptr<ROOT::Experimental::Detail::RPageSourceFile::RClusterRead>
+ROOT::Experimental::Detail::RPageSourceFile::PrepareClusterRead(DescriptorId_t clusterId, const ColumnSet_t &columns)
 {
-   fCounters->fNClusterLoaded.Inc();
-
    const auto &clusterDesc = GetDescriptor().GetClusterDescriptor(clusterId);
    auto clusterLocator = clusterDesc.GetLocator();
    auto clusterSize = clusterLocator.fBytesOnStorage;
@@ -493,7 +519,7 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
 
    // Collect the page necessary page meta-data and sum up the total size of the compressed and packed pages
    std::vector<ROnDiskPageLocator> onDiskPages;
-   auto activeSize = 0;
+   std::size_t activeSize = 0;
    for (auto columnId : columns) {
       const auto &pageRange = clusterDesc.GetPageRange(columnId);
       NTupleSize_t pageNo = 0;
@@ -515,9 +541,11 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
    // The size of the cutoff is given by the fraction of extra bytes we are willing to read in order to reduce
    // the number of read requests.  We thus schedule the lowest number of requests given a tolerable fraction
    // of extra bytes.
+   // The tolerable fraction and the largest tolerable gap are set by the read options.
    // TODO(jblomer): Eventually we may want to select the parameter at runtime according to link latency and speed,
    // memory consumption, device block size.
-   float maxOverhead = 0.25 * float(activeSize);
+   float maxOverhead = fOptions.GetMaxReadOverhead() * float(activeSize);
+   const auto maxGap = fOptions.GetMaxReadGap();
    std::vector<std::size_t> gaps;
    for (unsigned i = 1; i < onDiskPages.size(); ++i) {
       gaps.emplace_back(onDiskPages[i].fOffset - (onDiskPages[i-1].fSize + onDiskPages[i-1].fOffset));
@@ -527,7 +555,7 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
    float szExtra = 0.0;
    for (auto g : gaps) {
       szExtra += g;
-      if (szExtra  > maxOverhead)
+      if ((szExtra > maxOverhead) || (g > maxGap))
          break;
       gapCut = g;
    }
@@ -551,7 +579,7 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
       R__ASSERT(s.fOffset >= readUpTo);
       auto overhead = s.fOffset - readUpTo;
       szPayload += s.fSize;
-      if (overhead <= gapCut) {
+      if ((req.fSize > 0) && (overhead <= gapCut)) {
          szOverhead += overhead;
          s.fBufPos = reinterpret_cast<intptr_t>(req.fBuffer) + req.fSize + overhead;
          req.fSize += overhead + s.fSize;
@@ -568,7 +596,8 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
       req.fOffset = s.fOffset;
       req.fSize = s.fSize;
    }
-   readRequests.emplace_back(req);
+   if (req.fSize > 0)
+      readRequests.emplace_back(req);
    fCounters->fSzReadPayload.Add(szPayload);
    fCounters->fSzReadOverhead.Add(szOverhead);
 
@@ -584,16 +613,64 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
       r.fBuffer = buffer + reinterpret_cast<intptr_t>(r.fBuffer);
    }
 
-   auto nReqs = readRequests.size();
-   {
+   auto clusterRead = std::make_unique<RClusterRead>();
+   clusterRead->fClusterId = clusterId;
+   clusterRead->fColumns = columns;
+   clusterRead->fPageMap = std::move(pageMap);
+   clusterRead->fReadRequests = std::move(readRequests);
+   clusterRead->fNPages = onDiskPages.size();
+   return clusterRead;
+}
+
+void ROOT::Experimental::Detail::RPageSourceFile::PrefetchCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+{
+   if (!(fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasAsyncIo))
+      return;
+
+   auto clusterRead = PrepareClusterRead(clusterId, columns);
+   auto &readRequests = clusterRead->fReadRequests;
+   if (!readRequests.empty())
+      clusterRead->fReadVHandle = fFile->ReadVAsync(readRequests.data(), readRequests.size());
+   clusterRead->fIsSubmitted = true;
+   fPrefetchedClusters.emplace_back(std::move(clusterRead));
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+{
+   fCounters->fNClusterLoaded.Inc();
+
+   std::unique_ptr<RClusterRead> clusterRead;
+   for (auto itr = fPrefetchedClusters.begin(); itr != fPrefetchedClusters.end(); ++itr) {
+      if ((*itr)->fClusterId != clusterId)
+         continue;
+      clusterRead = std::move(*itr);
+      fPrefetchedClusters.erase(itr);
+      break;
+   }
+   if (clusterRead && (clusterRead->fColumns != columns)) {
+      // The buffers of the prefetched cluster must stay alive until its outstanding reads are finished
+      if (!clusterRead->fReadRequests.empty())
+         fFile->WaitReadV(clusterRead->fReadVHandle);
+      clusterRead.reset();
+   }
+   if (!clusterRead)
+      clusterRead = PrepareClusterRead(clusterId, columns);
+
+   auto nReqs = clusterRead->fReadRequests.size();
+   if (nReqs > 0) {
       RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
-      fFile->ReadV(&readRequests[0], nReqs);
+      if (clusterRead->fIsSubmitted)
+         fFile->WaitReadV(clusterRead->fReadVHandle);
+      else
+         fFile->ReadV(clusterRead->fReadRequests.data(), nReqs);
+      fCounters->fNReadV.Inc();
    }
-   fCounters->fNReadV.Inc();
    fCounters->fNRead.Add(nReqs);
+   fCounters->fNReadSaved.Add(clusterRead->fNPages - nReqs);
 
    auto cluster = std::make_unique<RCluster>(clusterId);
-   cluster->Adopt(std::move(pageMap));
+   cluster->Adopt(std::move(clusterRead->fPageMap));
    for (auto colId : columns)
       cluster->SetColumnAvailable(colId);
    return cluster;
@@ -614,7 +691,8 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
    for (const auto columnId : columnsInCluster) {
       const auto &columnDesc = fDescriptor.GetColumnDescriptor(columnId);
 
-      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      const auto &fieldDesc = fDescriptor.GetFieldDescriptor(columnDesc.GetFieldId());
+      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel(), fieldDesc.GetTypeName()));
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
       std::uint64_t pageNo = 0;
@@ -257,6 +257,78 @@ TEST(RNTuple, ElementsPerPage)
    EXPECT_EQ(20, col0_pages.fPageInfos.size());
 }
 
+TEST(RNTuple, ClusterSize)
+{
+   FileRaii fileGuard("test_ntuple_cluster_size.root");
+   auto model = RNTupleModel::Create();
+   auto field = model->MakeField<float>({"pt", "transverse momentum"}, 42.0);
+
+   {
+      RNTupleWriteOptions opt;
+      opt.SetCompression(0);
+      opt.SetMaxUnzippedClusterSize(400);
+      auto ntuple = RNTupleWriter::Recreate(
+         std::move(model), "ntuple", fileGuard.GetPath(), opt
+      );
+      for (int i = 0; i < 1000; i++) {
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   // 1000 entries * 4 bytes / 400 bytes per cluster
+   EXPECT_EQ(10, ntuple->GetDescriptor().GetNClusters());
+   EXPECT_EQ(100U, ntuple->GetDescriptor().GetClusterDescriptor(0).GetNEntries());
+}
+
+TEST(RNTuple, ApproxZippedClusterSize)
+{
+   FileRaii fileGuard("test_ntuple_approx_zipped_cluster_size.root");
+   auto model = RNTupleModel::Create();
+   auto field = model->MakeField<float>({"pt", "transverse momentum"}, 42.0);
+
+   {
+      RNTupleWriteOptions opt;
+      opt.SetApproxZippedClusterSize(400);
+      auto ntuple = RNTupleWriter::Recreate(
+         std::move(model), "ntuple", fileGuard.GetPath(), opt
+      );
+      for (int i = 0; i < 10000; i++) {
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   // Without a previous cluster, the first cluster is cut assuming no compression
+   EXPECT_EQ(100U, desc.GetClusterDescriptor(0).GetNEntries());
+   // The constant values compress well, so the following clusters should be considerably larger
+   EXPECT_GT(desc.GetClusterDescriptor(1).GetNEntries(), 1000U);
+}
+
+TEST(RNTuple, MaxUnzippedPageSize)
+{
+   FileRaii fileGuard("test_ntuple_max_unzipped_page_size.root");
+   auto model = RNTupleModel::Create();
+   auto field = model->MakeField<double>("energy", 1.0);
+
+   {
+      RNTupleWriteOptions opt;
+      opt.SetMaxUnzippedPageSize(80);
+      auto ntuple = RNTupleWriter::Recreate(
+         std::move(model), "ntuple", fileGuard.GetPath(), opt
+      );
+      for (int i = 0; i < 100; i++) {
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &col0_pages = ntuple->GetDescriptor().GetClusterDescriptor(0).GetPageRange(0);
+   // 100 column elements / (80 bytes / 8 bytes per element)
+   EXPECT_EQ(10, col0_pages.fPageInfos.size());
+}
+
 TEST(RNTupleModel, EnforceValidFieldNames)
 {
    auto model = RNTupleModel::Create();
@@ -56,13 +56,30 @@ public:
    std::vector<ROOT::Experimental::DescriptorId_t> fReqsClusterIds;
    std::vector<ROOT::Experimental::Detail::RPageSource::ColumnSet_t> fReqsColumns;
 
-   RPageSourceMock() : RPageSource("test", ROOT::Experimental::RNTupleReadOptions()) {
+   /// Every cluster has a single page of column 0 with 10 doubles that are compressed to 40 bytes
+   explicit RPageSourceMock(const ROOT::Experimental::RNTupleReadOptions &options =
+                               ROOT::Experimental::RNTupleReadOptions())
+      : RPageSource("test", options)
+   {
       ROOT::Experimental::RNTupleDescriptorBuilder descBuilder;
-      descBuilder.AddCluster(0, RNTupleVersion(), 0, ClusterSize_t(1));
-      descBuilder.AddCluster(1, RNTupleVersion(), 1, ClusterSize_t(1));
-      descBuilder.AddCluster(2, RNTupleVersion(), 2, ClusterSize_t(1));
-      descBuilder.AddCluster(3, RNTupleVersion(), 3, ClusterSize_t(1));
-      descBuilder.AddCluster(4, RNTupleVersion(), 4, ClusterSize_t(1));
+      descBuilder.AddColumn(0, 0, RNTupleVersion(),
+                            ROOT::Experimental::RColumnModel(ROOT::Experimental::EColumnType::kReal64, false), 0);
+      for (unsigned i = 0; i < 5; ++i) {
+         descBuilder.AddCluster(i, RNTupleVersion(), i, ClusterSize_t(1));
+         ROOT::Experimental::RClusterDescriptor::RColumnRange columnRange;
+         columnRange.fColumnId = 0;
+         columnRange.fFirstElementIndex = 10 * i;
+         columnRange.fNElements = 10;
+         descBuilder.AddClusterColumnRange(i, columnRange);
+         ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+         pageInfo.fNElements = 10;
+         pageInfo.fLocator.fPosition = 40 * i;
+         pageInfo.fLocator.fBytesOnStorage = 40;
+         ROOT::Experimental::RClusterDescriptor::RPageRange pageRange;
+         pageRange.fColumnId = 0;
+         pageRange.fPageInfos.emplace_back(pageInfo);
+         descBuilder.AddClusterPageRange(i, std::move(pageRange));
+      }
       fDescriptor = descBuilder.MoveDescriptor();
    }
    std::unique_ptr<RPageSource> Clone() const final { return nullptr; }
@@ -288,6 +305,59 @@ TEST(ClusterPool, GetClusterIncrementally)
 }
 
 
+TEST(ClusterPool, MemoryLimit)
+{
+   // Every cluster takes an estimated 120 bytes for column 0, 40 bytes compressed and 80 bytes unzipped
+   ROOT::Experimental::RNTupleReadOptions options;
+   options.SetClusterCacheMemoryLimit(250);
+   RPageSourceMock p1(options);
+   {
+      RClusterPool c1(p1, 4);
+      EXPECT_EQ(250U, c1.GetMemoryLimit());
+      c1.GetMetrics().Enable();
+      c1.GetCluster(0, {0});
+      EXPECT_EQ(1, c1.GetMetrics().GetCounter("RClusterPool.nLookAheadLimited")->GetValueAsInt());
+   }
+   ASSERT_EQ(2U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(0U, p1.fReqsClusterIds[0]);
+   EXPECT_EQ(1U, p1.fReqsClusterIds[1]);
+
+   // The requested cluster is loaded even if it exceeds the memory limit on its own
+   options.SetClusterCacheMemoryLimit(100);
+   RPageSourceMock p2(options);
+   {
+      RClusterPool c2(p2, 4);
+      c2.GetCluster(2, {0});
+   }
+   ASSERT_EQ(1U, p2.fReqsClusterIds.size());
+   EXPECT_EQ(2U, p2.fReqsClusterIds[0]);
+}
+
+TEST(ClusterPool, Metrics)
+{
+   RPageSourceMock p1;
+   RClusterPool c1(p1, 2);
+   c1.GetMetrics().Enable();
+   // Preloads both columns of cluster 1 in two separate requests
+   c1.GetCluster(0, {0});
+   c1.GetCluster(0, {1});
+   // Jumping to cluster 3 discards cluster 1, which has never been requested.  Waiting for cluster 3 and 4
+   // ensures that both partial clusters of cluster 1 have left the pipeline.
+   c1.GetCluster(3, {0});
+   c1.GetCluster(3, {1});
+   c1.GetCluster(4, {0});
+
+   const auto &metrics = c1.GetMetrics();
+   // Column 1 is not part of the descriptor and thus does not contribute to the estimated size
+   EXPECT_EQ(2, metrics.GetCounter("RClusterPool.nClusterUnused")->GetValueAsInt());
+   EXPECT_EQ(120, metrics.GetCounter("RClusterPool.szPrefetchUnused")->GetValueAsInt());
+   EXPECT_EQ(2, metrics.GetCounter("RClusterPool.nLookAhead")->GetValueAsInt());
+   EXPECT_EQ(0, metrics.GetCounter("RClusterPool.nLookAheadLimited")->GetValueAsInt());
+   // The stall time depends on the scheduling of the I/O thread and is only checked for its presence
+   EXPECT_NE(nullptr, metrics.GetCounter("RClusterPool.timeWallStall"));
+}
+
+
 TEST(PageStorageFile, LoadCluster)
 {
    FileRaii fileGuard("test_ntuple_clusters.root");
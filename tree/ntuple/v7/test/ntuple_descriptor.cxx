@@ -96,6 +96,12 @@ TEST(RNTuple, Descriptor)
    pageInfo.fLocator.fPosition = 16384;
    pageRange3.fPageInfos.emplace_back(pageInfo);
    descBuilder.AddClusterPageRange(1, std::move(pageRange3));
+   ROOT::Experimental::RClusterDescriptor::RColumnStatistics stats;
+   stats.fColumnId = 4;
+   stats.fIsValid = true;
+   stats.fMin = -1.5;
+   stats.fMax = 42.0;
+   descBuilder.AddClusterColumnStatistics(1, stats);
 
    const auto &reference = descBuilder.GetDescriptor();
    EXPECT_EQ("MyTuple", reference.GetName());
@@ -127,6 +133,10 @@ TEST(RNTuple, Descriptor)
    reco.SetFromHeader(headerBuffer);
    reco.AddClustersFromFooter(footerBuffer);
    EXPECT_EQ(reference, reco.GetDescriptor());
+   EXPECT_FALSE(reco.GetDescriptor().GetClusterDescriptor(0).HasColumnStatistics(4));
+   ASSERT_TRUE(reco.GetDescriptor().GetClusterDescriptor(1).HasColumnStatistics(4));
+   EXPECT_EQ(42.0, reco.GetDescriptor().GetClusterDescriptor(1).GetColumnStatistics(4).fMax);
+   EXPECT_FALSE(reco.GetDescriptor().GetClusterDescriptor(1).GetColumnStatistics(4).MayContain(50.0, 60.0));
 
    EXPECT_EQ(NTupleSize_t(1100), reference.GetNEntries());
    EXPECT_EQ(NTupleSize_t(1100), reference.GetNElements(3));
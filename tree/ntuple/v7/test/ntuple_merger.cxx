@@ -80,3 +80,132 @@ TEST(RFieldMerger, Merge)
    auto mergeResult = RFieldMerger::Merge(RFieldDescriptor(), RFieldDescriptor());
    EXPECT_FALSE(mergeResult);
 }
+
+TEST(RNTupleMerger, Merge)
+{
+   FileRaii fileGuard1("test_ntuple_merger_in1.root");
+   FileRaii fileGuard2("test_ntuple_merger_in2.root");
+   FileRaii fileGuard3("test_ntuple_merger_out.root");
+
+   // The first input uses the output's compression and two clusters, the second input is uncompressed.  Together,
+   // they contain the entries 0 to 19.
+   for (int n = 0; n < 2; ++n) {
+      auto model = RNTupleModel::Create();
+      auto wrPx = model->MakeField<float>("px");
+      auto wrVec = model->MakeField<std::vector<std::int32_t>>("vec");
+      RNTupleWriteOptions options;
+      if (n == 1)
+         options.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl",
+                                            (n == 0) ? fileGuard1.GetPath() : fileGuard2.GetPath(), options);
+      for (int i = 10 * n; i < 10 * (n + 1); ++i) {
+         *wrPx = i;
+         *wrVec = std::vector<std::int32_t>(i % 3, i);
+         ntuple->Fill();
+         if (i == 4)
+            ntuple->CommitCluster();
+      }
+   }
+
+   {
+      RPageSourceFile source1("ntpl", fileGuard1.GetPath(), RNTupleReadOptions());
+      RPageSourceFile source2("ntpl", fileGuard2.GetPath(), RNTupleReadOptions());
+      std::vector<RPageSource *> sources{&source1, &source2};
+      RPageSinkFile sink("ntpl", fileGuard3.GetPath(), RNTupleWriteOptions());
+      RNTupleMerger merger;
+      merger.SetParallelRead(true);
+      merger.Merge(sources, sink);
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard3.GetPath());
+   ASSERT_EQ(20U, ntuple->GetNEntries());
+   const auto &desc = ntuple->GetDescriptor();
+   EXPECT_EQ(3U, desc.GetNClusters());
+   for (const auto &clusterDesc : desc.GetClusterIterable()) {
+      for (auto columnId : clusterDesc.GetColumnIds()) {
+         EXPECT_EQ(RNTupleWriteOptions().GetCompression(), clusterDesc.GetColumnRange(columnId).fCompressionSettings);
+      }
+   }
+
+   auto rdPx = ntuple->GetModel()->GetDefaultEntry()->Get<float>("px");
+   auto rdVec = ntuple->GetModel()->GetDefaultEntry()->Get<std::vector<std::int32_t>>("vec");
+   for (int i = 0; i < 20; ++i) {
+      ntuple->LoadEntry(i);
+      EXPECT_FLOAT_EQ(static_cast<float>(i), *rdPx);
+      EXPECT_EQ(std::vector<std::int32_t>(i % 3, i), *rdVec);
+   }
+}
+
+TEST(RNTupleMerger, TFileMerger)
+{
+   FileRaii fileGuard1("test_ntuple_merger_hadd_in1.root");
+   FileRaii fileGuard2("test_ntuple_merger_hadd_in2.root");
+   FileRaii fileGuard3("test_ntuple_merger_hadd_out.root");
+
+   for (int n = 0; n < 2; ++n) {
+      auto model = RNTupleModel::Create();
+      auto wrPx = model->MakeField<float>("px");
+      auto ntuple =
+         RNTupleWriter::Recreate(std::move(model), "ntpl", (n == 0) ? fileGuard1.GetPath() : fileGuard2.GetPath());
+      for (int i = 10 * n; i < 10 * (n + 1); ++i) {
+         *wrPx = i;
+         ntuple->Fill();
+      }
+   }
+
+   // The code path of hadd
+   {
+      TFileMerger merger(kFALSE, kFALSE);
+      merger.SetPrintLevel(0);
+      ASSERT_TRUE(merger.OutputFile(fileGuard3.GetPath().c_str(), "RECREATE", 505));
+      ASSERT_TRUE(merger.AddFile(fileGuard1.GetPath().c_str(), kFALSE));
+      ASSERT_TRUE(merger.AddFile(fileGuard2.GetPath().c_str(), kFALSE));
+      ASSERT_TRUE(merger.Merge());
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard3.GetPath());
+   ASSERT_EQ(20U, ntuple->GetNEntries());
+   const auto &desc = ntuple->GetDescriptor();
+   EXPECT_EQ(2U, desc.GetNClusters());
+   for (const auto &clusterDesc : desc.GetClusterIterable()) {
+      for (auto columnId : clusterDesc.GetColumnIds()) {
+         EXPECT_EQ(505, clusterDesc.GetColumnRange(columnId).fCompressionSettings);
+      }
+   }
+   auto rdPx = ntuple->GetModel()->GetDefaultEntry()->Get<float>("px");
+   for (int i = 0; i < 20; ++i) {
+      ntuple->LoadEntry(i);
+      EXPECT_FLOAT_EQ(static_cast<float>(i), *rdPx);
+   }
+}
+
+TEST(RNTupleMerger, SchemaMismatch)
+{
+   FileRaii fileGuard1("test_ntuple_merger_mismatch_in1.root");
+   FileRaii fileGuard2("test_ntuple_merger_mismatch_in2.root");
+   FileRaii fileGuard3("test_ntuple_merger_mismatch_out.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("px");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard1.GetPath());
+      ntuple->Fill();
+   }
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<double>("px");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard2.GetPath());
+      ntuple->Fill();
+   }
+
+   RPageSourceFile source1("ntpl", fileGuard1.GetPath(), RNTupleReadOptions());
+   RPageSourceFile source2("ntpl", fileGuard2.GetPath(), RNTupleReadOptions());
+   std::vector<RPageSource *> sources{&source1, &source2};
+   RPageSinkFile sink("ntpl", fileGuard3.GetPath(), RNTupleWriteOptions());
+   try {
+      RNTupleMerger().Merge(sources, sink);
+      FAIL() << "merging ntuples with different schemas should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("cannot merge field 'px'"));
+   }
+}
@@ -32,3 +32,163 @@ TEST(Packing, Bitfield)
       EXPECT_EQ(b9[i], e9[i]);
    }
 }
+
+TEST(Packing, SplitReal)
+{
+   ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64> element(nullptr);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+   EXPECT_FALSE(element.IsMappable());
+   EXPECT_EQ(64U, element.GetBitsOnStorage());
+
+   double mem[] = {1.0, -2.5, 1e100, 0.0};
+   unsigned char splitBytes[sizeof(mem)];
+   element.Pack(splitBytes, mem, 4);
+   // The first bytes of all elements come first, the most significant (last) bytes of all elements at the end
+   for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(reinterpret_cast<unsigned char *>(&mem[i])[0], splitBytes[i]);
+      EXPECT_EQ(reinterpret_cast<unsigned char *>(&mem[i])[7], splitBytes[28 + i]);
+   }
+   double unpacked[4];
+   element.Unpack(unpacked, splitBytes, 4);
+   for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(mem[i], unpacked[i]);
+   }
+}
+
+TEST(Packing, Real16)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal16> element(nullptr);
+   element.SetColumnModel(ROOT::Experimental::RColumnModel(ROOT::Experimental::EColumnType::kReal16, false));
+   EXPECT_FALSE(element.IsMappable());
+   EXPECT_EQ(16U, element.GetBitsOnStorage());
+
+   // 1.00390625 lies half-way between 1 and the next 16 bit value and rounds to even
+   float mem[] = {1.0, -2.5, 1.00390625, 3.14159265, std::numeric_limits<float>::infinity()};
+   std::uint16_t packed[5];
+   element.Pack(packed, mem, 5);
+   EXPECT_EQ(0x3f80, packed[0]);
+   EXPECT_EQ(0xc020, packed[1]);
+   EXPECT_EQ(0x3f80, packed[2]);
+   float unpacked[5];
+   element.Unpack(unpacked, packed, 5);
+   EXPECT_EQ(1.0, unpacked[0]);
+   EXPECT_EQ(-2.5, unpacked[1]);
+   EXPECT_EQ(1.0, unpacked[2]);
+   EXPECT_NEAR(3.14159265, unpacked[3], 0.01);
+   EXPECT_TRUE(std::isinf(unpacked[4]));
+
+   float nan = std::numeric_limits<float>::quiet_NaN();
+   element.Pack(packed, &nan, 1);
+   element.Unpack(unpacked, packed, 1);
+   EXPECT_TRUE(std::isnan(unpacked[0]));
+}
+
+TEST(Packing, SinglePrecisionRange)
+{
+   ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal32> element32(nullptr);
+   ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal16> element16(nullptr);
+   element16.SetColumnModel(ROOT::Experimental::RColumnModel(ROOT::Experimental::EColumnType::kReal16, false));
+
+   double inRange[] = {0., -1.5, 1e30, std::numeric_limits<double>::infinity()};
+   float packed32[4];
+   std::uint16_t packed16[4];
+   element32.Pack(packed32, inRange, 4);
+   element16.Pack(packed16, inRange, 4);
+   double unpacked[4];
+   element32.Unpack(unpacked, packed32, 4);
+   EXPECT_EQ(-1.5, unpacked[1]);
+   EXPECT_TRUE(std::isinf(unpacked[3]));
+
+   // Values that would become infinite or zero in single precision
+   for (double value : {1e300, -1e300, 1e-300}) {
+      EXPECT_THROW(element32.Pack(packed32, &value, 1), ROOT::Experimental::RException);
+      EXPECT_THROW(element16.Pack(packed16, &value, 1), ROOT::Experimental::RException);
+   }
+
+   // The largest float is truncated rather than rounded up to infinity
+   ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal16> elementFloat(nullptr);
+   elementFloat.SetColumnModel(ROOT::Experimental::RColumnModel(ROOT::Experimental::EColumnType::kReal16, false));
+   float maxFloat = std::numeric_limits<float>::max();
+   elementFloat.Pack(packed16, &maxFloat, 1);
+   float unpackedFloat;
+   elementFloat.Unpack(&unpackedFloat, packed16, 1);
+   EXPECT_TRUE(std::isfinite(unpackedFloat));
+   EXPECT_NEAR(maxFloat, unpackedFloat, maxFloat / 128);
+}
+
+TEST(Packing, FixedPoint)
+{
+   ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal8> element(nullptr);
+   element.SetColumnModel(ROOT::Experimental::RColumnModel(ROOT::Experimental::EColumnType::kReal8, false, 4, -1., 2.));
+   EXPECT_EQ(8U, element.GetBitsOnStorage());
+
+   // With 4 bits, the range [-1, 2] is divided into 15 steps of 0.2
+   double mem[] = {-1., 2., 0.21, -5., 5., std::numeric_limits<double>::quiet_NaN()};
+   std::uint8_t packed[6];
+   element.Pack(packed, mem, 6);
+   EXPECT_EQ(0, packed[0]);
+   EXPECT_EQ(15, packed[1]);
+   EXPECT_EQ(6, packed[2]);
+   EXPECT_EQ(0, packed[3]);
+   EXPECT_EQ(15, packed[4]);
+   EXPECT_EQ(0, packed[5]);
+   double unpacked[6];
+   element.Unpack(unpacked, packed, 6);
+   EXPECT_DOUBLE_EQ(-1., unpacked[0]);
+   EXPECT_DOUBLE_EQ(2., unpacked[1]);
+   EXPECT_NEAR(0.2, unpacked[2], 1e-12);
+   EXPECT_DOUBLE_EQ(-1., unpacked[3]);
+   EXPECT_DOUBLE_EQ(2., unpacked[4]);
+   EXPECT_DOUBLE_EQ(-1., unpacked[5]);
+}
+
+TEST(Packing, SplitInt)
+{
+   ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32> element(
+      nullptr);
+   std::int32_t mem[] = {0, -1, 1, -2, 2147483647, -2147483647 - 1};
+   unsigned char splitBytes[sizeof(mem)];
+   element.Pack(splitBytes, mem, 6);
+   // Zigzag encoding maps small negative numbers to small positive numbers
+   EXPECT_EQ(0, splitBytes[0]);
+   EXPECT_EQ(1, splitBytes[1]);
+   EXPECT_EQ(2, splitBytes[2]);
+   EXPECT_EQ(3, splitBytes[3]);
+   for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(0, splitBytes[18 + i]);
+   }
+   std::int32_t unpacked[6];
+   element.Unpack(unpacked, splitBytes, 6);
+   for (unsigned i = 0; i < 6; ++i) {
+      EXPECT_EQ(mem[i], unpacked[i]);
+   }
+
+   // Unsigned integers use the same on-disk format
+   ROOT::Experimental::Detail::RColumnElement<std::uint32_t, ROOT::Experimental::EColumnType::kSplitInt32>
+      elementUnsigned(nullptr);
+   std::uint32_t memUnsigned[6];
+   elementUnsigned.Unpack(memUnsigned, splitBytes, 6);
+   for (unsigned i = 0; i < 6; ++i) {
+      EXPECT_EQ(static_cast<std::uint32_t>(mem[i]), memUnsigned[i]);
+   }
+}
+
+TEST(Packing, SplitIndex)
+{
+   ROOT::Experimental::Detail::RColumnElement<ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex> element(
+      nullptr);
+   ClusterSize_t mem[] = {ClusterSize_t(3), ClusterSize_t(3), ClusterSize_t(7), ClusterSize_t(100000),
+                          ClusterSize_t(2)};
+   unsigned char splitBytes[sizeof(mem)];
+   element.Pack(splitBytes, mem, 5);
+   // Deltas 3, 0, 4 are zigzag encoded to 6, 0, 8
+   EXPECT_EQ(6, splitBytes[0]);
+   EXPECT_EQ(0, splitBytes[1]);
+   EXPECT_EQ(8, splitBytes[2]);
+   ClusterSize_t unpacked[5];
+   element.Unpack(unpacked, splitBytes, 5);
+   for (unsigned i = 0; i < 5; ++i) {
+      EXPECT_EQ(mem[i], unpacked[i]);
+   }
+}
@@ -216,3 +216,305 @@ TEST(RPageSinkBuf, ParallelZip) {
       EXPECT_EQ("hi" + std::to_string(i), viewKlassVec(i).at(0).s);
    }
 }
+
+TEST(RPageSinkBuf, ParallelZipClusters)
+{
+   ROOT::EnableImplicitMT();
+
+   struct TestModel {
+      std::unique_ptr<RNTupleModel> fModel;
+      std::shared_ptr<float> fFloatField;
+      std::shared_ptr<std::vector<CustomStruct>> fFieldKlassVec;
+      TestModel() {
+         fModel = RNTupleModel::Create();
+         fFloatField = fModel->MakeField<float>("pt");
+         fFieldKlassVec = fModel->MakeField<std::vector<CustomStruct>>("klassVec");
+      }
+   };
+
+   FileRaii fileGuardBuf("test_ntuple_sinkbuf_pzip_clusters_buf.root");
+   FileRaii fileGuard("test_ntuple_sinkbuf_pzip_clusters.root");
+   {
+      RNTupleWriteOptions options;
+      options.SetComputeColumnStatistics(true);
+      TestModel bufModel;
+      auto ntupleBuf = std::make_unique<RNTupleWriter>(std::move(bufModel.fModel),
+         std::make_unique<RPageSinkBuf>(std::make_unique<RPageSinkFile>("ntpl", fileGuardBuf.GetPath(), options)));
+      TestModel unbufModel;
+      auto ntuple = std::make_unique<RNTupleWriter>(std::move(unbufModel.fModel),
+         std::make_unique<RPageSinkFile>("ntpl", fileGuard.GetPath(), options));
+
+      for (int i = 0; i < 50000; i++) {
+         *bufModel.fFloatField = static_cast<float>(i);
+         *unbufModel.fFloatField = static_cast<float>(i);
+         CustomStruct klass;
+         klass.a = 42.0;
+         klass.v1.emplace_back(static_cast<float>(i));
+         klass.s = "hi" + std::to_string(i);
+         *bufModel.fFieldKlassVec = std::vector<CustomStruct>{klass};
+         *unbufModel.fFieldKlassVec = std::vector<CustomStruct>{klass};
+         ntupleBuf->Fill();
+         ntuple->Fill();
+         if (i % 20000 == 19999) {
+            ntupleBuf->CommitCluster();
+            ntuple->CommitCluster();
+         }
+      }
+   }
+
+   // The pages sealed by the tasks of the buffered sink are the ones the unbuffered sink seals serially
+   auto ntupleBuf = RNTupleReader::Open("ntpl", fileGuardBuf.GetPath());
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   const auto &descBuf = ntupleBuf->GetDescriptor();
+   const auto &desc = ntuple->GetDescriptor();
+   ASSERT_EQ(3U, descBuf.GetNClusters());
+   ASSERT_EQ(desc.GetNClusters(), descBuf.GetNClusters());
+   ASSERT_EQ(desc.GetNColumns(), descBuf.GetNColumns());
+   for (std::size_t c = 0; c < descBuf.GetNClusters(); ++c) {
+      const auto &clusterBuf = descBuf.GetClusterDescriptor(c);
+      const auto &cluster = desc.GetClusterDescriptor(c);
+      EXPECT_EQ(cluster.GetNEntries(), clusterBuf.GetNEntries());
+      for (DescriptorId_t columnId = 0; columnId < descBuf.GetNColumns(); ++columnId) {
+         const auto &pagesBuf = clusterBuf.GetPageRange(columnId).fPageInfos;
+         const auto &pages = cluster.GetPageRange(columnId).fPageInfos;
+         ASSERT_EQ(pages.size(), pagesBuf.size());
+         for (std::size_t p = 0; p < pages.size(); ++p) {
+            EXPECT_EQ(pages[p].fNElements, pagesBuf[p].fNElements);
+            EXPECT_EQ(pages[p].fLocator.fBytesOnStorage, pagesBuf[p].fLocator.fBytesOnStorage);
+         }
+         ASSERT_EQ(cluster.HasColumnStatistics(columnId), clusterBuf.HasColumnStatistics(columnId));
+         if (cluster.HasColumnStatistics(columnId)) {
+            EXPECT_EQ(cluster.GetColumnStatistics(columnId).fMin, clusterBuf.GetColumnStatistics(columnId).fMin);
+            EXPECT_EQ(cluster.GetColumnStatistics(columnId).fMax, clusterBuf.GetColumnStatistics(columnId).fMax);
+         }
+      }
+   }
+   const auto ptColumnId = descBuf.FindColumnId(descBuf.FindFieldId("pt"), 0);
+   ASSERT_TRUE(descBuf.GetClusterDescriptor(1).HasColumnStatistics(ptColumnId));
+   EXPECT_EQ(20000.0, descBuf.GetClusterDescriptor(1).GetColumnStatistics(ptColumnId).fMin);
+   EXPECT_EQ(39999.0, descBuf.GetClusterDescriptor(1).GetColumnStatistics(ptColumnId).fMax);
+
+   auto viewPt = ntupleBuf->GetView<float>("pt");
+   auto viewKlassVec = ntupleBuf->GetView<std::vector<CustomStruct>>("klassVec");
+   for (auto i : ntupleBuf->GetEntryRange()) {
+      EXPECT_EQ(static_cast<float>(i), viewPt(i));
+      EXPECT_EQ(std::vector<float>{static_cast<float>(i)}, viewKlassVec(i).at(0).v1);
+      EXPECT_EQ("hi" + std::to_string(i), viewKlassVec(i).at(0).s);
+   }
+}
+
+TEST(RPageSourceFile, CoalesceReads)
+{
+   FileRaii fileGuard("test_ntuple_coalesce_reads.root");
+   {
+      auto model = RNTupleModel::Create();
+      std::vector<std::shared_ptr<float>> fields;
+      for (auto name : {"a", "b", "c", "d"})
+         fields.emplace_back(model->MakeField<float>(name));
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      options.SetNElementsPerPage(100);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (int i = 0; i < 1000; ++i) {
+         for (auto &f : fields)
+            *f = static_cast<float>(i);
+         ntuple->Fill();
+      }
+   }
+
+   // Reads the columns "a" and "c" through a raw file with emulated latency and returns the values of the
+   // nRead and nReadSaved counters
+   auto fnReadProjection = [&fileGuard](const RNTupleReadOptions &options) {
+      auto rawFile = std::make_unique<RRawFileLatency>(RRawFile::Create(fileGuard.GetPath()),
+                                                       std::chrono::microseconds(10));
+      auto ntuple = std::make_unique<RNTupleReader>(
+         std::make_unique<RPageSourceFile>("ntpl", std::move(rawFile), options));
+      ntuple->EnableMetrics();
+      auto viewA = ntuple->GetView<float>("a");
+      auto viewC = ntuple->GetView<float>("c");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_EQ(static_cast<float>(i), viewA(i));
+         EXPECT_EQ(static_cast<float>(i), viewC(i));
+      }
+      auto nRead = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nRead")->GetValueAsInt();
+      auto nReadSaved = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nReadSaved")->GetValueAsInt();
+      return std::make_pair(nRead, nReadSaved);
+   };
+
+   // 10 pages per column; consecutive pages of a column are separated by the key headers of the TFile container
+   RNTupleReadOptions options;
+   options.SetMaxReadOverhead(0);
+   auto counters = fnReadProjection(options);
+   EXPECT_EQ(20, counters.first);
+   EXPECT_EQ(0, counters.second);
+
+   options.SetMaxReadOverhead(0.25);
+   counters = fnReadProjection(options);
+   EXPECT_EQ(2, counters.first);
+   EXPECT_EQ(18, counters.second);
+
+   options.SetMaxReadGap(1);
+   counters = fnReadProjection(options);
+   EXPECT_EQ(20, counters.first);
+   EXPECT_EQ(0, counters.second);
+
+   options.SetMaxReadOverhead(10);
+   options.SetMaxReadGap(std::size_t(-1));
+   counters = fnReadProjection(options);
+   EXPECT_EQ(1, counters.first);
+   EXPECT_EQ(19, counters.second);
+}
+
+TEST(RPageSource, ColumnStatistics)
+{
+   FileRaii fileGuard("test_ntuple_column_statistics.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrId = model->MakeField<std::int64_t>("id");
+      auto wrTag = model->MakeField<std::string>("tag");
+      RNTupleWriteOptions options;
+      options.SetComputeColumnStatistics(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (int i = 0; i < 30; ++i) {
+         *wrPt = static_cast<float>(i);
+         *wrId = -i;
+         ntuple->Fill();
+         if ((i % 10) == 9)
+            ntuple->CommitCluster();
+      }
+      // NaN values are not part of the value range
+      *wrPt = std::numeric_limits<float>::quiet_NaN();
+      *wrId = 0;
+      ntuple->Fill();
+   }
+
+   RPageSourceFile source("ntpl", fileGuard.GetPath(), RNTupleReadOptions());
+   source.Attach();
+   const auto &desc = source.GetDescriptor();
+   ASSERT_EQ(4U, desc.GetNClusters());
+   const auto ptColumnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+   const auto idColumnId = desc.FindColumnId(desc.FindFieldId("id"), 0);
+   const auto tagOffsetColumnId = desc.FindColumnId(desc.FindFieldId("tag"), 0);
+
+   const auto &cluster1 = desc.GetClusterDescriptor(1);
+   ASSERT_TRUE(cluster1.HasColumnStatistics(ptColumnId));
+   EXPECT_EQ(10.0, cluster1.GetColumnStatistics(ptColumnId).fMin);
+   EXPECT_EQ(19.0, cluster1.GetColumnStatistics(ptColumnId).fMax);
+   ASSERT_TRUE(cluster1.HasColumnStatistics(idColumnId));
+   EXPECT_EQ(-19.0, cluster1.GetColumnStatistics(idColumnId).fMin);
+   EXPECT_EQ(-10.0, cluster1.GetColumnStatistics(idColumnId).fMax);
+   // The offset column of the string is not of arithmetic type
+   EXPECT_FALSE(cluster1.HasColumnStatistics(tagOffsetColumnId));
+   // The last cluster only has a NaN value and thus an empty range
+   const auto &cluster3 = desc.GetClusterDescriptor(3);
+   ASSERT_TRUE(cluster3.HasColumnStatistics(ptColumnId));
+   EXPECT_GT(cluster3.GetColumnStatistics(ptColumnId).fMin, cluster3.GetColumnStatistics(ptColumnId).fMax);
+
+   EXPECT_EQ(std::vector<DescriptorId_t>({1}), source.FindClustersInRange(ptColumnId, 12.5, 15.0));
+   EXPECT_EQ(std::vector<DescriptorId_t>({0, 1}), source.FindClustersInRange(ptColumnId, 9.0, 10.0));
+   EXPECT_EQ(std::vector<DescriptorId_t>({2}), source.FindClustersInRange(idColumnId, -100.0, -20.0));
+   EXPECT_TRUE(source.FindClustersInRange(ptColumnId, 100.0, 200.0).empty());
+   // Without statistics, clusters cannot be skipped
+   EXPECT_EQ(4U, source.FindClustersInRange(tagOffsetColumnId, 100.0, 200.0).size());
+}
+
+TEST(RPageSource, ColumnStatisticsReducedPrecision)
+{
+   FileRaii fileGuard("test_ntuple_column_statistics_reduced_precision.root");
+   {
+      auto model = RNTupleModel::Create();
+      // Two bits for [0, 10]: the stored values are 0, 10/3, 20/3, and 10
+      auto fieldPt = std::make_unique<RField<float>>("pt");
+      fieldPt->SetQuantization(0., 10., 2);
+      model->AddField(std::move(fieldPt));
+      auto wrPt = model->Get<float>("pt");
+      RNTupleWriteOptions options;
+      options.SetComputeColumnStatistics(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (float pt : {1.7f, 1.8f}) {
+         *wrPt = pt;
+         ntuple->Fill();
+      }
+      ntuple->CommitCluster();
+      *wrPt = 9.f;
+      ntuple->Fill();
+   }
+
+   RPageSourceFile source("ntpl", fileGuard.GetPath(), RNTupleReadOptions());
+   source.Attach();
+   const auto &desc = source.GetDescriptor();
+   ASSERT_EQ(2U, desc.GetNClusters());
+   const auto ptColumnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+
+   // The statistics cover the stored values, not the written ones
+   const auto &cluster0 = desc.GetClusterDescriptor(0);
+   ASSERT_TRUE(cluster0.HasColumnStatistics(ptColumnId));
+   EXPECT_FLOAT_EQ(10.f / 3, cluster0.GetColumnStatistics(ptColumnId).fMin);
+   EXPECT_FLOAT_EQ(10.f / 3, cluster0.GetColumnStatistics(ptColumnId).fMax);
+   EXPECT_FLOAT_EQ(10.f, desc.GetClusterDescriptor(1).GetColumnStatistics(ptColumnId).fMax);
+   EXPECT_EQ(std::vector<DescriptorId_t>({0}), source.FindClustersInRange(ptColumnId, 3.0, 4.0));
+   EXPECT_TRUE(source.FindClustersInRange(ptColumnId, 1.5, 2.0).empty());
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+   EXPECT_FLOAT_EQ(10.f / 3, viewPt(0));
+   EXPECT_FLOAT_EQ(10.f, viewPt(2));
+}
+
+TEST(RNTupleParallelWriter, Basics)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer.root");
+
+   constexpr int kNThreads = 4;
+   constexpr int kNEntriesPerThread = 25000;
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<int>("thread");
+      model->MakeField<int>("i");
+      model->MakeField<std::vector<float>>("vec");
+      RNTupleWriteOptions options;
+      options.SetNEntriesPerCluster(10000);
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t]() {
+            auto context = writer->CreateFillContext();
+            auto fieldThread = context->GetModel()->Get<int>("thread");
+            auto fieldI = context->GetModel()->Get<int>("i");
+            auto fieldVec = context->GetModel()->Get<std::vector<float>>("vec");
+            for (int i = 0; i < kNEntriesPerThread; ++i) {
+               *fieldThread = t;
+               *fieldI = i;
+               *fieldVec = std::vector<float>(i % 3, static_cast<float>(i));
+               context->Fill();
+            }
+         });
+      }
+      for (auto &t : threads)
+         t.join();
+      EXPECT_EQ(static_cast<NTupleSize_t>(kNThreads * kNEntriesPerThread), writer->GetNEntries());
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(static_cast<NTupleSize_t>(kNThreads * kNEntriesPerThread), ntuple->GetNEntries());
+   // 25000 entries per thread result in clusters of 10000, 10000, and 5000 entries
+   EXPECT_EQ(static_cast<std::size_t>(3 * kNThreads), ntuple->GetDescriptor().GetNClusters());
+
+   auto viewThread = ntuple->GetView<int>("thread");
+   auto viewI = ntuple->GetView<int>("i");
+   auto viewVec = ntuple->GetView<std::vector<float>>("vec");
+   // Entries of a given thread are written in order, but the clusters of different threads are interleaved
+   std::vector<int> nextI(kNThreads, 0);
+   for (auto i : ntuple->GetEntryRange()) {
+      auto t = viewThread(i);
+      ASSERT_GE(t, 0);
+      ASSERT_LT(t, kNThreads);
+      EXPECT_EQ(nextI[t], viewI(i));
+      EXPECT_EQ(std::vector<float>(nextI[t] % 3, static_cast<float>(nextI[t])), viewVec(i));
+      nextI[t]++;
+   }
+   for (auto n : nextI)
+      EXPECT_EQ(kNEntriesPerThread, n);
+}
@@ -106,3 +106,195 @@ TEST(RNTuple, Casting)
    reader->LoadEntry(0);
    EXPECT_EQ(42, *fieldCast);
 }
+
+TEST(RNTuple, SplitEncoding)
+{
+   FileRaii fileGuard("test_ntuple_split_encoding.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = std::make_unique<RField<float>>("pt");
+   fieldPt->SetColumnRepresentative({EColumnType::kSplitReal32});
+   model->AddField(std::move(fieldPt));
+   auto fieldRun = std::make_unique<RField<std::int64_t>>("run");
+   fieldRun->SetColumnRepresentative({EColumnType::kSplitInt64});
+   model->AddField(std::move(fieldRun));
+   auto fieldJets = std::make_unique<RField<std::vector<double>>>("jets");
+   fieldJets->SetColumnRepresentative({EColumnType::kSplitIndex});
+   model->AddField(std::move(fieldJets));
+   auto fieldName = std::make_unique<RField<std::string>>("name");
+   fieldName->SetColumnRepresentative({EColumnType::kSplitIndex, EColumnType::kByte});
+   model->AddField(std::move(fieldName));
+
+   auto pt = model->Get<float>("pt");
+   auto run = model->Get<std::int64_t>("run");
+   auto jets = model->Get<std::vector<double>>("jets");
+   auto name = model->Get<std::string>("name");
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (unsigned i = 0; i < 100; ++i) {
+         *pt = 0.5 * i;
+         *run = 1000 - std::int64_t(i);
+         *jets = std::vector<double>(i % 5, 1.0 * i);
+         *name = std::string(i % 3, 'x');
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = reader->GetDescriptor();
+   auto ptColumnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+   EXPECT_EQ(EColumnType::kSplitReal32, desc.GetColumnDescriptor(ptColumnId).GetModel().GetType());
+
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewRun = reader->GetView<std::int64_t>("run");
+   auto viewJets = reader->GetView<std::vector<double>>("jets");
+   auto viewName = reader->GetView<std::string>("name");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(0.5 * i, viewPt(i));
+      EXPECT_EQ(1000 - std::int64_t(i), viewRun(i));
+      EXPECT_EQ(std::vector<double>(i % 5, 1.0 * i), viewJets(i));
+      EXPECT_EQ(std::string(i % 3, 'x'), viewName(i));
+   }
+}
+
+TEST(RNTuple, SplitEncodingUnsupported)
+{
+   FileRaii fileGuard("test_ntuple_split_encoding_unsupported.root");
+
+   auto model = RNTupleModel::Create();
+   auto field = std::make_unique<RField<float>>("pt");
+   field->SetColumnRepresentative({EColumnType::kSplitReal64});
+   model->AddField(std::move(field));
+   try {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      FAIL() << "should not be able to store a float in a SplitReal64 column";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("is not supported by field"));
+   }
+}
+
+TEST(RNTuple, ReducedPrecision)
+{
+   FileRaii fileGuard("test_ntuple_reduced_precision.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldTrunc = std::make_unique<RField<float>>("trunc");
+   fieldTrunc->SetTruncation(10);
+   model->AddField(std::move(fieldTrunc));
+   auto fieldHalf = std::make_unique<RField<double>>("half");
+   fieldHalf->SetTruncation(7);
+   model->AddField(std::move(fieldHalf));
+   auto fieldSingle = std::make_unique<RField<double>>("single");
+   fieldSingle->SetTruncation(23);
+   model->AddField(std::move(fieldSingle));
+   auto fieldQuant = std::make_unique<RField<float>>("quant");
+   fieldQuant->SetQuantization(0., 10., 12);
+   model->AddField(std::move(fieldQuant));
+   auto fieldQuant8 = std::make_unique<RField<double>>("quant8");
+   fieldQuant8->SetQuantization(-1., 1., 8);
+   model->AddField(std::move(fieldQuant8));
+
+   auto trunc = model->Get<float>("trunc");
+   auto half = model->Get<double>("half");
+   auto single = model->Get<double>("single");
+   auto quant = model->Get<float>("quant");
+   auto quant8 = model->Get<double>("quant8");
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (unsigned i = 0; i < 100; ++i) {
+         *trunc = 1.0f + 0.001f * i;
+         *half = 100. + 0.5 * i;
+         *single = 1. / (i + 1);
+         *quant = 0.1f * i;
+         *quant8 = -1. + 0.02 * i;
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = reader->GetDescriptor();
+   auto getModel = [&desc](const std::string &fieldName) {
+      return desc.GetColumnDescriptor(desc.FindColumnId(desc.FindFieldId(fieldName), 0)).GetModel();
+   };
+   EXPECT_EQ(EColumnType::kReal32, getModel("trunc").GetType());
+   EXPECT_EQ(EColumnType::kReal64, getModel("half").GetType());
+   EXPECT_EQ(EColumnType::kReal64, getModel("single").GetType());
+   EXPECT_EQ(RColumnModel(EColumnType::kReal16, false, 12, 0., 10.), getModel("quant"));
+   EXPECT_EQ(RColumnModel(EColumnType::kReal8, false, 8, -1., 1.), getModel("quant8"));
+
+   auto viewTrunc = reader->GetView<float>("trunc");
+   auto viewHalf = reader->GetView<double>("half");
+   auto viewSingle = reader->GetView<double>("single");
+   auto viewQuant = reader->GetView<float>("quant");
+   auto viewQuant8 = reader->GetView<double>("quant8");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_NEAR(1.0f + 0.001f * i, viewTrunc(i), 1.0 / 1024);
+      EXPECT_NEAR(100. + 0.5 * i, viewHalf(i), (100. + 0.5 * i) / 128);
+      EXPECT_FLOAT_EQ(1. / (i + 1), viewSingle(i));
+      EXPECT_NEAR(0.1f * i, viewQuant(i), 10. / 4095);
+      EXPECT_NEAR(-1. + 0.02 * i, viewQuant8(i), 2. / 255);
+   }
+   // The truncated values have at most 10 significant mantissa bits
+   std::uint32_t bits;
+   float value = viewTrunc(42);
+   std::memcpy(&bits, &value, sizeof(bits));
+   EXPECT_EQ(0U, bits & 0x1fff);
+}
+
+TEST(RNTuple, ReducedPrecisionRange)
+{
+   FileRaii fileGuard("test_ntuple_reduced_precision_range.root");
+
+   // Truncated doubles keep the exponent range of double
+   auto model = RNTupleModel::Create();
+   auto fieldTrunc7 = std::make_unique<RField<double>>("trunc7");
+   fieldTrunc7->SetTruncation(7);
+   model->AddField(std::move(fieldTrunc7));
+   auto fieldTrunc23 = std::make_unique<RField<double>>("trunc23");
+   fieldTrunc23->SetTruncation(23);
+   model->AddField(std::move(fieldTrunc23));
+   auto trunc7 = model->Get<double>("trunc7");
+   auto trunc23 = model->Get<double>("trunc23");
+   const std::vector<double> values{1e300, -1e300, 1e-300, -1e-300, std::numeric_limits<double>::max()};
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (auto v : values) {
+         *trunc7 = v;
+         *trunc23 = v;
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   auto viewTrunc7 = reader->GetView<double>("trunc7");
+   auto viewTrunc23 = reader->GetView<double>("trunc23");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_TRUE(std::isfinite(viewTrunc7(i)));
+      EXPECT_TRUE(std::isfinite(viewTrunc23(i)));
+      EXPECT_NEAR(values[i], viewTrunc7(i), std::abs(values[i]) / 128);
+      EXPECT_NEAR(values[i], viewTrunc23(i), std::abs(values[i]) / (1 << 23));
+      EXPECT_NE(0., viewTrunc7(i));
+      EXPECT_NE(0., viewTrunc23(i));
+   }
+}
+
+TEST(RNTuple, ReducedPrecisionInvalid)
+{
+   RField<float> field("pt");
+   EXPECT_THROW(field.SetTruncation(0), RException);
+   EXPECT_THROW(field.SetTruncation(24), RException);
+   EXPECT_THROW(field.SetQuantization(1., 0., 8), RException);
+   EXPECT_THROW(field.SetQuantization(0., 1., 17), RException);
+
+   FileRaii fileGuard("test_ntuple_reduced_precision_invalid.root");
+   auto model = RNTupleModel::Create();
+   auto fieldReal8 = std::make_unique<RField<float>>("pt");
+   fieldReal8->SetColumnRepresentative({EColumnType::kReal8});
+   model->AddField(std::move(fieldReal8));
+   try {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      FAIL() << "8 bit columns should require a value range";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("requires SetQuantization()"));
+   }
+}
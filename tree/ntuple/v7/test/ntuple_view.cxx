@@ -132,6 +132,62 @@ TEST(RNTuple, BulkViewCollection)
    }
 }
 
+TEST(RNTuple, ReadBulk)
+{
+   FileRaii fileGuard("test_ntuple_read_bulk.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto fieldStr = model->MakeField<std::string>("str");
+   {
+      RNTupleWriteOptions opt;
+      opt.SetNElementsPerPage(1000);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 10'000; i++) {
+         *fieldPt = static_cast<float>(i);
+         *fieldStr = std::to_string(i);
+         ntuple->Fill();
+         if (i == 4999)
+            ntuple->CommitCluster();
+      }
+   }
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewStr = ntuple->GetView<std::string>("str");
+
+   // The range crosses page and cluster boundaries
+   std::vector<float> pts(3000);
+   viewPt.ReadBulk(3500, pts.size(), pts.data());
+   for (std::size_t i = 0; i < pts.size(); i++) {
+      ASSERT_EQ(static_cast<float>(3500 + i), pts[i]) << i;
+   }
+
+   std::vector<std::string> strs(1500);
+   viewStr.ReadBulk(4000, strs.size(), strs.data());
+   for (std::size_t i = 0; i < strs.size(); i++) {
+      ASSERT_EQ(std::to_string(4000 + i), strs[i]) << i;
+   }
+
+   // Zero-copy access through the type-erased field interface
+   auto source = std::make_unique<RPageSourceFile>("myNTuple", fileGuard.GetPath(), RNTupleReadOptions());
+   source->Attach();
+   auto fieldPtRead = std::unique_ptr<RFieldBase>(RFieldBase::Create("pt", "float").Unwrap());
+   fieldPtRead->SetOnDiskId(source->GetDescriptor().FindFieldId("pt"));
+   fieldPtRead->ConnectPageSource(*source);
+   NTupleSize_t nItems = 0;
+   auto mapped = static_cast<const float *>(fieldPtRead->MapBulk(5990, nItems));
+   ASSERT_EQ(10U, nItems);
+   for (NTupleSize_t i = 0; i < nItems; i++) {
+      EXPECT_EQ(static_cast<float>(5990 + i), mapped[i]);
+   }
+
+   auto fieldStrRead = std::unique_ptr<RFieldBase>(RFieldBase::Create("str", "std::string").Unwrap());
+   fieldStrRead->SetOnDiskId(source->GetDescriptor().FindFieldId("str"));
+   fieldStrRead->ConnectPageSource(*source);
+   EXPECT_EQ(nullptr, fieldStrRead->MapBulk(0, nItems));
+   EXPECT_EQ(0U, nItems);
+}
+
 TEST(RNTuple, Composable)
 {
    FileRaii fileGuard("test_ntuple_composable.root");
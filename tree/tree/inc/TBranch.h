@@ -41,6 +41,7 @@ class TFile;
 class TClonesArray;
 class TTreeCloner;
 class TTreeCache;
+struct R__ZSTDDictionary;
 
 namespace ROOT {
 namespace Experimental {
@@ -50,6 +51,7 @@ class TBulkBranchRead;
 }
 namespace Internal {
 class TBranchIMTHelper; ///< A helper class for managing IMT work during TTree:Fill operations.
+struct TBranchZstdTrainer; ///< The content of the first baskets of a branch, used to train its ZSTD dictionary.
 }
 }
 
@@ -143,6 +145,10 @@ protected:
    char       *fAddress;          ///<! Address of 1st leaf (variable or object)
    TDirectory *fDirectory;        ///<! Pointer to directory where this branch buffers are stored
    TString     fFileName;         ///<  Name of file where buffers are stored ("" if in same file as Tree header)
+   Int_t       fZstdDictionarySize{0};    ///<  Size of the ZSTD dictionary of the baskets
+   char       *fZstdDictionary{nullptr};  ///<[fZstdDictionarySize] ZSTD dictionary of the baskets (kZSTDDictionary compression)
+   R__ZSTDDictionary *fZstdDictionaryHandle{nullptr}; ///<! fZstdDictionary digested for compression and decompression
+   ROOT::Internal::TBranchZstdTrainer *fZstdTrainer{nullptr}; ///<! Samples used to train fZstdDictionary
    TBuffer    *fEntryBuffer;      ///<! Buffer used to directly pass the content without streaming
    TBuffer    *fTransientBuffer;  ///<! Pointer to the current transient buffer.
    TList      *fBrowsables;       ///<! List of TVirtualBranchBrowsables used for Browse()
@@ -182,6 +188,7 @@ private:
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
    Int_t    WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *);
+   void     CopyZstdDictionary(const TBranch &from);
    TBranch(const TBranch&) = delete;             // not implemented
    TBranch& operator=(const TBranch&) = delete;  // not implemented
 
@@ -235,6 +242,8 @@ public:
            Long64_t  GetTotalSize(Option_t *option="")   const;
            Long64_t  GetTotBytes(Option_t *option="")    const;
            Long64_t  GetZipBytes(Option_t *option="")    const;
+           Int_t     GetZstdDictionarySize() const {return fZstdDictionarySize;}
+   const R__ZSTDDictionary *GetZstdDictionary() const {return fZstdDictionaryHandle;}
            Long64_t  GetEntryNumber() const {return fEntryNumber;}
            Long64_t  GetFirstEntry()  const {return fFirstEntry; }
          TIOFeatures GetIOFeatures() const;
@@ -257,6 +266,7 @@ public:
    virtual Int_t     LoadBaskets();
    virtual void      Print(Option_t *option="") const;
            void      PrintCacheInfo() const;
+   const R__ZSTDDictionary *PrepareZstdDictionary(const char *buffer, Int_t size);
    virtual void      ReadBasket(TBuffer &b);
    virtual void      Refresh(TBranch *b);
    virtual void      Reset(Option_t *option="");
@@ -288,7 +298,7 @@ public:
 
    static  void      ResetCount();
 
-   ClassDef(TBranch, 13); // Branch descriptor
+   ClassDef(TBranch, 14); // Branch descriptor
 };
 
 //______________________________________________________________________________
@@ -33,6 +33,7 @@ class TTreeCloner {
 
    Bool_t     fIsValid;
    Bool_t     fNeedConversion;   ///< True if the fast merge is not possible but a slow merge might possible.
+   Bool_t     fNeedRecompression; ///< True if the fast merge is not possible only because the baskets must be recompressed.
    UInt_t     fOptions;
    TTree     *fFromTree;
    TTree     *fToTree;
@@ -87,6 +88,9 @@ class TTreeCloner {
    void CreateCache();
    UInt_t FillCache(UInt_t from);
    void RestoreCache();
+#ifdef R__USE_IMT
+   void WriteBasketsPipelined();
+#endif
 
 private:
    TTreeCloner(const TTreeCloner&) = delete;
@@ -99,7 +103,8 @@ public:
       kNone       = 0,
       kNoWarnings = BIT(1),
       kIgnoreMissingTopLevel = BIT(2),
-      kNoFileCache = BIT(3)
+      kNoFileCache = BIT(3),
+      kRequireSameCompression = BIT(4) ///< Refuse (with NeedConversion) branches whose compression settings differ
    };
 
    TTreeCloner(TTree *from, TTree *to, Option_t *method, UInt_t options = kNone);
@@ -119,6 +124,7 @@ public:
    Bool_t Exec();
    Bool_t IsValid() { return fIsValid; }
    Bool_t NeedConversion() { return fNeedConversion; }
+   Bool_t NeedRecompression() const { return fNeedRecompression; }
    void   SetCacheSize(Int_t size);
    void   SortBaskets();
    void   WriteBaskets();
@@ -543,7 +543,8 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       // Read from the file and unstream the header information.
       TVirtualPerfStats* temp = gPerfStats;
       if (fBranch->GetTree()->GetPerfStats() != 0) gPerfStats = fBranch->GetTree()->GetPerfStats();
-      R__LOCKGUARD_IMT(gROOTMutex);  // Lock for parallel TTree I/O
+      // Lock for parallel TTree I/O, unless the file serializes its reads itself
+      R__LOCKGUARD_IMT((file->IsConcurrentRead() ? nullptr : gROOTMutex));
       if (file->ReadBuffer(readBufferRef->Buffer(),pos,len)) {
          gPerfStats = temp;
          return 1;
@@ -618,7 +619,8 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
             goto AfterBuffer;
          }
 
-         R__unzip(&nin, rawCompressedObjectBuffer, &nbuf, (unsigned char*) rawUncompressedObjectBuffer, &nout);
+         R__unzipWithZSTDDictionary(fBranch->GetZstdDictionary(), &nin, rawCompressedObjectBuffer, &nbuf,
+                                    (unsigned char*) rawUncompressedObjectBuffer, &nout);
          if (!nout) break;
          noutot += nout;
          nintot += nin;
@@ -1228,6 +1230,9 @@ Int_t TBasket::WriteBuffer()
       fBuffer = fCompressedBufferRef->Buffer();
       char *objbuf = fBufferRef->Buffer() + fKeylen;
       char *bufcur = &fBuffer[fKeylen];
+      const R__ZSTDDictionary *zstdDictionary = nullptr;
+      if (cxAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kZSTDDictionary)
+         zstdDictionary = fBranch->PrepareZstdDictionary(objbuf, fObjlen);
       noutot = 0;
       nzip   = 0;
       for (Int_t i = 0; i < nbuffers; ++i) {
@@ -1242,7 +1247,10 @@ Int_t TBasket::WriteBuffer()
          // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
          // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
          // (see fCompressedBufferRef in constructor).
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
+         if (zstdDictionary)
+            R__zipZSTDDictionary(zstdDictionary, cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout);
+         else
+            R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
 #ifdef R__USE_IMT
          sentry.lock();
 #endif  // R__USE_IMT
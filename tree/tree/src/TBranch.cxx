@@ -53,11 +53,33 @@
 
 #include "ROOT/TIOFeatures.hxx"
 
+#include "RZip.h"
+
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <cstdio>
-
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+struct TBranchZstdTrainer {
+   std::vector<char> fSamples;        ///< Content of the first baskets, one after the other
+   std::vector<size_t> fSampleSizes;  ///< Size of each sample
+   Bool_t fDone = kFALSE;             ///< Whether the training was attempted already
+};
+} // namespace Internal
+} // namespace ROOT
+
+namespace {
+// Parameters of the training of the ZSTD dictionaries of the branches.
+constexpr size_t kZstdTrainingSamples = 64;          // Number of baskets used to train a dictionary...
+constexpr size_t kZstdTrainingBytes = 1024 * 1024;   // ... unless their content reaches this size first
+constexpr size_t kZstdMaxSampleSize = 128 * 1024;    // Only the beginning of larger baskets is used
+constexpr size_t kZstdMaxDictionarySize = 64 * 1024;
+constexpr size_t kZstdMinDictionarySize = 1024;
+} // anonymous namespace
 
 Int_t TBranch::fgCount = 0;
 
@@ -464,6 +486,13 @@ TBranch::~TBranch()
    delete [] fBasketBytes;
    fBasketBytes = 0;
 
+   delete [] fZstdDictionary;
+   fZstdDictionary = nullptr;
+   R__deleteZSTDDictionary(fZstdDictionaryHandle);
+   fZstdDictionaryHandle = nullptr;
+   delete fZstdTrainer;
+   fZstdTrainer = nullptr;
+
    fBaskets.Delete();
    fNBaskets = 0;
    fCurrentBasket = 0;
@@ -2366,6 +2395,79 @@ void TBranch::PrintCacheInfo() const
    fCacheInfo.Print(GetName(), fBasketEntry);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the ZSTD dictionary a basket of this branch must be compressed
+/// with, or nullptr if it must be compressed without dictionary.
+///
+/// This is used with the kZSTDDictionary compression algorithm: the content of
+/// the first baskets of the branch is kept until there is enough of it to train
+/// a dictionary, which is then used for all the following baskets. The
+/// dictionary is stored with the branch, and the baskets are uncompressed with
+/// the dictionary of their branch (see GetZstdDictionary). If the training
+/// fails, for instance because the baskets are too few or too small, the
+/// baskets are compressed without dictionary.
+///
+/// \param[in] buffer The uncompressed content of the basket.
+/// \param[in] size The size of the uncompressed content.
+
+const R__ZSTDDictionary *TBranch::PrepareZstdDictionary(const char *buffer, Int_t size)
+{
+   if (fZstdDictionarySize > 0) {
+      // The dictionary was trained, or read or copied from another branch.
+      if (!fZstdDictionaryHandle)
+         fZstdDictionaryHandle = R__createZSTDDictionary(fZstdDictionary, fZstdDictionarySize, GetCompressionLevel());
+      return fZstdDictionaryHandle;
+   }
+
+   if (!fZstdTrainer)
+      fZstdTrainer = new ROOT::Internal::TBranchZstdTrainer;
+   auto &trainer = *fZstdTrainer;
+   if (trainer.fDone || size <= 0)
+      return nullptr;
+
+   const auto sampleSize = std::min<size_t>(size, kZstdMaxSampleSize);
+   trainer.fSamples.insert(trainer.fSamples.end(), buffer, buffer + sampleSize);
+   trainer.fSampleSizes.push_back(sampleSize);
+   if (trainer.fSampleSizes.size() < kZstdTrainingSamples && trainer.fSamples.size() < kZstdTrainingBytes)
+      return nullptr;
+
+   trainer.fDone = kTRUE;
+   std::vector<char> dictionary(
+      std::min(kZstdMaxDictionarySize, std::max(kZstdMinDictionarySize, trainer.fSamples.size() / 10)));
+   const auto dictionarySize = R__trainZSTDDictionary(dictionary.data(), dictionary.size(), trainer.fSamples.data(),
+                                                      trainer.fSampleSizes.data(), trainer.fSampleSizes.size());
+   std::vector<char>().swap(trainer.fSamples);
+   std::vector<size_t>().swap(trainer.fSampleSizes);
+   if (dictionarySize == 0)
+      return nullptr;
+
+   fZstdDictionaryHandle = R__createZSTDDictionary(dictionary.data(), dictionarySize, GetCompressionLevel());
+   if (fZstdDictionaryHandle) {
+      fZstdDictionarySize = dictionarySize;
+      fZstdDictionary = new char[dictionarySize];
+      memcpy(fZstdDictionary, dictionary.data(), dictionarySize);
+   }
+   return fZstdDictionaryHandle;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Use the ZSTD dictionary of the branch 'from', for instance because its
+/// baskets are copied as they are into this branch.
+
+void TBranch::CopyZstdDictionary(const TBranch &from)
+{
+   delete [] fZstdDictionary;
+   fZstdDictionary = nullptr;
+   R__deleteZSTDDictionary(fZstdDictionaryHandle);
+   fZstdDictionaryHandle = nullptr;
+   fZstdDictionarySize = from.fZstdDictionarySize;
+   if (fZstdDictionarySize > 0) {
+      fZstdDictionary = new char[fZstdDictionarySize];
+      memcpy(fZstdDictionary, from.fZstdDictionary, fZstdDictionarySize);
+      fZstdDictionaryHandle = R__createZSTDDictionary(fZstdDictionary, fZstdDictionarySize, GetCompressionLevel());
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Loop on all leaves of this branch to read Basket buffer.
 
@@ -2452,6 +2554,7 @@ void TBranch::Refresh(TBranch* b)
       fBasketEntry[i] = b->fBasketEntry[i];
       fBasketSeek[i]  = b->fBasketSeek[i];
    }
+   CopyZstdDictionary(*b);
    fBaskets.Delete();
    Int_t nbaskets = b->fBaskets.GetSize();
    fBaskets.Expand(nbaskets);
@@ -2890,6 +2993,12 @@ void TBranch::Streamer(TBuffer& b)
       if (v > 9) {
          b.ReadClassBuffer(TBranch::Class(), this, v, R__s, R__c);
 
+         // The baskets compressed with the dictionary are uncompressed with this handle, see TBasket::ReadBasketBuffers.
+         R__deleteZSTDDictionary(fZstdDictionaryHandle);
+         fZstdDictionaryHandle = nullptr;
+         if (fZstdDictionarySize > 0)
+            fZstdDictionaryHandle = R__createZSTDDictionary(fZstdDictionary, fZstdDictionarySize, GetCompressionLevel());
+
          if (fWriteBasket>=fBaskets.GetSize()) {
             fBaskets.Expand(fWriteBasket+1);
          }
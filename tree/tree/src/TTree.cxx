@@ -3483,6 +3483,11 @@ namespace {
 ///
 /// See TTree::CloneTree for a detailed explanation of the semantics of these 3 options.
 ///
+/// When 'fast' is specified together with 'recompress', the baskets of the
+/// underlying TTree objects whose compression settings differ from the ones of
+/// this tree are unzipped and re-compressed, while the baskets of the others
+/// are still copied as raw bytes.
+///
 /// If the tree or any of the underlying tree of the chain has an index, that index and any
 /// index in the subsequent underlying TTree objects will be merged.
 ///
@@ -3503,6 +3508,7 @@ Long64_t TTree::CopyEntries(TTree* tree, Long64_t nentries /* = -1 */, Option_t*
    TString opt = option;
    opt.ToLower();
    Bool_t fastClone = opt.Contains("fast");
+   Bool_t recompress = opt.Contains("recompress");
    Bool_t withIndex = !opt.Contains("noindex");
    EOnIndexError onIndexError;
    if (opt.Contains("asisindex")) {
@@ -3559,13 +3565,16 @@ Long64_t TTree::CopyEntries(TTree* tree, Long64_t nentries /* = -1 */, Option_t*
                }
             }
          }
-         TTreeCloner cloner(tree->GetTree(), this, option, TTreeCloner::kNoWarnings);
+         UInt_t clonerOptions = TTreeCloner::kNoWarnings;
+         if (recompress)
+            clonerOptions |= TTreeCloner::kRequireSameCompression;
+         TTreeCloner cloner(tree->GetTree(), this, option, clonerOptions);
          if (cloner.IsValid()) {
             this->SetEntries(this->GetEntries() + tree->GetTree()->GetEntries());
             if (cacheSize != -1) cloner.SetCacheSize(cacheSize);
             cloner.Exec();
          } else {
-            if (i == 0) {
+            if (i == 0 && !cloner.NeedRecompression()) {
                Warning("CopyEntries","%s",cloner.GetWarning());
                // If the first cloning does not work, something is really wrong
                // (since apriori the source and target are exactly the same structure!)
@@ -6878,7 +6887,10 @@ Long64_t TTree::Merge(TCollection* li, TFileMergeInfo *info)
          SetDirectory(info->fOutputDirectory);
          FlushBasketsImpl();
          fDirectory->WriteTObject(this);
-      } else if (info->fOptions.Contains("fast")) {
+      } else if (info->fOptions.Contains("fast") &&
+                 !(info->fOptions.Contains("recompress") &&
+                   GetCurrentFile()->GetCompressionSettings() !=
+                      info->fOutputDirectory->GetFile()->GetCompressionSettings())) {
          InPlaceClone(info->fOutputDirectory);
       } else {
          TDirectory::TContext ctxt(info->fOutputDirectory);
@@ -36,6 +36,7 @@ A TTreeCache which exploits parallelized decompression of its own content.
 
 extern "C" void R__unzip(Int_t *nin, UChar_t *bufin, Int_t *lout, char *bufout, Int_t *nout);
 extern "C" int R__unzip_header(Int_t *nin, UChar_t *bufin, Int_t *lout);
+extern "C" unsigned int R__getZSTDDictionaryID(int srcsize, const unsigned char *src);
 
 TTreeCacheUnzip::EParUnzipMode TTreeCacheUnzip::fgParallel = TTreeCacheUnzip::kDisable;
 
@@ -910,6 +911,13 @@ Int_t TTreeCacheUnzip::UnzipBuffer(char **dest, char *src)
             return uzlen;
          }
 
+         // Only the basket knows the branch whose ZSTD dictionary is needed, let it uncompress the buffer
+         if (R__getZSTDDictionaryID(nin, bufcur) != 0) {
+            if (alloc) delete [] *dest;
+            *dest = 0;
+            return -1;
+         }
+
          R__unzip(&nin, bufcur, &nbuf, objbuf, &nout);
 
          if (gDebug > 2)
@@ -37,6 +37,14 @@ Class implementing or helping  the various TTree cloning method
 #include "snprintf.h"
 
 #include <algorithm>
+#include <cstring>
+
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#include "TROOT.h"
+#include <memory>
+#include <vector>
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -128,6 +136,7 @@ TTreeCloner::TTreeCloner(TTree *from, TTree *to, TDirectory *newdirectory, Optio
    fWarningMsg(),
    fIsValid(kTRUE),
    fNeedConversion(kFALSE),
+   fNeedRecompression(kFALSE),
    fOptions(options),
    fFromTree(from),
    fToTree(to),
@@ -345,6 +354,39 @@ UInt_t TTreeCloner::CollectBranches(TBranch *from, TBranch *to) {
 
    }
 
+   if ((fOptions & kRequireSameCompression) && from->GetCompressionSettings() != to->GetCompressionSettings()) {
+      // The baskets would have to be decompressed and compressed again, we can not do a fast merge.
+      fWarningMsg.Form("The export branch and the import branch (%s) do not have the same compression settings (%d vs %d)",
+                       from->GetName(), to->GetCompressionSettings(), from->GetCompressionSettings());
+      if (!(fOptions & kNoWarnings)) {
+         Warning("TTreeCloner::CollectBranches", "%s", fWarningMsg.Data());
+      }
+      fIsValid = kFALSE;
+      fNeedConversion = kTRUE;
+      fNeedRecompression = kTRUE;
+      return 0;
+   }
+
+   if (!IsInPlace() && (from->fZstdDictionarySize != to->fZstdDictionarySize ||
+                        (from->fZstdDictionarySize > 0 &&
+                         memcmp(from->fZstdDictionary, to->fZstdDictionary, from->fZstdDictionarySize) != 0))) {
+      if (to->GetEntries() == 0 && to->fZstdDictionarySize == 0) {
+         // The baskets copied into the (still empty) output branch will be uncompressed with the input dictionary.
+         to->CopyZstdDictionary(*from);
+      } else {
+         // The baskets were compressed with a ZSTD dictionary that the output branch does not use.
+         fWarningMsg.Form("The export branch and the import branch (%s) do not use the same ZSTD dictionary",
+                          from->GetName());
+         if (!(fOptions & kNoWarnings)) {
+            Warning("TTreeCloner::CollectBranches", "%s", fWarningMsg.Data());
+         }
+         fIsValid = kFALSE;
+         fNeedConversion = kTRUE;
+         fNeedRecompression = kTRUE;
+         return 0;
+      }
+   }
+
    fFromBranches.AddLast(from);
    if (!from->TestBit(TBranch::kDoNotUseBufferMap)) {
       // Make sure that we reset the Buffer's map if needed.
@@ -724,6 +766,12 @@ UInt_t TTreeCloner::FillCache(UInt_t from)
 
 void TTreeCloner::WriteBaskets()
 {
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && !IsInPlace() && fMaxBaskets > 1) {
+      WriteBasketsPipelined();
+      return;
+   }
+#endif
    TBasket *basket = new TBasket();
    for(UInt_t j = 0, notCached = 0; j<fMaxBaskets; ++j) {
       TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
@@ -776,3 +824,87 @@ void TTreeCloner::WriteBaskets()
    }
    delete basket;
 }
+
+#ifdef R__USE_IMT
+////////////////////////////////////////////////////////////////////////////////
+/// Transfer the basket from the input file to the output file, reading the
+/// raw baskets of the next chunk in a separate task while the baskets of the
+/// current chunk are written out.
+///
+/// Only that task reads from the input file and only the calling thread
+/// writes to the output file, in the same order as WriteBaskets does, so the
+/// content of the output file does not depend on the scheduling.
+
+void TTreeCloner::WriteBasketsPipelined()
+{
+   // Minimal number of bytes read in one go, if the file cache is smaller or disabled.
+   constexpr Long64_t kMinChunkBytes = 16 * 1024 * 1024;
+
+   struct RChunk {
+      UInt_t fBegin = 0; ///< First position in fBasketIndex covered by this chunk
+      UInt_t fEnd = 0;   ///< One past the last position in fBasketIndex covered by this chunk
+      std::vector<std::unique_ptr<TBasket>> fBaskets; ///< Raw baskets, reused from one chunk to the next
+   };
+
+   const Long64_t chunkBytes = std::max<Long64_t>(kMinChunkBytes, fFileCache ? fFileCache->GetBufferSize() : 0);
+   UInt_t notCached = 0;
+
+   auto readChunk = [&](RChunk &chunk, UInt_t begin) {
+      chunk.fBegin = begin;
+      Long64_t size = 0;
+      UInt_t j = begin;
+      for (; j < fMaxBaskets && (j == begin || size < chunkBytes); ++j) {
+         if (chunk.fBaskets.size() <= j - begin)
+            chunk.fBaskets.emplace_back(new TBasket());
+         TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+         Int_t index = fBasketNum[ fBasketIndex[j] ];
+         Long64_t pos = from->GetBasketSeek(index);
+         if (pos == 0)
+            continue; // Still in memory, handled by the writer.
+         if (fFileCache && j >= notCached) {
+            notCached = FillCache(notCached);
+         }
+         TBasket *basket = chunk.fBaskets[j - begin].get();
+         if (from->GetBasketBytes()[index] == 0) {
+            from->GetBasketBytes()[index] = basket->ReadBasketBytes(pos, from->GetFile(0));
+         }
+         Int_t len = from->GetBasketBytes()[index];
+         basket->LoadBasketBuffers(pos, len, from->GetFile(0), fFromTree);
+         size += len;
+      }
+      chunk.fEnd = j;
+   };
+
+   auto writeChunk = [&](RChunk &chunk) {
+      for (UInt_t j = chunk.fBegin; j < chunk.fEnd; ++j) {
+         TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+         TBranch *to   = (TBranch*)fToBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+         Int_t index = fBasketNum[ fBasketIndex[j] ];
+         if (from->GetBasketSeek(index) != 0) {
+            TBasket *basket = chunk.fBaskets[j - chunk.fBegin].get();
+            basket->IncrementPidOffset(fPidOffset);
+            basket->CopyTo(fToFile);
+            to->AddBasket(*basket,kTRUE,fToStartEntries + from->GetBasketEntry()[index]);
+         } else {
+            TBasket *frombasket = from->GetBasket( index );
+            if (frombasket && frombasket->GetNevBuf()>0) {
+               TBasket *tobasket = (TBasket*)frombasket->Clone();
+               tobasket->SetBranch(to);
+               to->AddBasket(*tobasket, kFALSE, fToStartEntries+from->GetBasketEntry()[index]);
+               to->FlushOneBasket(to->GetWriteBasket());
+            }
+         }
+      }
+   };
+
+   RChunk chunks[2];
+   readChunk(chunks[0], 0);
+   for (UInt_t current = 0; chunks[current].fBegin < chunks[current].fEnd; current = 1 - current) {
+      RChunk &next = chunks[1 - current];
+      ROOT::Experimental::TTaskGroup reader;
+      reader.Run([&]() { readChunk(next, chunks[current].fEnd); });
+      writeChunk(chunks[current]);
+      reader.Wait();
+   }
+}
+#endif
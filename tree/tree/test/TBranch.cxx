@@ -2,6 +2,7 @@
 #include "TTree.h"
 #include "TBranch.h"
 #include "TRandom.h"
+#include "TSystem.h"
 
 #include "gtest/gtest.h"
 
@@ -229,4 +230,48 @@ TEST_F(TBranchTest, branchInheritsCompression)
 {
    for(int mode = 4; mode >= 0; --mode)
       ASSERT_TRUE(nocomp(mode)) << "Failed for mode: " << mode;
-}
\ No newline at end of file
+}
+
+TEST_F(TBranchTest, zstdDictionaryCompression)
+{
+   // Write the same small baskets with the given algorithm, return the compressed size of the tree
+   auto writeTree = [](const char *fname, ROOT::RCompressionSetting::EAlgorithm::EValues algorithm) {
+      TFile f(fname, "RECREATE", "", ROOT::RCompressionSetting::EDefaults::kUseGeneralPurpose);
+      f.SetCompressionAlgorithm(algorithm);
+      TTree t("t", "t");
+      Int_t value = 0;
+      // Small baskets, so that the dictionary is trained and used for most of them.
+      t.Branch("value", &value)->SetBasketSize(1000);
+      for (Int_t i = 0; i < 100000; ++i) {
+         value = i % 1000;
+         t.Fill();
+      }
+      f.Write();
+      return t.GetZipBytes();
+   };
+   const char *fnamePlain = "TBranchTestZstdPlain.root";
+   const char *fname = "TBranchTestZstdDictionary.root";
+   const auto zipBytesPlain = writeTree(fnamePlain, ROOT::RCompressionSetting::EAlgorithm::kZSTD);
+   const auto zipBytes = writeTree(fname, ROOT::RCompressionSetting::EAlgorithm::kZSTDDictionary);
+   EXPECT_LT(zipBytes, zipBytesPlain);
+
+   {
+      TFile f(fname);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      EXPECT_GT(t->GetBranch("value")->GetZstdDictionarySize(), 0);
+      EXPECT_EQ(t->GetZipBytes(), zipBytes);
+      EXPECT_LT(t->GetZipBytes(), t->GetTotBytes());
+      Int_t value = -1;
+      t->SetBranchAddress("value", &value);
+      for (Long64_t i = 0; i < t->GetEntries(); ++i) {
+         ASSERT_GT(t->GetEntry(i), 0);
+         ASSERT_EQ(value, i % 1000);
+      }
+      EXPECT_EQ(t->GetEntries(), 100000);
+      t->ResetBranchAddresses();
+   }
+
+   gSystem->Unlink(fnamePlain);
+   gSystem->Unlink(fname);
+}
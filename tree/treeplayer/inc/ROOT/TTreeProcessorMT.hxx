@@ -26,6 +26,8 @@
 #include "ROOT/InternalTreeUtils.hxx" // RFriendInfo
 
 #include <functional>
+#include <mutex>
+#include <string>
 #include <vector>
 
 /** \class TTreeView
@@ -72,6 +74,16 @@ public:
 } // End of namespace Internal
 
 class TTreeProcessorMT {
+public:
+   /// The timing of a task run by Process(), see GetTaskTimings()
+   struct RTaskTiming {
+      std::string fFileName; ///< The file whose entries were processed by the task
+      Long64_t fStart;       ///< The first entry of the task, as passed to TTreeReader::SetEntriesRange
+      Long64_t fEnd;         ///< The entry after the last entry of the task
+      double fStartTime;     ///< The time at which the task started, in seconds since the beginning of Process()
+      double fRealTime;      ///< The wall-clock time spent in the task, in seconds
+   };
+
 private:
    const std::vector<std::string> fFileNames; ///< Names of the files
    const std::vector<std::string> fTreeNames; ///< TTree names (always same size and ordering as fFileNames)
@@ -84,6 +96,9 @@ private:
    // Must be declared after fPool, for IMT to be initialized first!
    ROOT::TThreadedObject<ROOT::Internal::TTreeView> fTreeView{TNumSlots{ROOT::GetThreadPoolSize()}};
 
+   std::vector<RTaskTiming> fTaskTimings; ///< The timings of the tasks run by the last call to Process()
+   std::mutex fTaskTimingsMutex;          ///<! Serializes the insertions into fTaskTimings
+
    std::vector<std::string> FindTreeNames();
    static unsigned int fgMaxTasksPerFilePerWorker;
    static unsigned int fgTasksPerWorkerHint;
@@ -96,6 +111,7 @@ public:
    TTreeProcessorMT(TTree &tree, UInt_t nThreads = 0u);
 
    void Process(std::function<void(TTreeReader &)> func);
+   const std::vector<RTaskTiming> &GetTaskTimings() const;
 
    static void SetTasksPerWorkerHint(unsigned int m);
    static unsigned int GetTasksPerWorkerHint();
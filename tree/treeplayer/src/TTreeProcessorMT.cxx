@@ -22,11 +22,21 @@ The implementation of ROOT::TTreeProcessorMT parallelizes the processing of the
 each corresponding to a cluster in the TTree. This is possible thanks to the use
 of a ROOT::TThreadedObject, so that each thread works with its own TFile and TTree
 objects.
+
+The metadata of all input files is read concurrently before processing starts. Clusters are then fused into
+larger tasks if there are too many of them (see SetTasksPerWorkerHint()), while clusters that are much larger
+than the typical task are split, so that a few huge clusters cannot keep a few workers busy long after the
+others are done. The largest tasks are scheduled first, and idle workers steal the remaining tasks of other
+files. GetTaskTimings() reports the start time and duration of each task of the last Process() call.
 */
 
 #include "TROOT.h"
 #include "ROOT/TTreeProcessorMT.hxx"
 
+#include <algorithm>
+#include <chrono>
+#include <numeric> // std::iota
+
 using namespace ROOT;
 
 namespace {
@@ -126,20 +136,55 @@ ConvertToElistClusters(std::vector<std::vector<EntryCluster>> &&clusters, TEntry
 // EntryClusters and number of entries per file
 using ClustersAndEntries = std::pair<std::vector<std::vector<EntryCluster>>, std::vector<Long64_t>>;
 
+/// Split ranges of entries that are much larger than the typical task, in place.
+///
+/// Inputs are often heterogeneous: a few very large files, or files with very large clusters, next to many small
+/// ones. Since each task processes at least a whole cluster, the workers that pick up the largest clusters can still
+/// be busy long after all other tasks are done. To bound this tail, ranges larger than the size that would give each
+/// worker two tasks are split into pieces of about that size. Splitting a cluster has a cost, as the baskets at the
+/// boundaries of the pieces are read and decompressed twice, so pieces are never smaller than kMinEntriesPerSplit.
+static void SplitLargeRanges(std::vector<std::vector<EntryCluster>> &rangesPerFile, Long64_t totalEntries,
+                             unsigned int nWorkers)
+{
+   constexpr Long64_t kMinEntriesPerSplit = 10000;
+   const Long64_t targetRangeSize =
+      std::max(kMinEntriesPerSplit, (totalEntries + 2 * nWorkers - 1) / (2 * Long64_t(nWorkers)));
+
+   for (auto &ranges : rangesPerFile) {
+      std::vector<EntryCluster> splitRanges;
+      splitRanges.reserve(ranges.size());
+      for (const auto &range : ranges) {
+         const auto rangeSize = range.end - range.start;
+         const auto nPieces = rangeSize / targetRangeSize;
+         if (nPieces < 2) {
+            splitRanges.emplace_back(range);
+            continue;
+         }
+         for (Long64_t piece = 0; piece < nPieces; ++piece) {
+            splitRanges.emplace_back(EntryCluster{range.start + rangeSize * piece / nPieces,
+                                                  range.start + rangeSize * (piece + 1) / nPieces});
+         }
+      }
+      ranges = std::move(splitRanges);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Return a vector of cluster boundaries for the given tree and files.
+/// The files are opened concurrently on the given thread pool. Entry numbers are global (i.e. relative to the chain
+/// of all files) if globalEntryNumbers is true, local to each file otherwise.
 static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
-                                       const std::vector<std::string> &fileNames, const unsigned int maxTasksPerFile)
+                                       const std::vector<std::string> &fileNames, const unsigned int maxTasksPerFile,
+                                       ROOT::TThreadExecutor &pool, bool globalEntryNumbers)
 {
    // Note that as a side-effect of opening all files that are going to be used in the
    // analysis once, all necessary streamers will be loaded into memory.
-   TDirectory::TContext c;
    const auto nFileNames = fileNames.size();
-   std::vector<std::vector<EntryCluster>> clustersPerFile;
-   std::vector<Long64_t> entriesPerFile;
-   entriesPerFile.reserve(nFileNames);
-   Long64_t offset = 0ll;
-   for (auto i = 0u; i < nFileNames; ++i) {
+   std::vector<std::vector<EntryCluster>> clustersPerFile(nFileNames);
+   std::vector<Long64_t> entriesPerFile(nFileNames);
+
+   auto readClusters = [&](std::size_t i) {
+      TDirectory::TContext c;
       const auto &fileName = fileNames[i];
       const auto &treeName = treeNames[i];
 
@@ -163,12 +208,32 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
       std::vector<EntryCluster> clusters;
       while ((start = clusterIter()) < entries) {
          end = clusterIter.GetNextEntry();
+         clusters.emplace_back(EntryCluster{start, end});
+      }
+      clustersPerFile[i] = std::move(clusters);
+      entriesPerFile[i] = entries;
+   };
+
+   // The metadata of the files is read concurrently: with many (possibly remote) files, opening them one after the
+   // other would leave all but one worker idle before processing starts.
+   if (nFileNames > 1) {
+      std::vector<std::size_t> fileIdxs(nFileNames);
+      std::iota(fileIdxs.begin(), fileIdxs.end(), 0u);
+      pool.Foreach(readClusters, fileIdxs);
+   } else if (nFileNames == 1) {
+      readClusters(0u);
+   }
+
+   Long64_t offset = 0ll;
+   for (auto i = 0u; i < nFileNames; ++i) {
+      if (globalEntryNumbers) {
          // Add the current file's offset to start and end to make them (chain) global
-         clusters.emplace_back(EntryCluster{start + offset, end + offset});
+         for (auto &cluster : clustersPerFile[i]) {
+            cluster.start += offset;
+            cluster.end += offset;
+         }
       }
-      offset += entries;
-      clustersPerFile.emplace_back(std::move(clusters));
-      entriesPerFile.emplace_back(entries);
+      offset += entriesPerFile[i];
    }
 
    // Here we "fuse" clusters together if the number of clusters is too big with respect to
@@ -217,6 +282,8 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
       }
    }
 
+   SplitLargeRanges(eventRangesPerFile, /*totalEntries=*/offset, pool.GetPoolSize());
+
    return std::make_pair(std::move(eventRangesPerFile), std::move(entriesPerFile));
 }
 
@@ -488,61 +555,75 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    const unsigned int maxTasksPerFile =
       std::ceil(float(GetTasksPerWorkerHint() * fPool.GetPoolSize()) / float(fFileNames.size()));
 
-   // If an entry list or friend trees are present, we need to generate clusters with global entry numbers,
-   // so we do it here for all files.
-   // Otherwise we can do it later, concurrently for each file, and clusters will contain local entry numbers.
-   // TODO: in practice we could also find clusters per-file in the case of no friends and a TEntryList with
+   // If an entry list or friend trees are present, we need to generate clusters with global entry numbers.
+   // Otherwise clusters will contain local entry numbers, and each task will only open the file it processes.
+   // TODO: in practice we could also use local entry numbers in the case of no friends and a TEntryList with
    // sub-entrylists.
    const bool hasFriends = !fFriendInfo.fFriendNames.empty();
    const bool hasEntryList = fEntryList.GetN() > 0;
    const bool shouldRetrieveAllClusters = hasFriends || hasEntryList;
-   ClustersAndEntries clusterAndEntries{};
-   if (shouldRetrieveAllClusters) {
-      clusterAndEntries = MakeClusters(fTreeNames, fFileNames, maxTasksPerFile);
-      if (hasEntryList)
-         clusterAndEntries.first = ConvertToElistClusters(std::move(clusterAndEntries.first), fEntryList, fTreeNames,
-                                                          fFileNames, clusterAndEntries.second);
-   }
+   auto clusterAndEntries = MakeClusters(fTreeNames, fFileNames, maxTasksPerFile, fPool, shouldRetrieveAllClusters);
+   if (hasEntryList)
+      clusterAndEntries.first = ConvertToElistClusters(std::move(clusterAndEntries.first), fEntryList, fTreeNames,
+                                                       fFileNames, clusterAndEntries.second);
 
-   const auto &clusters = clusterAndEntries.first;
+   auto &clusters = clusterAndEntries.first;
    const auto &entries = clusterAndEntries.second;
 
+   // Schedule the largest tasks first, so that the smaller ones fill the gaps at the end of the processing. Workers
+   // that are done with their file steal the remaining tasks of the other files.
+   const auto isLarger = [](const EntryCluster &c1, const EntryCluster &c2) {
+      return c1.end - c1.start > c2.end - c2.start;
+   };
+   for (auto &fileClusters : clusters)
+      std::stable_sort(fileClusters.begin(), fileClusters.end(), isLarger);
+   std::vector<std::size_t> fileIdxs(fFileNames.size());
+   std::iota(fileIdxs.begin(), fileIdxs.end(), 0u);
+   std::stable_sort(fileIdxs.begin(), fileIdxs.end(),
+                    [&entries](std::size_t i, std::size_t j) { return entries[i] > entries[j]; });
+
    // Retrieve number of entries for each file for each friend tree
    const auto friendEntries = hasFriends ? GetFriendEntries(fFriendInfo) : std::vector<std::vector<Long64_t>>{};
 
+   fTaskTimings.clear();
+   const auto processStart = std::chrono::steady_clock::now();
+
    // Parent task, spawns tasks that process each of the entry clusters for each input file
-   // TODO: for readability we should have two versions of this lambda, for shouldRetrieveAllClusters == true/false
    auto processFile = [&](std::size_t fileIdx) {
       // theseFiles contains either all files or just the single file to process
       const auto &theseFiles = shouldRetrieveAllClusters ? fFileNames : std::vector<std::string>({fFileNames[fileIdx]});
       // either all tree names or just the single tree to process
       const auto &theseTrees = shouldRetrieveAllClusters ? fTreeNames : std::vector<std::string>({fTreeNames[fileIdx]});
-      // Evaluate clusters (with local entry numbers) and number of entries for this file, if needed
-      const auto theseClustersAndEntries =
-         shouldRetrieveAllClusters ? ClustersAndEntries{} : MakeClusters(theseTrees, theseFiles, maxTasksPerFile);
-
-      // All clusters for the file to process, either with global or local entry numbers
-      const auto &thisFileClusters = shouldRetrieveAllClusters ? clusters[fileIdx] : theseClustersAndEntries.first[0];
-
       // Either all number of entries or just the ones for this file
-      const auto &theseEntries =
-         shouldRetrieveAllClusters ? entries : std::vector<Long64_t>({theseClustersAndEntries.second[0]});
+      const auto &theseEntries = shouldRetrieveAllClusters ? entries : std::vector<Long64_t>({entries[fileIdx]});
 
       auto processCluster = [&](const EntryCluster &c) {
+         const auto taskStart = std::chrono::steady_clock::now();
          auto r = fTreeView->GetTreeReader(c.start, c.end, theseTrees, theseFiles, fFriendInfo, fEntryList,
                                            theseEntries, friendEntries);
          func(*r);
+         const std::chrono::duration<double> startTime = taskStart - processStart;
+         const std::chrono::duration<double> realTime = std::chrono::steady_clock::now() - taskStart;
+         std::lock_guard<std::mutex> lock(fTaskTimingsMutex);
+         fTaskTimings.push_back({fFileNames[fileIdx], c.start, c.end, startTime.count(), realTime.count()});
       };
 
-      fPool.Foreach(processCluster, thisFileClusters);
+      fPool.Foreach(processCluster, clusters[fileIdx]);
    };
 
-   std::vector<std::size_t> fileIdxs(fFileNames.size());
-   std::iota(fileIdxs.begin(), fileIdxs.end(), 0u);
-
    fPool.Foreach(processFile, fileIdxs);
 }
 
+////////////////////////////////////////////////////////////////////////
+/// \brief Return the timings of the tasks run by the last call to Process().
+///
+/// There is one entry per task, in order of completion. Comparing the start and end times of the tasks exposes the
+/// tail of the processing, i.e. the time during which only a few workers are still busy, and the tasks that cause it.
+const std::vector<TTreeProcessorMT::RTaskTiming> &TTreeProcessorMT::GetTaskTimings() const
+{
+   return fTaskTimings;
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// \brief Retrieve the current value for the desired number of tasks per worker.
 /// \return The desired number of tasks to be created per worker. TTreeProcessorMT uses this value as an hint.
@@ -362,6 +362,51 @@ TEST(TreeProcessorMT, LimitNTasks_CheckClusters)
    gSystem->Unlink(filename);
 }
 
+TEST(TreeProcessorMT, SplitLargeClusters)
+{
+   const auto nEvents = 100000;
+   const auto filename = "TreeProcessorMT_SplitLargeClusters.root";
+   const auto treename = "t";
+   {
+      int v = 0;
+      TFile file(filename, "recreate");
+      TTree t(treename, treename);
+      t.SetAutoFlush(0); // a single cluster
+      t.Branch("v", &v);
+      for (auto i = 0; i < nEvents; ++i)
+         t.Fill();
+      t.Write();
+   }
+
+   std::mutex m;
+   std::vector<std::pair<Long64_t, Long64_t>> ranges;
+   auto getRanges = [&m, &ranges](TTreeReader &t) {
+      std::lock_guard<std::mutex> l(m);
+      ranges.emplace_back(t.GetEntriesRange());
+   };
+
+   const unsigned int nslots = std::min(4U, std::thread::hardware_concurrency());
+   ROOT::EnableImplicitMT(nslots);
+
+   ROOT::TTreeProcessorMT p(filename, treename);
+   p.Process(getRanges);
+
+   CheckClusters(ranges, nEvents);
+   // the cluster is split so that each worker gets two tasks, but tasks never have fewer than 10000 entries
+   if (nslots == 1 || nslots == 2 || nslots == 4)
+      EXPECT_EQ(ranges.size(), 2u * nslots);
+
+   const auto &timings = p.GetTaskTimings();
+   EXPECT_EQ(timings.size(), ranges.size());
+   for (const auto &timing : timings) {
+      EXPECT_EQ(timing.fFileName, filename);
+      EXPECT_GE(timing.fRealTime, 0.);
+   }
+
+   gSystem->Unlink(filename);
+   ROOT::DisableImplicitMT();
+}
+
 TEST(TreeProcessorMT, TreeWithFriendTree)
 {
    std::vector<std::string> fileNames = {"TreeWithFriendTree_Tree.root", "TreeWithFriendTree_Friend.root"};